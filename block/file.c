@@ -1,12 +1,139 @@
 #include <config.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_block.h>
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#define BLOCK_USE_MMAP 1
+#else
+#define BLOCK_USE_MMAP 0
+#endif
+
+/* number of elements buffered by the strided raw_fread/raw_fwrite */
+#define RAW_BUFFER_SIZE 512
+
+/* Binary files written with a header have the layout
+
+     bytes  0-7    magic string "GSLBLOCK"
+            8-39   element type, e.g. "gsl_block_float", zero padded
+            40     byte order of the data, 'L' or 'B'
+            44-47  size of one element in bytes
+            48-55  size1
+            56-63  size2 (1 for vectors)
+            64-    size1 * size2 elements in row-major order
+
+   with the integer fields stored little-endian.  The header length is
+   a multiple of the alignment of every element type, so the data can be
+   used in place when the file is mapped into memory. */
+
+#define BLOCK_HEADER_SIZE 64
+#define BLOCK_MAGIC "GSLBLOCK"
+
+static unsigned char
+block_byte_order (void)
+{
+  union { unsigned int i; unsigned char c[sizeof (unsigned int)]; } u;
+  u.i = 1;
+  return (u.c[0] == 1) ? 'L' : 'B';
+}
+
+static void
+block_put_uint (unsigned char * p, size_t x, const size_t len)
+{
+  size_t k;
+
+  for (k = 0; k < len; k++)
+    {
+      p[k] = (unsigned char) (x & 0xff);
+      x >>= 8;
+    }
+}
+
+static int
+block_get_uint (const unsigned char * p, const size_t len, size_t * x)
+{
+  size_t k = len;
+
+  *x = 0;
+
+  while (k-- > 0)
+    {
+      if (*x >> (8 * sizeof (size_t) - 8))
+        return GSL_EOVRFLW;
+
+      *x = (*x << 8) | p[k];
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+block_make_header (unsigned char * header, const char * type,
+                   const size_t esize, const size_t size1, const size_t size2)
+{
+  memset (header, 0, BLOCK_HEADER_SIZE);
+  memcpy (header, BLOCK_MAGIC, 8);
+  strncpy ((char *) header + 8, type, 32);
+  header[40] = block_byte_order ();
+  block_put_uint (header + 44, esize, 4);
+  block_put_uint (header + 48, size1, 8);
+  block_put_uint (header + 56, size2, 8);
+}
+
+static int
+block_read_header (FILE * stream, const char * type, const size_t esize,
+                   size_t * size1, size_t * size2)
+{
+  unsigned char header[BLOCK_HEADER_SIZE];
+  size_t items = fread (header, 1, BLOCK_HEADER_SIZE, stream);
+  size_t e;
+
+  if (items != BLOCK_HEADER_SIZE)
+    {
+      GSL_ERROR ("fread failed", GSL_EFAILED);
+    }
+
+  if (memcmp (header, BLOCK_MAGIC, 8) != 0)
+    {
+      GSL_ERROR ("file does not start with a block header", GSL_EINVAL);
+    }
+
+  if (strncmp ((const char *) header + 8, type, 32) != 0)
+    {
+      GSL_ERROR ("element type in file does not match", GSL_EINVAL);
+    }
+
+  if (header[40] != block_byte_order ())
+    {
+      GSL_ERROR ("byte order of file does not match this machine", GSL_EINVAL);
+    }
+
+  if (block_get_uint (header + 44, 4, &e) || e != esize)
+    {
+      GSL_ERROR ("element size in file does not match", GSL_EINVAL);
+    }
+
+  if (block_get_uint (header + 48, 8, size1)
+      || block_get_uint (header + 56, 8, size2)
+      || (*size2 != 0
+          && *size1 > ((size_t) -1 - BLOCK_HEADER_SIZE) / esize / *size2))
+    {
+      GSL_ERROR ("dimensions in file are too large", GSL_EOVRFLW);
+    }
+
+  return GSL_SUCCESS;
+}
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_GSL_COMPLEX_LONG
 
@@ -14,6 +141,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_GSL_COMPLEX
 
@@ -21,6 +149,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_GSL_COMPLEX_FLOAT
 
@@ -28,6 +157,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_LONG_DOUBLE
 
@@ -35,6 +165,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -42,6 +173,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
@@ -49,6 +181,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_ULONG
 
@@ -56,6 +189,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_LONG
 
@@ -63,6 +197,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_UINT
 
@@ -70,6 +205,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_INT
 
@@ -77,6 +213,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_USHORT
 
@@ -84,6 +221,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_SHORT
 
@@ -91,6 +229,7 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_UCHAR
 
@@ -98,5 +237,6 @@
 #include "templates_on.h"
 #include "fwrite_source.c"
 #include "fprintf_source.c"
+#include "mmap_source.c"
 #include "templates_off.h"
 #undef  BASE_CHAR
@@ -66,16 +66,31 @@ FUNCTION (gsl_block, raw_fread) (FILE * stream, ATOMIC * data,
     }
   else
     {
-      size_t i;
+      /* read contiguous chunks into a buffer and scatter them, instead
+         of issuing one fread per element */
 
-      for (i = 0; i < n; i++)
+      ATOMIC buf[MULTIPLICITY * RAW_BUFFER_SIZE];
+      size_t i = 0, j, k;
+
+      while (i < n)
         {
-          size_t item = fread (data + MULTIPLICITY * i * stride,
-                               MULTIPLICITY * sizeof (ATOMIC), 1, stream);
-          if (item != 1)
+          size_t nb = (n - i < RAW_BUFFER_SIZE) ? n - i : RAW_BUFFER_SIZE;
+          size_t items = fread (buf, MULTIPLICITY * sizeof (ATOMIC), nb, stream);
+
+          if (items != nb)
             {
               GSL_ERROR ("fread failed", GSL_EFAILED);
             }
+
+          for (j = 0; j < nb; j++)
+            {
+              for (k = 0; k < MULTIPLICITY; k++)
+                {
+                  data[MULTIPLICITY * (i + j) * stride + k] = buf[MULTIPLICITY * j + k];
+                }
+            }
+
+          i += nb;
         }
     }
 
@@ -98,19 +113,62 @@ FUNCTION (gsl_block, raw_fwrite) (FILE * stream, const ATOMIC * data,
     }
   else
     {
-      size_t i;
+      /* gather elements into a buffer and write them in chunks */
 
-      for (i = 0; i < n; i++)
+      ATOMIC buf[MULTIPLICITY * RAW_BUFFER_SIZE];
+      size_t i = 0, j, k;
+
+      while (i < n)
         {
-          size_t item = fwrite (data + MULTIPLICITY * i * stride,
-                                MULTIPLICITY * sizeof (ATOMIC),
-                                1, stream);
-          if (item != 1)
+          size_t nb = (n - i < RAW_BUFFER_SIZE) ? n - i : RAW_BUFFER_SIZE;
+          size_t items;
+
+          for (j = 0; j < nb; j++)
+            {
+              for (k = 0; k < MULTIPLICITY; k++)
+                {
+                  buf[MULTIPLICITY * j + k] = data[MULTIPLICITY * (i + j) * stride + k];
+                }
+            }
+
+          items = fwrite (buf, MULTIPLICITY * sizeof (ATOMIC), nb, stream);
+
+          if (items != nb)
             {
               GSL_ERROR ("fwrite failed", GSL_EFAILED);
             }
+
+          i += nb;
         }
     }
 
   return GSL_SUCCESS;
 }
+
+int
+FUNCTION (gsl_block, raw_fwrite_header) (FILE * stream, const size_t size1,
+                                         const size_t size2)
+{
+  unsigned char header[BLOCK_HEADER_SIZE];
+  size_t items;
+
+  block_make_header (header, NAME (gsl_block), MULTIPLICITY * sizeof (ATOMIC),
+                     size1, size2);
+
+  items = fwrite (header, 1, BLOCK_HEADER_SIZE, stream);
+
+  if (items != BLOCK_HEADER_SIZE)
+    {
+      GSL_ERROR ("fwrite failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION (gsl_block, raw_fread_header) (FILE * stream, size_t * size1,
+                                        size_t * size2)
+{
+  return block_read_header (stream, NAME (gsl_block),
+                            MULTIPLICITY * sizeof (ATOMIC), size1, size2);
+}
@@ -47,6 +47,9 @@ gsl_block_char *gsl_block_char_alloc (const size_t n);
 gsl_block_char *gsl_block_char_calloc (const size_t n);
 void gsl_block_char_free (gsl_block_char * b);
 
+gsl_block_char *gsl_block_char_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_char_munmap (gsl_block_char * b);
+
 int gsl_block_char_fread (FILE * stream, gsl_block_char * b);
 int gsl_block_char_fwrite (FILE * stream, const gsl_block_char * b);
 int gsl_block_char_fscanf (FILE * stream, gsl_block_char * b);
@@ -54,6 +57,8 @@ int gsl_block_char_fprintf (FILE * stream, const gsl_block_char * b, const char
 
 int gsl_block_char_raw_fread (FILE * stream, char * b, const size_t n, const size_t stride);
 int gsl_block_char_raw_fwrite (FILE * stream, const char * b, const size_t n, const size_t stride);
+int gsl_block_char_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_char_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_char_raw_fscanf (FILE * stream, char * b, const size_t n, const size_t stride);
 int gsl_block_char_raw_fprintf (FILE * stream, const char * b, const size_t n, const size_t stride, const char *format);
 
@@ -47,6 +47,9 @@ gsl_block_complex *gsl_block_complex_alloc (const size_t n);
 gsl_block_complex *gsl_block_complex_calloc (const size_t n);
 void gsl_block_complex_free (gsl_block_complex * b);
 
+gsl_block_complex *gsl_block_complex_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_complex_munmap (gsl_block_complex * b);
+
 int gsl_block_complex_fread (FILE * stream, gsl_block_complex * b);
 int gsl_block_complex_fwrite (FILE * stream, const gsl_block_complex * b);
 int gsl_block_complex_fscanf (FILE * stream, gsl_block_complex * b);
@@ -54,6 +57,8 @@ int gsl_block_complex_fprintf (FILE * stream, const gsl_block_complex * b, const
 
 int gsl_block_complex_raw_fread (FILE * stream, double * b, const size_t n, const size_t stride);
 int gsl_block_complex_raw_fwrite (FILE * stream, const double * b, const size_t n, const size_t stride);
+int gsl_block_complex_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_complex_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_complex_raw_fscanf (FILE * stream, double * b, const size_t n, const size_t stride);
 int gsl_block_complex_raw_fprintf (FILE * stream, const double * b, const size_t n, const size_t stride, const char *format);
 
@@ -47,6 +47,9 @@ gsl_block_complex_float *gsl_block_complex_float_alloc (const size_t n);
 gsl_block_complex_float *gsl_block_complex_float_calloc (const size_t n);
 void gsl_block_complex_float_free (gsl_block_complex_float * b);
 
+gsl_block_complex_float *gsl_block_complex_float_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_complex_float_munmap (gsl_block_complex_float * b);
+
 int gsl_block_complex_float_fread (FILE * stream, gsl_block_complex_float * b);
 int gsl_block_complex_float_fwrite (FILE * stream, const gsl_block_complex_float * b);
 int gsl_block_complex_float_fscanf (FILE * stream, gsl_block_complex_float * b);
@@ -54,6 +57,8 @@ int gsl_block_complex_float_fprintf (FILE * stream, const gsl_block_complex_floa
 
 int gsl_block_complex_float_raw_fread (FILE * stream, float * b, const size_t n, const size_t stride);
 int gsl_block_complex_float_raw_fwrite (FILE * stream, const float * b, const size_t n, const size_t stride);
+int gsl_block_complex_float_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_complex_float_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_complex_float_raw_fscanf (FILE * stream, float * b, const size_t n, const size_t stride);
 int gsl_block_complex_float_raw_fprintf (FILE * stream, const float * b, const size_t n, const size_t stride, const char *format);
 
@@ -47,6 +47,9 @@ gsl_block *gsl_block_alloc (const size_t n);
 gsl_block *gsl_block_calloc (const size_t n);
 void gsl_block_free (gsl_block * b);
 
+gsl_block *gsl_block_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_munmap (gsl_block * b);
+
 int gsl_block_fread (FILE * stream, gsl_block * b);
 int gsl_block_fwrite (FILE * stream, const gsl_block * b);
 int gsl_block_fscanf (FILE * stream, gsl_block * b);
@@ -54,6 +57,8 @@ int gsl_block_fprintf (FILE * stream, const gsl_block * b, const char *format);
 
 int gsl_block_raw_fread (FILE * stream, double * b, const size_t n, const size_t stride);
 int gsl_block_raw_fwrite (FILE * stream, const double * b, const size_t n, const size_t stride);
+int gsl_block_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_raw_fscanf (FILE * stream, double * b, const size_t n, const size_t stride);
 int gsl_block_raw_fprintf (FILE * stream, const double * b, const size_t n, const size_t stride, const char *format);
 
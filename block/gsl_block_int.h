@@ -47,6 +47,9 @@ gsl_block_int *gsl_block_int_alloc (const size_t n);
 gsl_block_int *gsl_block_int_calloc (const size_t n);
 void gsl_block_int_free (gsl_block_int * b);
 
+gsl_block_int *gsl_block_int_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_int_munmap (gsl_block_int * b);
+
 int gsl_block_int_fread (FILE * stream, gsl_block_int * b);
 int gsl_block_int_fwrite (FILE * stream, const gsl_block_int * b);
 int gsl_block_int_fscanf (FILE * stream, gsl_block_int * b);
@@ -54,6 +57,8 @@ int gsl_block_int_fprintf (FILE * stream, const gsl_block_int * b, const char *f
 
 int gsl_block_int_raw_fread (FILE * stream, int * b, const size_t n, const size_t stride);
 int gsl_block_int_raw_fwrite (FILE * stream, const int * b, const size_t n, const size_t stride);
+int gsl_block_int_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_int_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_int_raw_fscanf (FILE * stream, int * b, const size_t n, const size_t stride);
 int gsl_block_int_raw_fprintf (FILE * stream, const int * b, const size_t n, const size_t stride, const char *format);
 
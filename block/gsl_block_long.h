@@ -47,6 +47,9 @@ gsl_block_long *gsl_block_long_alloc (const size_t n);
 gsl_block_long *gsl_block_long_calloc (const size_t n);
 void gsl_block_long_free (gsl_block_long * b);
 
+gsl_block_long *gsl_block_long_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_long_munmap (gsl_block_long * b);
+
 int gsl_block_long_fread (FILE * stream, gsl_block_long * b);
 int gsl_block_long_fwrite (FILE * stream, const gsl_block_long * b);
 int gsl_block_long_fscanf (FILE * stream, gsl_block_long * b);
@@ -54,6 +57,8 @@ int gsl_block_long_fprintf (FILE * stream, const gsl_block_long * b, const char
 
 int gsl_block_long_raw_fread (FILE * stream, long * b, const size_t n, const size_t stride);
 int gsl_block_long_raw_fwrite (FILE * stream, const long * b, const size_t n, const size_t stride);
+int gsl_block_long_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_long_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_long_raw_fscanf (FILE * stream, long * b, const size_t n, const size_t stride);
 int gsl_block_long_raw_fprintf (FILE * stream, const long * b, const size_t n, const size_t stride, const char *format);
 
@@ -47,6 +47,9 @@ gsl_block_long_double *gsl_block_long_double_alloc (const size_t n);
 gsl_block_long_double *gsl_block_long_double_calloc (const size_t n);
 void gsl_block_long_double_free (gsl_block_long_double * b);
 
+gsl_block_long_double *gsl_block_long_double_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_long_double_munmap (gsl_block_long_double * b);
+
 int gsl_block_long_double_fread (FILE * stream, gsl_block_long_double * b);
 int gsl_block_long_double_fwrite (FILE * stream, const gsl_block_long_double * b);
 int gsl_block_long_double_fscanf (FILE * stream, gsl_block_long_double * b);
@@ -54,6 +57,8 @@ int gsl_block_long_double_fprintf (FILE * stream, const gsl_block_long_double *
 
 int gsl_block_long_double_raw_fread (FILE * stream, long double * b, const size_t n, const size_t stride);
 int gsl_block_long_double_raw_fwrite (FILE * stream, const long double * b, const size_t n, const size_t stride);
+int gsl_block_long_double_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_long_double_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_long_double_raw_fscanf (FILE * stream, long double * b, const size_t n, const size_t stride);
 int gsl_block_long_double_raw_fprintf (FILE * stream, const long double * b, const size_t n, const size_t stride, const char *format);
 
@@ -47,6 +47,9 @@ gsl_block_short *gsl_block_short_alloc (const size_t n);
 gsl_block_short *gsl_block_short_calloc (const size_t n);
 void gsl_block_short_free (gsl_block_short * b);
 
+gsl_block_short *gsl_block_short_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_short_munmap (gsl_block_short * b);
+
 int gsl_block_short_fread (FILE * stream, gsl_block_short * b);
 int gsl_block_short_fwrite (FILE * stream, const gsl_block_short * b);
 int gsl_block_short_fscanf (FILE * stream, gsl_block_short * b);
@@ -54,6 +57,8 @@ int gsl_block_short_fprintf (FILE * stream, const gsl_block_short * b, const cha
 
 int gsl_block_short_raw_fread (FILE * stream, short * b, const size_t n, const size_t stride);
 int gsl_block_short_raw_fwrite (FILE * stream, const short * b, const size_t n, const size_t stride);
+int gsl_block_short_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_short_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_short_raw_fscanf (FILE * stream, short * b, const size_t n, const size_t stride);
 int gsl_block_short_raw_fprintf (FILE * stream, const short * b, const size_t n, const size_t stride, const char *format);
 
@@ -47,6 +47,9 @@ gsl_block_uchar *gsl_block_uchar_alloc (const size_t n);
 gsl_block_uchar *gsl_block_uchar_calloc (const size_t n);
 void gsl_block_uchar_free (gsl_block_uchar * b);
 
+gsl_block_uchar *gsl_block_uchar_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_uchar_munmap (gsl_block_uchar * b);
+
 int gsl_block_uchar_fread (FILE * stream, gsl_block_uchar * b);
 int gsl_block_uchar_fwrite (FILE * stream, const gsl_block_uchar * b);
 int gsl_block_uchar_fscanf (FILE * stream, gsl_block_uchar * b);
@@ -54,6 +57,8 @@ int gsl_block_uchar_fprintf (FILE * stream, const gsl_block_uchar * b, const cha
 
 int gsl_block_uchar_raw_fread (FILE * stream, unsigned char * b, const size_t n, const size_t stride);
 int gsl_block_uchar_raw_fwrite (FILE * stream, const unsigned char * b, const size_t n, const size_t stride);
+int gsl_block_uchar_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_uchar_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_uchar_raw_fscanf (FILE * stream, unsigned char * b, const size_t n, const size_t stride);
 int gsl_block_uchar_raw_fprintf (FILE * stream, const unsigned char * b, const size_t n, const size_t stride, const char *format);
 
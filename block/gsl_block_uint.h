@@ -47,6 +47,9 @@ gsl_block_uint *gsl_block_uint_alloc (const size_t n);
 gsl_block_uint *gsl_block_uint_calloc (const size_t n);
 void gsl_block_uint_free (gsl_block_uint * b);
 
+gsl_block_uint *gsl_block_uint_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_uint_munmap (gsl_block_uint * b);
+
 int gsl_block_uint_fread (FILE * stream, gsl_block_uint * b);
 int gsl_block_uint_fwrite (FILE * stream, const gsl_block_uint * b);
 int gsl_block_uint_fscanf (FILE * stream, gsl_block_uint * b);
@@ -54,6 +57,8 @@ int gsl_block_uint_fprintf (FILE * stream, const gsl_block_uint * b, const char
 
 int gsl_block_uint_raw_fread (FILE * stream, unsigned int * b, const size_t n, const size_t stride);
 int gsl_block_uint_raw_fwrite (FILE * stream, const unsigned int * b, const size_t n, const size_t stride);
+int gsl_block_uint_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_uint_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_uint_raw_fscanf (FILE * stream, unsigned int * b, const size_t n, const size_t stride);
 int gsl_block_uint_raw_fprintf (FILE * stream, const unsigned int * b, const size_t n, const size_t stride, const char *format);
 
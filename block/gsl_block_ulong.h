@@ -47,6 +47,9 @@ gsl_block_ulong *gsl_block_ulong_alloc (const size_t n);
 gsl_block_ulong *gsl_block_ulong_calloc (const size_t n);
 void gsl_block_ulong_free (gsl_block_ulong * b);
 
+gsl_block_ulong *gsl_block_ulong_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_ulong_munmap (gsl_block_ulong * b);
+
 int gsl_block_ulong_fread (FILE * stream, gsl_block_ulong * b);
 int gsl_block_ulong_fwrite (FILE * stream, const gsl_block_ulong * b);
 int gsl_block_ulong_fscanf (FILE * stream, gsl_block_ulong * b);
@@ -54,6 +57,8 @@ int gsl_block_ulong_fprintf (FILE * stream, const gsl_block_ulong * b, const cha
 
 int gsl_block_ulong_raw_fread (FILE * stream, unsigned long * b, const size_t n, const size_t stride);
 int gsl_block_ulong_raw_fwrite (FILE * stream, const unsigned long * b, const size_t n, const size_t stride);
+int gsl_block_ulong_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_ulong_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_ulong_raw_fscanf (FILE * stream, unsigned long * b, const size_t n, const size_t stride);
 int gsl_block_ulong_raw_fprintf (FILE * stream, const unsigned long * b, const size_t n, const size_t stride, const char *format);
 
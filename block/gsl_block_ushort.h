@@ -47,6 +47,9 @@ gsl_block_ushort *gsl_block_ushort_alloc (const size_t n);
 gsl_block_ushort *gsl_block_ushort_calloc (const size_t n);
 void gsl_block_ushort_free (gsl_block_ushort * b);
 
+gsl_block_ushort *gsl_block_ushort_mmap (const char * filename, size_t * size1, size_t * size2);
+void gsl_block_ushort_munmap (gsl_block_ushort * b);
+
 int gsl_block_ushort_fread (FILE * stream, gsl_block_ushort * b);
 int gsl_block_ushort_fwrite (FILE * stream, const gsl_block_ushort * b);
 int gsl_block_ushort_fscanf (FILE * stream, gsl_block_ushort * b);
@@ -54,6 +57,8 @@ int gsl_block_ushort_fprintf (FILE * stream, const gsl_block_ushort * b, const c
 
 int gsl_block_ushort_raw_fread (FILE * stream, unsigned short * b, const size_t n, const size_t stride);
 int gsl_block_ushort_raw_fwrite (FILE * stream, const unsigned short * b, const size_t n, const size_t stride);
+int gsl_block_ushort_raw_fwrite_header (FILE * stream, const size_t size1, const size_t size2);
+int gsl_block_ushort_raw_fread_header (FILE * stream, size_t * size1, size_t * size2);
 int gsl_block_ushort_raw_fscanf (FILE * stream, unsigned short * b, const size_t n, const size_t stride);
 int gsl_block_ushort_raw_fprintf (FILE * stream, const unsigned short * b, const size_t n, const size_t stride, const char *format);
 
@@ -0,0 +1,131 @@
+/* block/mmap_source.c
+ * 
+ * Copyright (C) 2014 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Map the data of a file written with a header by
+   gsl_block_raw_fwrite_header into memory for reading.  The dimensions
+   stored in the header are returned in size1, size2 and the block
+   holds size1 * size2 elements.  Where mmap is not available the data
+   is read into allocated memory instead, so the block must always be
+   released with gsl_block_munmap. */
+
+TYPE (gsl_block) *
+FUNCTION (gsl_block, mmap) (const char * filename, size_t * size1,
+                            size_t * size2)
+{
+  const size_t esize = MULTIPLICITY * sizeof (ATOMIC);
+  TYPE (gsl_block) * b;
+  FILE * stream;
+  size_t n;
+  int status;
+
+  stream = fopen (filename, "rb");
+
+  if (stream == 0)
+    {
+      GSL_ERROR_VAL ("unable to open file", GSL_EFAILED, 0);
+    }
+
+  status = block_read_header (stream, NAME (gsl_block), esize, size1, size2);
+
+  if (status)
+    {
+      fclose (stream);
+      return 0;
+    }
+
+  n = *size1 * *size2;
+
+  b = (TYPE (gsl_block) *) malloc (sizeof (TYPE (gsl_block)));
+
+  if (b == 0)
+    {
+      fclose (stream);
+      GSL_ERROR_VAL ("failed to allocate space for block struct",
+                     GSL_ENOMEM, 0);
+    }
+
+#if BLOCK_USE_MMAP
+  {
+    const size_t len = BLOCK_HEADER_SIZE + n * esize;
+    const int fd = fileno (stream);
+    struct stat st;
+    void *p;
+
+    if (fstat (fd, &st) != 0 || (size_t) st.st_size < len)
+      {
+        free (b);
+        fclose (stream);
+        GSL_ERROR_VAL ("file is shorter than its header indicates",
+                       GSL_EFAILED, 0);
+      }
+
+    p = mmap (0, len, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (p == MAP_FAILED)
+      {
+        free (b);
+        fclose (stream);
+        GSL_ERROR_VAL ("mmap failed", GSL_EFAILED, 0);
+      }
+
+    b->data = (ATOMIC *) ((char *) p + BLOCK_HEADER_SIZE);
+  }
+#else
+  b->data = (ATOMIC *) malloc (n * esize + 1);
+
+  if (b->data == 0)
+    {
+      free (b);
+      fclose (stream);
+      GSL_ERROR_VAL ("failed to allocate space for block data",
+                     GSL_ENOMEM, 0);
+    }
+
+  status = FUNCTION (gsl_block, raw_fread) (stream, b->data, n, 1);
+
+  if (status)
+    {
+      free (b->data);
+      free (b);
+      fclose (stream);
+      return 0;
+    }
+#endif
+
+  b->size = n;
+
+  fclose (stream);
+
+  return b;
+}
+
+void
+FUNCTION (gsl_block, munmap) (TYPE (gsl_block) * b)
+{
+  RETURN_IF_NULL (b);
+
+#if BLOCK_USE_MMAP
+  munmap ((char *) b->data - BLOCK_HEADER_SIZE,
+          BLOCK_HEADER_SIZE + b->size * MULTIPLICITY * sizeof (ATOMIC));
+#else
+  free (b->data);
+#endif
+
+  free (b);
+}
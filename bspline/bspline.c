@@ -483,6 +483,143 @@ gsl_bspline_eval_nonzero (const double x, gsl_vector * Bk, size_t * istart,
     }
 } /* gsl_bspline_eval_nonzero() */
 
+/*
+gsl_bspline_eval_nonzero_array()
+  Evaluate all non-zero B-spline functions at each point of x,
+giving the rows of a banded design matrix. The knot interval
+search for each point resumes from the interval of the previous
+point, so for an increasing sequence of x values the total
+cost is O(m k^2 + l) rather than O(m (k^2 + l)).
+
+Inputs: x      - points at which to evaluate splines (length m),
+                 preferably in increasing order
+        Bk     - (output) m-by-k matrix; row r contains
+                 B_{istart[r]}(x_r), ..., B_{istart[r]+k-1}(x_r)
+        istart - (output) array of length m, index of the
+                 first non-zero basis function for each x_r
+        w      - bspline workspace
+
+Return: success or error
+*/
+
+int
+gsl_bspline_eval_nonzero_array (const gsl_vector * x, gsl_matrix * Bk,
+                                size_t * istart, gsl_bspline_workspace * w)
+{
+  if (Bk->size1 != x->size)
+    {
+      GSL_ERROR ("Bk matrix rows do not match length of x", GSL_EBADLEN);
+    }
+  else if (Bk->size2 != w->k)
+    {
+      GSL_ERROR ("Bk matrix columns do not match order k", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t r;			/* looping */
+      size_t i = w->k - 1;	/* knot interval of previous point */
+      size_t j;			/* bsplvb index */
+
+      for (r = 0; r < x->size; r++)
+        {
+          const double xr = gsl_vector_get (x, r);
+          gsl_vector_view Br = gsl_matrix_row (Bk, r);
+          int flag = 0;
+          int error;
+
+          if (xr < gsl_vector_get (w->knots, i))
+            i = w->k - 1;
+
+          i = bspline_find_interval_from (xr, i, &flag, w);
+          error = bspline_process_interval_for_eval (xr, &i, flag, w);
+          if (error)
+            return error;
+
+          istart[r] = i - w->k + 1;
+
+          bspline_pppack_bsplvb (w->knots, w->k, 1, xr, i, &j, w->deltal,
+                                 w->deltar, w->B);
+
+          gsl_vector_memcpy (&Br.vector, w->B);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_bspline_eval_nonzero_array() */
+
+/*
+gsl_bspline_calc_array()
+  Evaluate the spline sum_i c_i B_i(x) at each point of x with
+de Boor's algorithm, without forming the basis functions.
+
+Inputs: x - points at which to evaluate the spline (length m),
+            preferably in increasing order
+        c - spline coefficients (length n)
+        y - (output) spline values (length m)
+        w - bspline workspace
+
+Return: success or error
+*/
+
+int
+gsl_bspline_calc_array (const gsl_vector * x, const gsl_vector * c,
+                        gsl_vector * y, gsl_bspline_workspace * w)
+{
+  if (c->size != w->n)
+    {
+      GSL_ERROR ("vector c not of length n", GSL_EBADLEN);
+    }
+  else if (y->size != x->size)
+    {
+      GSL_ERROR ("vectors x and y have different lengths", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t k = w->k;
+      const gsl_vector *t = w->knots;
+      gsl_vector *d = w->B;	/* de Boor points, length k */
+      size_t r, q, s;		/* looping */
+      size_t i = k - 1;		/* knot interval of previous point */
+
+      for (r = 0; r < x->size; r++)
+        {
+          const double xr = gsl_vector_get (x, r);
+          int flag = 0;
+          int error;
+
+          if (xr < gsl_vector_get (t, i))
+            i = k - 1;
+
+          i = bspline_find_interval_from (xr, i, &flag, w);
+          error = bspline_process_interval_for_eval (xr, &i, flag, w);
+          if (error)
+            return error;
+
+          /* d_q = c_{i-k+1+q}, then apply the de Boor recurrence */
+          for (q = 0; q < k; q++)
+            gsl_vector_set (d, q, gsl_vector_get (c, i - k + 1 + q));
+
+          for (s = 1; s < k; s++)
+            {
+              for (q = k - 1; q >= s; q--)
+                {
+                  const double tl = gsl_vector_get (t, i - k + 1 + q);
+                  const double tr = gsl_vector_get (t, i + 1 + q - s);
+                  const double alpha = (xr - tl) / (tr - tl);
+
+                  gsl_vector_set (d, q,
+                                  (1.0 - alpha) * gsl_vector_get (d, q - 1)
+                                  + alpha * gsl_vector_get (d, q));
+                }
+            }
+
+          gsl_vector_set (y, r, gsl_vector_get (d, k - 1));
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_bspline_calc_array() */
+
 /*
 gsl_bspline_deriv_eval()
   Evaluate d^j/dx^j B_i(x) for all i, 0 <= j <= nderiv.
@@ -664,6 +801,21 @@ Notes: The error conditions are reported as follows:
 
 static inline size_t
 bspline_find_interval (const double x, int *flag, gsl_bspline_workspace * w)
+{
+  return bspline_find_interval_from (x, w->k - 1, flag, w);
+}				/* bspline_find_interval() */
+
+/*
+bspline_find_interval_from()
+  As bspline_find_interval(), but start the search at knot index
+start >= k - 1, which must satisfy t_start <= x.  This allows a
+search for an increasing sequence of x values to resume from the
+interval found for the previous value.
+*/
+
+static inline size_t
+bspline_find_interval_from (const double x, const size_t start, int *flag,
+			    gsl_bspline_workspace * w)
 {
   size_t i;
 
@@ -674,7 +826,7 @@ bspline_find_interval (const double x, int *flag, gsl_bspline_workspace * w)
     }
 
   /* find i such that t_i <= x < t_{i+1} */
-  for (i = w->k - 1; i < w->k + w->l - 1; i++)
+  for (i = start; i < w->k + w->l - 1; i++)
     {
       const double ti = gsl_vector_get (w->knots, i);
       const double tip1 = gsl_vector_get (w->knots, i + 1);
@@ -698,7 +850,7 @@ bspline_find_interval (const double x, int *flag, gsl_bspline_workspace * w)
     *flag = 0;
 
   return i;
-}				/* bspline_find_interval() */
+}				/* bspline_find_interval_from() */
 
 /*
 bspline_process_interval_for_eval()
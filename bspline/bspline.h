@@ -1,6 +1,10 @@
 static inline size_t
 bspline_find_interval (const double x, int *flag, gsl_bspline_workspace * w);
 
+static inline size_t
+bspline_find_interval_from (const double x, const size_t start, int *flag,
+			    gsl_bspline_workspace * w);
+
 static inline int
 bspline_process_interval_for_eval (const double x, size_t * i, int flag,
 				   gsl_bspline_workspace * w);
@@ -0,0 +1,449 @@
+/* bspline/fit.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_bspline.h>
+
+/*
+ * This module contains a least squares fitting routine for B-splines
+ * which exploits the band structure of the design matrix. Each row
+ * of the design matrix X has at most k nonzero elements, so the upper
+ * triangular factor R of its QR decomposition has bandwidth k. The
+ * rows of [X y] are folded into R and z = Q^T y with Givens rotations
+ * as they are accumulated, in O(k^2) operations per row when the data
+ * are sorted by x, and the solution is found by back-substitution in
+ * O(n k) operations. The banded storage is
+ *
+ *   R(i, i + j) = R[i][j],  0 <= j < k
+ *
+ * An optional penalty lambda ||D_d c||^2, where D_d is the matrix of
+ * d-th order differences, gives the P-spline smoother of Eilers and
+ * Marx. When solving, the rows of R and of sqrt(lambda) D_d are folded
+ * into a new factor in order of their first column, so that the
+ * rotations stay within the band and the penalized factor costs
+ * O(n k^2) operations.
+ *
+ * [1] C. L. Lawson and R. J. Hanson, Solving Least Squares Problems,
+ *     SIAM, 1995, chapter 27.
+ *
+ * [2] P. H. C. Eilers and B. D. Marx, Flexible smoothing with
+ *     B-splines and penalties, Statistical Science 11 (1996) 89-121.
+ */
+
+/* number of points evaluated together by gsl_bspline_lsfit_accumulate */
+#define LSFIT_BLOCK 256
+
+/*
+gsl_bspline_lsfit_alloc()
+  Allocate a workspace for fitting B-splines with the basis of the
+given bspline workspace. The size of the workspace is O(4 n k)
+*/
+
+gsl_bspline_lsfit_workspace *
+gsl_bspline_lsfit_alloc (const gsl_bspline_workspace * bw)
+{
+  gsl_bspline_lsfit_workspace *w;
+
+  w = calloc (1, sizeof (gsl_bspline_lsfit_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for lsfit workspace",
+                      GSL_ENOMEM);
+    }
+
+  w->n = bw->n;
+  w->k = bw->k;
+
+  w->R = gsl_matrix_calloc (w->n, w->k);
+  if (w->R == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for R", GSL_ENOMEM);
+    }
+
+  w->z = gsl_vector_calloc (w->n);
+  if (w->z == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for z", GSL_ENOMEM);
+    }
+
+  w->work_R = gsl_matrix_alloc (w->n, w->k);
+  if (w->work_R == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for work_R", GSL_ENOMEM);
+    }
+
+  w->work_z = gsl_vector_alloc (w->n);
+  if (w->work_z == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for work_z", GSL_ENOMEM);
+    }
+
+  w->row = gsl_vector_alloc (w->k);
+  if (w->row == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for row", GSL_ENOMEM);
+    }
+
+  w->Bk = gsl_matrix_alloc (LSFIT_BLOCK, w->k);
+  if (w->Bk == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for Bk", GSL_ENOMEM);
+    }
+
+  w->istart = malloc (LSFIT_BLOCK * sizeof (size_t));
+  if (w->istart == 0)
+    {
+      gsl_bspline_lsfit_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for istart", GSL_ENOMEM);
+    }
+
+  w->nobs = 0;
+  w->rnorm2 = 0.0;
+
+  return w;
+} /* gsl_bspline_lsfit_alloc() */
+
+void
+gsl_bspline_lsfit_free (gsl_bspline_lsfit_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->R)
+    gsl_matrix_free (w->R);
+
+  if (w->z)
+    gsl_vector_free (w->z);
+
+  if (w->work_R)
+    gsl_matrix_free (w->work_R);
+
+  if (w->work_z)
+    gsl_vector_free (w->work_z);
+
+  if (w->row)
+    gsl_vector_free (w->row);
+
+  if (w->Bk)
+    gsl_matrix_free (w->Bk);
+
+  if (w->istart)
+    free (w->istart);
+
+  free (w);
+} /* gsl_bspline_lsfit_free() */
+
+int
+gsl_bspline_lsfit_reset (gsl_bspline_lsfit_workspace * w)
+{
+  gsl_matrix_set_zero (w->R);
+  gsl_vector_set_zero (w->z);
+  w->nobs = 0;
+  w->rnorm2 = 0.0;
+
+  return GSL_SUCCESS;
+} /* gsl_bspline_lsfit_reset() */
+
+/*
+lsfit_fold_row()
+  Fold the row v, whose nonzero elements are in columns
+[s, s + k - 1], with right hand side b into the banded factor (R, z)
+
+Inputs: R - n-by-k band of upper triangular factor
+        z - right hand side Q^T y
+        s - first nonzero column of row
+        v - (destroyed) nonzero elements of row, length k
+        b - right hand side of row
+
+Return: the part of b which is not in the range of R
+
+Notes: The window v holds columns [c, c + k - 1] of the row being
+eliminated, and the elimination stops when it is zero. For rows added
+in order of increasing s this happens after at most k columns, since
+R then has no elements to the right of column s + k - 1. Otherwise
+rotations fill in further columns and the elimination takes longer.
+*/
+
+static double
+lsfit_fold_row (gsl_matrix * R, gsl_vector * z, const size_t s,
+                gsl_vector * v, double b)
+{
+  const size_t n = R->size1;
+  const size_t k = R->size2;
+  size_t c, j;
+
+  for (c = s; c < n; c++)
+    {
+      double v0 = gsl_vector_get (v, 0);
+      int nonzero = 0;
+
+      if (v0 != 0.0)
+        {
+          double cs, sn;
+          double zc = gsl_vector_get (z, c);
+
+          gsl_linalg_givens (gsl_matrix_get (R, c, 0), v0, &cs, &sn);
+
+          for (j = 0; j < k && c + j < n; j++)
+            {
+              double rj = gsl_matrix_get (R, c, j);
+              double vj = gsl_vector_get (v, j);
+
+              gsl_matrix_set (R, c, j, cs * rj - sn * vj);
+              gsl_vector_set (v, j, sn * rj + cs * vj);
+            }
+
+          gsl_vector_set (z, c, cs * zc - sn * b);
+          b = sn * zc + cs * b;
+        }
+
+      /* shift the window to columns [c + 1, c + k] */
+      for (j = 1; j < k; j++)
+        {
+          double vj = gsl_vector_get (v, j);
+          gsl_vector_set (v, j - 1, vj);
+          nonzero |= (vj != 0.0);
+        }
+
+      gsl_vector_set (v, k - 1, 0.0);
+
+      if (!nonzero)
+        break;
+    }
+
+  return b;
+} /* lsfit_fold_row() */
+
+/*
+gsl_bspline_lsfit_accumulate()
+  Add the observations (x_i, y_i) with weights wts_i to the least
+squares problem. This may be called repeatedly to process data which
+do not fit in memory.
+
+Inputs: x   - observation points, preferably in increasing order
+        y   - observed values
+        wts - weights, or NULL for unit weights
+        bw  - bspline workspace with initialized knots
+        w   - lsfit workspace
+
+Return: success or error
+*/
+
+int
+gsl_bspline_lsfit_accumulate (const gsl_vector * x, const gsl_vector * y,
+                              const gsl_vector * wts,
+                              gsl_bspline_workspace * bw,
+                              gsl_bspline_lsfit_workspace * w)
+{
+  if (bw->n != w->n || bw->k != w->k)
+    {
+      GSL_ERROR ("bspline workspace does not match lsfit workspace",
+                 GSL_EBADLEN);
+    }
+  else if (x->size != y->size)
+    {
+      GSL_ERROR ("vectors x and y have different lengths", GSL_EBADLEN);
+    }
+  else if (wts != NULL && wts->size != x->size)
+    {
+      GSL_ERROR ("vectors x and wts have different lengths", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t m = x->size;
+      size_t i0, i, j;
+
+      for (i0 = 0; i0 < m; i0 += LSFIT_BLOCK)
+        {
+          const size_t nb = GSL_MIN (LSFIT_BLOCK, m - i0);
+          gsl_vector_const_view xb = gsl_vector_const_subvector (x, i0, nb);
+          gsl_matrix_view Bk = gsl_matrix_submatrix (w->Bk, 0, 0, nb, w->k);
+          int status;
+
+          status = gsl_bspline_eval_nonzero_array (&xb.vector, &Bk.matrix,
+                                                   w->istart, bw);
+          if (status)
+            return status;
+
+          for (i = 0; i < nb; i++)
+            {
+              double sw = 1.0, b;
+
+              if (wts != NULL)
+                {
+                  double wi = gsl_vector_get (wts, i0 + i);
+
+                  if (wi < 0.0)
+                    {
+                      GSL_ERROR ("weights must be non-negative", GSL_EDOM);
+                    }
+
+                  sw = sqrt (wi);
+                }
+
+              for (j = 0; j < w->k; j++)
+                gsl_vector_set (w->row, j,
+                                sw * gsl_matrix_get (&Bk.matrix, i, j));
+
+              b = sw * gsl_vector_get (y, i0 + i);
+              b = lsfit_fold_row (w->R, w->z, w->istart[i], w->row, b);
+              w->rnorm2 += b * b;
+            }
+        }
+
+      w->nobs += m;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_bspline_lsfit_accumulate() */
+
+/*
+gsl_bspline_lsfit_solve()
+  Solve the (penalized) least squares problem
+
+    min ||W^{1/2} (y - X c)||^2 + lambda ||D_d c||^2
+
+for the observations accumulated so far
+
+Inputs: lambda - smoothing parameter, 0 for an ordinary least
+                 squares fit
+        d      - order of the difference penalty, d < k
+        c      - (output) spline coefficients, length n
+        chisq  - (output) weighted residual sum of squares
+                 ||W^{1/2} (y - X c)||^2, without the penalty
+        w      - lsfit workspace
+
+Return: success or error
+*/
+
+int
+gsl_bspline_lsfit_solve (const double lambda, const size_t d,
+                         gsl_vector * c, double *chisq,
+                         gsl_bspline_lsfit_workspace * w)
+{
+  const size_t n = w->n;
+  const size_t k = w->k;
+
+  if (c->size != n)
+    {
+      GSL_ERROR ("vector c not of length n", GSL_EBADLEN);
+    }
+  else if (lambda < 0.0)
+    {
+      GSL_ERROR ("lambda must be non-negative", GSL_EDOM);
+    }
+  else if (lambda > 0.0 && d >= k)
+    {
+      GSL_ERROR ("penalty order d must be less than k", GSL_EINVAL);
+    }
+  else
+    {
+      gsl_matrix *R = w->R;
+      gsl_vector *z = w->z;
+      size_t i, j;
+
+      if (lambda > 0.0 && n > d)
+        {
+          /* refactor [R; sqrt(lambda) D_d], taking row i of R and
+             then row i of the penalty for each column i in turn.
+             Folding the rows of the full band R into itself would
+             cascade rotations down to row n instead. The penalty
+             rows are the binomial coefficients (-1)^(d-j) C(d, j),
+             0 <= j <= d */
+          const double sl = sqrt (lambda);
+
+          R = w->work_R;
+          z = w->work_z;
+
+          gsl_matrix_set_zero (R);
+          gsl_vector_set_zero (z);
+
+          for (i = 0; i < n; i++)
+            {
+              gsl_vector_const_view ri = gsl_matrix_const_row (w->R, i);
+
+              gsl_vector_memcpy (w->row, &ri.vector);
+              lsfit_fold_row (R, z, i, w->row, gsl_vector_get (w->z, i));
+
+              if (i < n - d)
+                {
+                  double bc = 1.0;
+
+                  gsl_vector_set_zero (w->row);
+
+                  for (j = 0; j <= d; j++)
+                    {
+                      double sign = ((d - j) % 2) ? -1.0 : 1.0;
+                      gsl_vector_set (w->row, j, sign * sl * bc);
+                      bc = bc * (d - j) / (j + 1.0);
+                    }
+
+                  lsfit_fold_row (R, z, i, w->row, 0.0);
+                }
+            }
+        }
+
+      /* back-substitution R c = z */
+      for (i = n; i-- > 0;)
+        {
+          double rii = gsl_matrix_get (R, i, 0);
+          double sum = gsl_vector_get (z, i);
+
+          if (rii == 0.0)
+            {
+              GSL_ERROR ("matrix is singular, some coefficients have no data",
+                         GSL_ESING);
+            }
+
+          for (j = 1; j < k && i + j < n; j++)
+            sum -= gsl_matrix_get (R, i, j) * gsl_vector_get (c, i + j);
+
+          gsl_vector_set (c, i, sum / rii);
+        }
+
+      /* chisq = ||z - R c||^2 + rnorm2 with the unpenalized factor */
+      {
+        double r2 = w->rnorm2;
+
+        for (i = 0; i < n; i++)
+          {
+            double ri = gsl_vector_get (w->z, i);
+
+            for (j = 0; j < k && i + j < n; j++)
+              ri -= gsl_matrix_get (w->R, i, j) * gsl_vector_get (c, i + j);
+
+            r2 += ri * ri;
+          }
+
+        *chisq = r2;
+      }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_bspline_lsfit_solve() */
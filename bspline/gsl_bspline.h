@@ -56,6 +56,22 @@ typedef struct
     gsl_matrix *dB;     /* temporary derivative results */
 } gsl_bspline_workspace;
 
+typedef struct
+{
+    size_t n;         /* number of bspline coefficients */
+    size_t k;         /* spline order, bandwidth of R */
+    size_t nobs;      /* number of observations accumulated */
+    double rnorm2;    /* residual sum of squares outside range of R */
+
+    gsl_matrix *R;    /* n-by-k band of triangular factor, R(i,i+j) = R[i][j] */
+    gsl_vector *z;    /* transformed right hand side Q^T y */
+    gsl_matrix *work_R; /* penalized factor */
+    gsl_vector *work_z; /* penalized right hand side */
+    gsl_vector *row;  /* row being folded into R, length k */
+    gsl_matrix *Bk;   /* nonzero basis functions for a block of points */
+    size_t *istart;   /* first nonzero basis function for each point */
+} gsl_bspline_lsfit_workspace;
+
 #ifndef GSL_DISABLE_DEPRECATED
 
 typedef struct
@@ -103,6 +119,39 @@ gsl_bspline_eval_nonzero(const double x,
                          size_t *iend,
                          gsl_bspline_workspace *w);
 
+int
+gsl_bspline_eval_nonzero_array(const gsl_vector *x,
+                               gsl_matrix *Bk,
+                               size_t *istart,
+                               gsl_bspline_workspace *w);
+
+int
+gsl_bspline_calc_array(const gsl_vector *x,
+                       const gsl_vector *c,
+                       gsl_vector *y,
+                       gsl_bspline_workspace *w);
+
+gsl_bspline_lsfit_workspace *
+gsl_bspline_lsfit_alloc(const gsl_bspline_workspace *bw);
+
+void gsl_bspline_lsfit_free(gsl_bspline_lsfit_workspace *w);
+
+int gsl_bspline_lsfit_reset(gsl_bspline_lsfit_workspace *w);
+
+int
+gsl_bspline_lsfit_accumulate(const gsl_vector *x,
+                             const gsl_vector *y,
+                             const gsl_vector *wts,
+                             gsl_bspline_workspace *bw,
+                             gsl_bspline_lsfit_workspace *w);
+
+int
+gsl_bspline_lsfit_solve(const double lambda,
+                        const size_t d,
+                        gsl_vector *c,
+                        double *chisq,
+                        gsl_bspline_lsfit_workspace *w);
+
 int
 gsl_bspline_deriv_eval(const double x,
                        const size_t nderiv,
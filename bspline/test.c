@@ -19,9 +19,13 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <math.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_bspline.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_nan.h>
 
@@ -80,10 +84,215 @@ test_bspline(gsl_bspline_workspace * bw)
 
     }
 
+  /* Ensure array evaluation agrees with pointwise evaluation */
+  {
+    gsl_vector *x = gsl_vector_alloc(n);
+    gsl_vector *c = gsl_vector_alloc(ncoeffs);
+    gsl_vector *y = gsl_vector_alloc(n);
+    gsl_vector *Bk = gsl_vector_alloc(order);
+    gsl_matrix *Bx = gsl_matrix_alloc(n, order);
+    size_t *istart = malloc(n * sizeof(size_t));
+    int s = 0;
+
+    for (i = 0; i < n; i++)
+      gsl_vector_set(x, i, a + (b - a) * (i / (n - 1.0)));
+
+    for (j = 0; j < ncoeffs; j++)
+      gsl_vector_set(c, j, cos(1.0 + 3.0 * j));
+
+    gsl_bspline_eval_nonzero_array(x, Bx, istart, bw);
+    gsl_bspline_calc_array(x, c, y, bw);
+
+    for (i = 0; i < n; i++)
+      {
+        double xi = gsl_vector_get(x, i);
+        double sum = 0.0;
+        size_t i0, i1;
+
+        gsl_bspline_eval_nonzero(xi, Bk, &i0, &i1, bw);
+
+        s += (istart[i] != i0);
+
+        for (j = 0; j < order; j++)
+          s += (gsl_matrix_get(Bx, i, j) != gsl_vector_get(Bk, j));
+
+        gsl_bspline_eval(xi, B, bw);
+
+        for (j = 0; j < ncoeffs; j++)
+          sum += gsl_vector_get(c, j) * gsl_vector_get(B, j);
+
+        gsl_test_abs(gsl_vector_get(y, i), sum, order * 10.0 * GSL_DBL_EPSILON,
+                     "b-spline order %d de Boor evaluation for x=%g",
+                     order, xi);
+      }
+
+    gsl_test(s, "b-spline order %d nbreak %d eval_nonzero_array",
+             order, nbreak);
+
+    gsl_vector_free(x);
+    gsl_vector_free(c);
+    gsl_vector_free(y);
+    gsl_vector_free(Bk);
+    gsl_matrix_free(Bx);
+    free(istart);
+  }
+
   gsl_vector_free(B);
   gsl_matrix_free(dB);
 }
 
+/* Compare banded least squares fits against the dense normal
+   equations (X^T W X + lambda D^T D) c = X^T W y */
+void
+test_lsfit(const size_t order, const size_t nbreak, const double lambda,
+           const size_t d)
+{
+  const size_t m = 300;
+  const double a = -2.5, b = 7.25;
+  gsl_bspline_workspace *bw = gsl_bspline_alloc(order, nbreak);
+  const size_t ncoeffs = gsl_bspline_ncoeffs(bw);
+  gsl_bspline_lsfit_workspace *w1, *w2;
+  gsl_vector *x = gsl_vector_alloc(m);
+  gsl_vector *y = gsl_vector_alloc(m);
+  gsl_vector *wts = gsl_vector_alloc(m);
+  gsl_vector *B = gsl_vector_alloc(ncoeffs);
+  gsl_vector *c1 = gsl_vector_alloc(ncoeffs);
+  gsl_vector *c2 = gsl_vector_alloc(ncoeffs);
+  gsl_vector *c = gsl_vector_calloc(ncoeffs);
+  gsl_matrix *A = gsl_matrix_calloc(ncoeffs, ncoeffs);
+  double chisq1, chisq2, chisq = 0.0;
+  size_t i, j, l;
+
+  gsl_bspline_knots_uniform(a, b, bw);
+  w1 = gsl_bspline_lsfit_alloc(bw);
+  w2 = gsl_bspline_lsfit_alloc(bw);
+
+  for (i = 0; i < m; i++)
+    {
+      double xi = a + (b - a) * (i / (m - 1.0));
+      gsl_vector_set(x, i, xi);
+      gsl_vector_set(y, i, sin(xi) + 0.1 * cos(7.0 * i));
+      gsl_vector_set(wts, i, 1.0 + 0.5 * sin(3.0 * i));
+    }
+
+  /* sorted data in two parts */
+  {
+    gsl_vector_view x1 = gsl_vector_subvector(x, 0, m / 3);
+    gsl_vector_view y1 = gsl_vector_subvector(y, 0, m / 3);
+    gsl_vector_view wt1 = gsl_vector_subvector(wts, 0, m / 3);
+    gsl_vector_view x2 = gsl_vector_subvector(x, m / 3, m - m / 3);
+    gsl_vector_view y2 = gsl_vector_subvector(y, m / 3, m - m / 3);
+    gsl_vector_view wt2 = gsl_vector_subvector(wts, m / 3, m - m / 3);
+
+    gsl_bspline_lsfit_accumulate(&x1.vector, &y1.vector, &wt1.vector, bw, w1);
+    gsl_bspline_lsfit_accumulate(&x2.vector, &y2.vector, &wt2.vector, bw, w1);
+    gsl_bspline_lsfit_solve(lambda, d, c1, &chisq1, w1);
+  }
+
+  /* the same data in decreasing order */
+  {
+    gsl_vector *xr = gsl_vector_alloc(m);
+    gsl_vector *yr = gsl_vector_alloc(m);
+    gsl_vector *wr = gsl_vector_alloc(m);
+
+    gsl_vector_memcpy(xr, x);
+    gsl_vector_memcpy(yr, y);
+    gsl_vector_memcpy(wr, wts);
+    gsl_vector_reverse(xr);
+    gsl_vector_reverse(yr);
+    gsl_vector_reverse(wr);
+
+    gsl_bspline_lsfit_accumulate(xr, yr, wr, bw, w2);
+    gsl_bspline_lsfit_solve(lambda, d, c2, &chisq2, w2);
+
+    gsl_vector_free(xr);
+    gsl_vector_free(yr);
+    gsl_vector_free(wr);
+  }
+
+  /* dense normal equations */
+  for (l = 0; l < m; l++)
+    {
+      double wl = gsl_vector_get(wts, l), yl = gsl_vector_get(y, l);
+
+      gsl_bspline_eval(gsl_vector_get(x, l), B, bw);
+
+      for (i = 0; i < ncoeffs; i++)
+        {
+          double Bi = gsl_vector_get(B, i);
+
+          *gsl_vector_ptr(c, i) += wl * Bi * yl;
+
+          for (j = 0; j < ncoeffs; j++)
+            *gsl_matrix_ptr(A, i, j) += wl * Bi * gsl_vector_get(B, j);
+        }
+    }
+
+  if (lambda > 0.0)
+    {
+      /* add lambda D^T D for difference order d = 1, 2 */
+      for (l = 0; l + d < ncoeffs; l++)
+        {
+          double dl[3];
+
+          if (d == 1)
+            {
+              dl[0] = -1.0; dl[1] = 1.0;
+            }
+          else
+            {
+              dl[0] = 1.0; dl[1] = -2.0; dl[2] = 1.0;
+            }
+
+          for (i = 0; i <= d; i++)
+            for (j = 0; j <= d; j++)
+              *gsl_matrix_ptr(A, l + i, l + j) += lambda * dl[i] * dl[j];
+        }
+    }
+
+  gsl_linalg_cholesky_decomp(A);
+  gsl_linalg_cholesky_svx(A, c);
+
+  for (l = 0; l < m; l++)
+    {
+      double r;
+
+      gsl_bspline_eval(gsl_vector_get(x, l), B, bw);
+      gsl_blas_ddot(B, c, &r);
+      r = gsl_vector_get(y, l) - r;
+      chisq += gsl_vector_get(wts, l) * r * r;
+    }
+
+  for (i = 0; i < ncoeffs; i++)
+    {
+      gsl_test_abs(gsl_vector_get(c1, i), gsl_vector_get(c, i), 1.0e-10,
+                   "b-spline lsfit order %d nbreak %d lambda %g coefficient %d",
+                   order, nbreak, lambda, i);
+      gsl_test_abs(gsl_vector_get(c2, i), gsl_vector_get(c, i), 1.0e-10,
+                   "b-spline lsfit unsorted order %d nbreak %d lambda %g coefficient %d",
+                   order, nbreak, lambda, i);
+    }
+
+  gsl_test_rel(chisq1, chisq, 1.0e-10,
+               "b-spline lsfit order %d nbreak %d lambda %g chisq",
+               order, nbreak, lambda);
+  gsl_test_rel(chisq2, chisq, 1.0e-10,
+               "b-spline lsfit unsorted order %d nbreak %d lambda %g chisq",
+               order, nbreak, lambda);
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(wts);
+  gsl_vector_free(B);
+  gsl_vector_free(c1);
+  gsl_vector_free(c2);
+  gsl_vector_free(c);
+  gsl_matrix_free(A);
+  gsl_bspline_lsfit_free(w1);
+  gsl_bspline_lsfit_free(w2);
+  gsl_bspline_free(bw);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -514,5 +723,11 @@ main(int argc, char **argv)
     gsl_bspline_free(w);
   }
 
+  test_lsfit(1, 10, 0.0, 0);
+  test_lsfit(2, 17, 0.0, 0);
+  test_lsfit(4, 25, 0.0, 0);
+  test_lsfit(4, 25, 0.5, 2);
+  test_lsfit(3, 60, 2.0, 1);
+
   exit(gsl_test_summary());
 }
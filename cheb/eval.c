@@ -204,3 +204,102 @@ gsl_cheb_eval_mode (const gsl_cheb_series * cs,
 }
 
 
+
+/* The array functions run the Clenshaw recurrences for a block of
+   CHEB_BLOCK points together, with the loop over the points innermost
+   so that it can be vectorized.  The operations for each point are the
+   same as in gsl_cheb_eval. */
+
+#define CHEB_BLOCK 8
+
+int
+gsl_cheb_eval_array (const gsl_cheb_series * cs, const double x[],
+                     double result[], const size_t n)
+{
+  size_t i, p, p0;
+
+  for (p0 = 0; p0 < n; p0 += CHEB_BLOCK)
+    {
+      const size_t nb = GSL_MIN (CHEB_BLOCK, n - p0);
+      double y[CHEB_BLOCK], y2[CHEB_BLOCK];
+      double d1[CHEB_BLOCK], d2[CHEB_BLOCK];
+
+      for (p = 0; p < nb; p++)
+        {
+          y[p] = (2.0 * x[p0 + p] - cs->a - cs->b) / (cs->b - cs->a);
+          y2[p] = 2.0 * y[p];
+          d1[p] = 0.0;
+          d2[p] = 0.0;
+        }
+
+      for (i = cs->order; i >= 1; i--)
+        {
+          const double ci = cs->c[i];
+
+          for (p = 0; p < nb; p++)
+            {
+              double temp = d1[p];
+              d1[p] = y2[p] * d1[p] - d2[p] + ci;
+              d2[p] = temp;
+            }
+        }
+
+      for (p = 0; p < nb; p++)
+        result[p0 + p] = y[p] * d1[p] - d2[p] + 0.5 * cs->c[0];
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* The derivative is found by differentiating the Clenshaw recurrence
+   b_i = 2 y b_{i+1} - b_{i+2} + c_i with respect to y, which gives
+   b'_i = 2 b_{i+1} + 2 y b'_{i+1} - b'_{i+2}, alongside it. */
+
+int
+gsl_cheb_eval_deriv_array (const gsl_cheb_series * cs, const double x[],
+                           double result[], double deriv[], const size_t n)
+{
+  const double scale = 2.0 / (cs->b - cs->a);
+  size_t i, p, p0;
+
+  for (p0 = 0; p0 < n; p0 += CHEB_BLOCK)
+    {
+      const size_t nb = GSL_MIN (CHEB_BLOCK, n - p0);
+      double y[CHEB_BLOCK], y2[CHEB_BLOCK];
+      double d1[CHEB_BLOCK], d2[CHEB_BLOCK];
+      double e1[CHEB_BLOCK], e2[CHEB_BLOCK];
+
+      for (p = 0; p < nb; p++)
+        {
+          y[p] = (2.0 * x[p0 + p] - cs->a - cs->b) / (cs->b - cs->a);
+          y2[p] = 2.0 * y[p];
+          d1[p] = 0.0;
+          d2[p] = 0.0;
+          e1[p] = 0.0;
+          e2[p] = 0.0;
+        }
+
+      for (i = cs->order; i >= 1; i--)
+        {
+          const double ci = cs->c[i];
+
+          for (p = 0; p < nb; p++)
+            {
+              double temp = d1[p];
+              double tempe = e1[p];
+              e1[p] = 2.0 * d1[p] + y2[p] * e1[p] - e2[p];
+              d1[p] = y2[p] * d1[p] - d2[p] + ci;
+              d2[p] = temp;
+              e2[p] = tempe;
+            }
+        }
+
+      for (p = 0; p < nb; p++)
+        {
+          result[p0 + p] = y[p] * d1[p] - d2[p] + 0.5 * cs->c[0];
+          deriv[p0 + p] = (d1[p] + y[p] * e1[p] - e2[p]) * scale;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
@@ -113,6 +113,15 @@ double gsl_cheb_eval_mode(const gsl_cheb_series * cs, const double x, gsl_mode_t
 int gsl_cheb_eval_mode_e(const gsl_cheb_series * cs, const double x, gsl_mode_t mode, double * result, double * abserr);
 
 
+/* Evaluate a Chebyshev series at the n points x[0] ... x[n-1],
+ * and optionally its derivative with respect to x.
+ */
+int gsl_cheb_eval_array(const gsl_cheb_series * cs, const double x[],
+                        double result[], const size_t n);
+int gsl_cheb_eval_deriv_array(const gsl_cheb_series * cs, const double x[],
+                              double result[], double deriv[],
+                              const size_t n);
+
 
 /* Compute the derivative of a Chebyshev series.
  */
@@ -128,6 +137,49 @@ int gsl_cheb_calc_integ(gsl_cheb_series * integ, const gsl_cheb_series * cs);
 
 
 
+/* Piecewise Chebyshev approximation of a function over an interval,
+ * with the interval bisected adaptively until the given accuracy is
+ * reached on each piece.
+ */
+typedef struct
+{
+  double a;          /* lower interval point                      */
+  double b;          /* upper interval point                      */
+  size_t order;      /* order of the series on each piece         */
+  size_t npieces;    /* number of pieces                          */
+  size_t max_pieces; /* maximum number of pieces                  */
+  double * breaks;   /* piece i is [breaks[i], breaks[i+1]]       */
+  double * c;        /* coefficients of piece i at c[i*(order+1)] */
+  size_t nlookup;    /* number of cells in lookup table           */
+  double scale;      /* nlookup / (b - a)                         */
+  size_t * lookup;   /* first piece overlapping each cell         */
+  double * stack;    /* intervals pending subdivision             */
+  gsl_cheb_series * cs; /* series for computing each piece        */
+} gsl_cheb_piecewise;
+
+gsl_cheb_piecewise * gsl_cheb_piecewise_alloc(const size_t order,
+                                              const size_t max_pieces);
+void gsl_cheb_piecewise_free(gsl_cheb_piecewise * p);
+
+int gsl_cheb_piecewise_init(gsl_cheb_piecewise * p, const gsl_function * f,
+                            const double a, const double b,
+                            const double epsabs, const double epsrel);
+
+size_t gsl_cheb_piecewise_npieces(const gsl_cheb_piecewise * p);
+
+double gsl_cheb_piecewise_eval(const gsl_cheb_piecewise * p, const double x);
+int gsl_cheb_piecewise_eval_deriv_e(const gsl_cheb_piecewise * p,
+                                    const double x, double * result,
+                                    double * deriv);
+
+/* Set up F or FDF to evaluate the approximation p, which must remain
+ * allocated while they are in use.
+ */
+void gsl_cheb_piecewise_function(const gsl_cheb_piecewise * p,
+                                 gsl_function * F);
+void gsl_cheb_piecewise_function_fdf(const gsl_cheb_piecewise * p,
+                                     gsl_function_fdf * FDF);
+
 __END_DECLS
 
 #endif /* __GSL_CHEBYSHEV_H__ */
@@ -23,6 +23,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_chebyshev.h>
+#include <gsl/gsl_fft_real.h>
 
 /*-*-*-*-*-*-*-*-*-*-*-* Allocators *-*-*-*-*-*-*-*-*-*-*-*/
 
@@ -64,6 +65,86 @@ void gsl_cheb_free(gsl_cheb_series * cs)
 
 /*-*-*-*-*-*-*-*-*-*-*-* Initializer *-*-*-*-*-*-*-*-*-*-*-*/
 
+/* Series with fewer terms than this use the direct O(n^2) sum for
+ * the coefficients, larger ones an O(n log n) discrete cosine
+ * transform computed with a real FFT.
+ */
+#define CHEB_DCT_MIN 64
+
+/* c_j = fac sum_k f_k cos(pi j (k+1/2)/n), a DCT-II of the f_k.
+ * Following Makhoul, the f_k are reordered as v = (f_0, f_2, ...,
+ * f_3, f_1), so that c_j = fac Re[exp(-i pi j/(2n)) V_j] where V is
+ * the discrete Fourier transform of v.
+ */
+static int
+cheb_dct(const size_t n, const double * f, double * c, const double fac)
+{
+  gsl_fft_real_wavetable * wavetable;
+  gsl_fft_real_workspace * workspace;
+  double * v;
+  size_t j, k;
+  int status;
+
+  v = (double *) malloc(n * sizeof(double));
+
+  if(v == 0) {
+    GSL_ERROR("failed to allocate dct array", GSL_ENOMEM);
+  }
+
+  wavetable = gsl_fft_real_wavetable_alloc(n);
+  workspace = gsl_fft_real_workspace_alloc(n);
+
+  if(wavetable == 0 || workspace == 0) {
+    gsl_fft_real_wavetable_free(wavetable);
+    gsl_fft_real_workspace_free(workspace);
+    free(v);
+    GSL_ERROR("failed to allocate fft workspace", GSL_ENOMEM);
+  }
+
+  for(k = 0; 2*k < n; k++) {
+    v[k] = f[2*k];
+  }
+
+  for(k = 0; 2*k+1 < n; k++) {
+    v[n-1-k] = f[2*k+1];
+  }
+
+  status = gsl_fft_real_transform(v, 1, n, wavetable, workspace);
+
+  if(status == GSL_SUCCESS) {
+    /* unpack V_j from the halfcomplex result, V_{n-j} = conj(V_j) */
+    for(j = 0; j < n; j++) {
+      double re, im;
+      double theta = M_PI * j / (2.0 * n);
+
+      if(j == 0) {
+        re = v[0];
+        im = 0.0;
+      }
+      else if(2*j < n) {
+        re = v[2*j-1];
+        im = v[2*j];
+      }
+      else if(2*j == n) {
+        re = v[n-1];
+        im = 0.0;
+      }
+      else {
+        re = v[2*(n-j)-1];
+        im = -v[2*(n-j)];
+      }
+
+      c[j] = fac * (re * cos(theta) + im * sin(theta));
+    }
+  }
+
+  gsl_fft_real_wavetable_free(wavetable);
+  gsl_fft_real_workspace_free(workspace);
+  free(v);
+
+  return status;
+}
+
 int gsl_cheb_init(gsl_cheb_series * cs, const gsl_function *func,
                   const double a, const double b)
 {
@@ -85,6 +166,10 @@ int gsl_cheb_init(gsl_cheb_series * cs, const gsl_function *func,
       double y = cos(M_PI * (k+0.5)/(cs->order+1));
       cs->f[k] = GSL_FN_EVAL(func, (y*bma + bpa));
     }
+
+    if(cs->order + 1 >= CHEB_DCT_MIN) {
+      return cheb_dct(cs->order + 1, cs->f, cs->c, fac);
+    }
     
     for(j = 0; j<=cs->order; j++) {
       double sum = 0.0;
@@ -0,0 +1,345 @@
+/* cheb/piecewise.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_nan.h>
+#include <gsl/gsl_chebyshev.h>
+
+/* A piecewise Chebyshev approximation is built by bisecting [a,b]
+   until the series of the given order on each piece has a tail
+   |c[order-1]| + |c[order]| within the requested tolerance.  The
+   coefficients of all the pieces are stored one after another in a
+   single array, and a uniform grid over [a,b] maps each cell to the
+   first piece which overlaps it.  A point is then located by a binary
+   search over the pieces overlapping its cell, which takes constant
+   time for evenly sized pieces and O(log npieces) time when many
+   small pieces are clustered in one cell. */
+
+/* number of lookup cells per piece */
+#define PIECEWISE_LOOKUP 4
+
+gsl_cheb_piecewise *
+gsl_cheb_piecewise_alloc (const size_t order, const size_t max_pieces)
+{
+  gsl_cheb_piecewise *p;
+
+  if (order < 2)
+    {
+      GSL_ERROR_VAL ("order must be at least 2", GSL_EINVAL, 0);
+    }
+
+  if (max_pieces == 0)
+    {
+      GSL_ERROR_VAL ("max_pieces must be positive", GSL_EINVAL, 0);
+    }
+
+  p = (gsl_cheb_piecewise *) calloc (1, sizeof (gsl_cheb_piecewise));
+
+  if (p == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate piecewise struct", GSL_ENOMEM, 0);
+    }
+
+  p->order = order;
+  p->max_pieces = max_pieces;
+  p->npieces = 0;
+  p->nlookup = 0;
+
+  p->breaks = (double *) malloc ((max_pieces + 1) * sizeof (double));
+  p->c = (double *) malloc (max_pieces * (order + 1) * sizeof (double));
+  p->lookup = (size_t *) malloc (PIECEWISE_LOOKUP * max_pieces * sizeof (size_t));
+  p->stack = (double *) malloc (2 * max_pieces * sizeof (double));
+  p->cs = gsl_cheb_alloc (order);
+
+  if (p->breaks == 0 || p->c == 0 || p->lookup == 0 || p->stack == 0
+      || p->cs == 0)
+    {
+      gsl_cheb_piecewise_free (p);
+      GSL_ERROR_VAL ("failed to allocate piecewise tables", GSL_ENOMEM, 0);
+    }
+
+  return p;
+}
+
+void
+gsl_cheb_piecewise_free (gsl_cheb_piecewise * p)
+{
+  RETURN_IF_NULL (p);
+  free (p->breaks);
+  free (p->c);
+  free (p->lookup);
+  free (p->stack);
+  gsl_cheb_free (p->cs);
+  free (p);
+}
+
+int
+gsl_cheb_piecewise_init (gsl_cheb_piecewise * p, const gsl_function * f,
+                         const double a, const double b,
+                         const double epsabs, const double epsrel)
+{
+  const size_t order = p->order;
+  size_t nstack = 0;
+  int status = GSL_SUCCESS;
+
+  if (a >= b)
+    {
+      GSL_ERROR ("null function interval [a,b]", GSL_EDOM);
+    }
+
+  if (epsabs <= 0 && epsrel < 50 * GSL_DBL_EPSILON)
+    {
+      GSL_ERROR ("tolerance cannot be achieved with given epsabs and epsrel",
+                 GSL_EBADTOL);
+    }
+
+  p->a = a;
+  p->b = b;
+  p->npieces = 0;
+
+  /* intervals waiting to be approximated, the leftmost on top */
+  p->stack[0] = a;
+  p->stack[1] = b;
+  nstack = 1;
+
+  while (nstack > 0)
+    {
+      const double lo = p->stack[2 * (nstack - 1)];
+      const double hi = p->stack[2 * (nstack - 1) + 1];
+      const double mid = 0.5 * (lo + hi);
+      double tail, fmax = 0.0;
+      size_t k;
+
+      nstack--;
+
+      gsl_cheb_init (p->cs, f, lo, hi);
+
+      for (k = 0; k <= order; k++)
+        fmax = GSL_MAX_DBL (fmax, fabs (p->cs->f[k]));
+
+      tail = fabs (p->cs->c[order - 1]) + fabs (p->cs->c[order]);
+
+      if (tail > GSL_MAX_DBL (epsabs, epsrel * fmax))
+        {
+          const int room = (p->npieces + nstack + 2 <= p->max_pieces);
+          const int width = (mid > lo && mid < hi);
+
+          if (room && width)
+            {
+              /* push the right half first so the left is done next */
+              p->stack[2 * nstack] = mid;
+              p->stack[2 * nstack + 1] = hi;
+              p->stack[2 * nstack + 2] = lo;
+              p->stack[2 * nstack + 3] = mid;
+              nstack += 2;
+              continue;
+            }
+
+          status = GSL_ETOL;
+        }
+
+      p->breaks[p->npieces] = lo;
+
+      for (k = 0; k <= order; k++)
+        p->c[p->npieces * (order + 1) + k] = p->cs->c[k];
+
+      p->npieces++;
+    }
+
+  p->breaks[p->npieces] = b;
+
+  /* lookup[j] is the piece containing the left edge of cell j */
+  {
+    size_t i = 0, j;
+
+    p->nlookup = PIECEWISE_LOOKUP * p->npieces;
+    p->scale = p->nlookup / (b - a);
+
+    for (j = 0; j < p->nlookup; j++)
+      {
+        const double e = a + j / p->scale;
+
+        while (i + 1 < p->npieces && p->breaks[i + 1] <= e)
+          i++;
+
+        p->lookup[j] = i;
+      }
+  }
+
+  if (status)
+    {
+      GSL_ERROR ("maximum number of pieces reached, tolerance not achieved",
+                 status);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* return the index of the piece containing x, a <= x <= b */
+static size_t
+piecewise_find (const gsl_cheb_piecewise * p, const double x)
+{
+  size_t j = (size_t) ((x - p->a) * p->scale);
+  size_t i, hi;
+
+  if (j >= p->nlookup)
+    j = p->nlookup - 1;
+
+  /* the pieces overlapping cell j are lookup[j] .. lookup[j+1] */
+
+  i = p->lookup[j];
+  hi = (j + 1 < p->nlookup) ? p->lookup[j + 1] : p->npieces - 1;
+
+  while (i < hi)
+    {
+      const size_t mid = (i + hi + 1) / 2;
+
+      if (x >= p->breaks[mid])
+        i = mid;
+      else
+        hi = mid - 1;
+    }
+
+  /* correct for rounding in the cell index */
+
+  while (i + 1 < p->npieces && x >= p->breaks[i + 1])
+    i++;
+
+  while (i > 0 && x < p->breaks[i])
+    i--;
+
+  return i;
+}
+
+int
+gsl_cheb_piecewise_eval_deriv_e (const gsl_cheb_piecewise * p,
+                                 const double x, double *result,
+                                 double *deriv)
+{
+  if (!(x >= p->a && x <= p->b))
+    {
+      *result = GSL_NAN;
+      *deriv = GSL_NAN;
+      GSL_ERROR ("x outside interval of approximation", GSL_EDOM);
+    }
+  else
+    {
+      const size_t i = piecewise_find (p, x);
+      const double *c = p->c + i * (p->order + 1);
+      const double lo = p->breaks[i], hi = p->breaks[i + 1];
+      const double y = (2.0 * x - lo - hi) / (hi - lo);
+      const double y2 = 2.0 * y;
+      double d1 = 0.0, d2 = 0.0, e1 = 0.0, e2 = 0.0;
+      size_t k;
+
+      for (k = p->order; k >= 1; k--)
+        {
+          double temp = d1;
+          double tempe = e1;
+          e1 = 2.0 * d1 + y2 * e1 - e2;
+          d1 = y2 * d1 - d2 + c[k];
+          d2 = temp;
+          e2 = tempe;
+        }
+
+      *result = y * d1 - d2 + 0.5 * c[0];
+      *deriv = (d1 + y * e1 - e2) * 2.0 / (hi - lo);
+
+      return GSL_SUCCESS;
+    }
+}
+
+double
+gsl_cheb_piecewise_eval (const gsl_cheb_piecewise * p, const double x)
+{
+  if (!(x >= p->a && x <= p->b))
+    {
+      GSL_ERROR_VAL ("x outside interval of approximation", GSL_EDOM,
+                     GSL_NAN);
+    }
+  else
+    {
+      const size_t i = piecewise_find (p, x);
+      const double *c = p->c + i * (p->order + 1);
+      const double lo = p->breaks[i], hi = p->breaks[i + 1];
+      const double y = (2.0 * x - lo - hi) / (hi - lo);
+      const double y2 = 2.0 * y;
+      double d1 = 0.0, d2 = 0.0;
+      size_t k;
+
+      for (k = p->order; k >= 1; k--)
+        {
+          double temp = d1;
+          d1 = y2 * d1 - d2 + c[k];
+          d2 = temp;
+        }
+
+      return y * d1 - d2 + 0.5 * c[0];
+    }
+}
+
+size_t
+gsl_cheb_piecewise_npieces (const gsl_cheb_piecewise * p)
+{
+  return p->npieces;
+}
+
+/* Adaptors for use as a gsl_function or gsl_function_fdf */
+
+static double
+piecewise_f (double x, void *params)
+{
+  return gsl_cheb_piecewise_eval ((const gsl_cheb_piecewise *) params, x);
+}
+
+static double
+piecewise_df (double x, void *params)
+{
+  double f, df;
+  gsl_cheb_piecewise_eval_deriv_e ((const gsl_cheb_piecewise *) params, x,
+                                   &f, &df);
+  return df;
+}
+
+static void
+piecewise_fdf (double x, void *params, double *f, double *df)
+{
+  gsl_cheb_piecewise_eval_deriv_e ((const gsl_cheb_piecewise *) params, x,
+                                   f, df);
+}
+
+void
+gsl_cheb_piecewise_function (const gsl_cheb_piecewise * p, gsl_function * F)
+{
+  F->function = &piecewise_f;
+  F->params = (void *) p;
+}
+
+void
+gsl_cheb_piecewise_function_fdf (const gsl_cheb_piecewise * p,
+                                 gsl_function_fdf * FDF)
+{
+  FDF->f = &piecewise_f;
+  FDF->df = &piecewise_df;
+  FDF->fdf = &piecewise_fdf;
+  FDF->params = (void *) p;
+}
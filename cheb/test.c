@@ -108,6 +108,158 @@ test_dim (const size_t n, const double a, const double b,
   gsl_cheb_free(cs);
 }
 
+/* Test the FFT-based computation of the coefficients for larger
+   orders against the direct sum, and the array evaluation functions */
+
+void
+test_large (const size_t order, gsl_function * F)
+{
+  const double a = -2.0, b = 3.5;
+  const size_t npts = 37;
+  double x[37], r[37], dr[37];
+  gsl_cheb_series * cs = gsl_cheb_alloc(order);
+  gsl_cheb_series * csd = gsl_cheb_alloc(order);
+  size_t j, k;
+
+  gsl_cheb_init(cs, F, a, b);
+
+  for (j = 0; j <= order; j++) {
+    double sum = 0.0;
+    for (k = 0; k <= order; k++)
+      sum += cs->f[k] * cos(M_PI * j * (k + 0.5) / (order + 1));
+    sum *= 2.0 / (order + 1.0);
+    gsl_test_abs(cs->c[j], sum, 1e-14, "order %d c[%d] by dct", order, j);
+  }
+
+  gsl_cheb_calc_deriv(csd, cs);
+
+  for (k = 0; k < npts; k++)
+    x[k] = a + (b - a) * k / (npts - 1.0);
+
+  gsl_cheb_eval_array(cs, x, r, npts);
+
+  for (k = 0; k < npts; k++)
+    gsl_test(r[k] != gsl_cheb_eval(cs, x[k]),
+             "order %d gsl_cheb_eval_array(%.3g)", order, x[k]);
+
+  gsl_cheb_eval_deriv_array(cs, x, r, dr, npts);
+
+  for (k = 0; k < npts; k++) {
+    gsl_test_abs(r[k], gsl_cheb_eval(cs, x[k]), 1e-14,
+                 "order %d gsl_cheb_eval_deriv_array(%.3g)", order, x[k]);
+    gsl_test_abs(dr[k], gsl_cheb_eval(csd, x[k]), 1e-12,
+                 "order %d gsl_cheb_eval_deriv_array, deriv(%.3g)", order, x[k]);
+  }
+
+  gsl_cheb_free(csd);
+  gsl_cheb_free(cs);
+}
+
+double f_osc (double x, void * p) {
+  p = 0;
+  return exp(x) * sin(5.0 * x * x);
+}
+
+double df_osc (double x, void * p) {
+  p = 0;
+  return exp(x) * (sin(5.0 * x * x) + 10.0 * x * cos(5.0 * x * x));
+}
+
+void
+test_piecewise (void)
+{
+  const double a = 0.0, b = 3.0;
+  gsl_function F, G;
+  gsl_function_fdf FDF;
+  gsl_cheb_piecewise * p = gsl_cheb_piecewise_alloc(16, 256);
+  double x;
+  int status;
+
+  F.function = f_osc;
+  F.params = 0;
+
+  status = gsl_cheb_piecewise_init(p, &F, a, b, 1e-12, 0.0);
+
+  gsl_test(status, "gsl_cheb_piecewise_init status");
+  gsl_test(gsl_cheb_piecewise_npieces(p) < 2,
+           "gsl_cheb_piecewise_init subdivides, npieces = %d",
+           gsl_cheb_piecewise_npieces(p));
+
+  gsl_cheb_piecewise_function(p, &G);
+  gsl_cheb_piecewise_function_fdf(p, &FDF);
+
+  for (x = a; x <= b; x += (b - a) / 997.0) {
+    double r, dr;
+    gsl_cheb_piecewise_eval_deriv_e(p, x, &r, &dr);
+    gsl_test_abs(GSL_FN_EVAL(&G, x), f_osc(x, 0), 1e-11,
+                 "gsl_cheb_piecewise_eval(%.3g)", x);
+    gsl_test_abs(r, f_osc(x, 0), 1e-11,
+                 "gsl_cheb_piecewise_eval_deriv_e(%.3g)", x);
+    gsl_test_rel(dr, GSL_FN_FDF_EVAL_DF(&FDF, x), 1e-15,
+                 "gsl_cheb_piecewise_function_fdf(%.3g)", x);
+    gsl_test_abs(dr, df_osc(x, 0), 1e-8,
+                 "gsl_cheb_piecewise_eval_deriv_e, deriv(%.3g)", x);
+  }
+
+  {
+    double r = gsl_cheb_piecewise_eval(p, b);
+    gsl_test_abs(r, f_osc(b, 0), 1e-11, "gsl_cheb_piecewise_eval(b)");
+  }
+
+  gsl_cheb_piecewise_free(p);
+}
+
+double f_cusp (double x, void * p) {
+  p = 0;
+  return sqrt(x + 1e-9);
+}
+
+/* adaptive subdivision clusters the pieces near the cusp at x = 0,
+   so that many of them share one lookup cell */
+
+void
+test_piecewise_clustered (void)
+{
+  const double a = 0.0, b = 1.0;
+  gsl_function F;
+  gsl_cheb_piecewise * p = gsl_cheb_piecewise_alloc(16, 256);
+  size_t i, ncell = 0;
+  int status, k;
+
+  F.function = f_cusp;
+  F.params = 0;
+
+  status = gsl_cheb_piecewise_init(p, &F, a, b, 1e-10, 0.0);
+
+  gsl_test(status, "gsl_cheb_piecewise_init clustered status");
+
+  for (i = 1; i < p->npieces; i++) {
+    if (p->breaks[i] < a + (b - a) / p->nlookup)
+      ncell++;
+  }
+
+  gsl_test(ncell < 8,
+           "gsl_cheb_piecewise_init clustered, %d pieces in first cell",
+           (int) ncell);
+
+  for (i = 0; i < p->npieces; i++) {
+    const double x0 = p->breaks[i], x1 = p->breaks[i + 1];
+    const double xm = 0.5 * (x0 + x1);
+    gsl_test_abs(gsl_cheb_piecewise_eval(p, x0), f_cusp(x0, 0), 1e-10,
+                 "gsl_cheb_piecewise_eval clustered, break %d", (int) i);
+    gsl_test_abs(gsl_cheb_piecewise_eval(p, xm), f_cusp(xm, 0), 1e-10,
+                 "gsl_cheb_piecewise_eval clustered, piece %d", (int) i);
+  }
+
+  for (k = 0; k < 60; k++) {
+    const double x = ldexp(1.0, -k);
+    gsl_test_abs(gsl_cheb_piecewise_eval(p, x), f_cusp(x, 0), 1e-10,
+                 "gsl_cheb_piecewise_eval clustered(2^-%d)", k);
+  }
+
+  gsl_cheb_piecewise_free(p);
+}
+
 int 
 main(void)
 {
@@ -293,5 +445,13 @@ main(void)
   test_dim (2, -5.0, 5.0, &F_P, &F_DP, &F_IP2);
   test_dim (1, -5.0, 5.0, &F_P, &F_DP, &F_IP1);
 
+  /* Test orders using the dct */
+  test_large (99, &F_sin);
+  test_large (100, &F_sin);
+  test_large (127, &F_sin);
+
+  test_piecewise ();
+  test_piecewise_clustered ();
+
   exit (gsl_test_summary());
 }
@@ -27,6 +27,9 @@
 #include <gsl/gsl_sf_bessel.h>
 #include <gsl/gsl_dht.h>
 
+/* number of vectors transformed together by gsl_dht_apply_multi */
+#define DHT_BLOCK 8
+
 
 gsl_dht *
 gsl_dht_alloc (size_t size)
@@ -188,40 +191,69 @@ void gsl_dht_free(gsl_dht * t)
 }
 
 
+/* Accumulate the transforms of the nvec vectors f_in[k*size + i] into
+ * f_out[k*size + m], without the overall factor 2 r^2.  The symmetric
+ * matrix Jjj is stored as a packed lower triangle, so row n holds the
+ * elements (n,0) ... (n,n) contiguously.  Each element contributes to
+ * both f_out[n] and f_out[m]; running over the rows of the triangle
+ * once for a block of vectors keeps a row of Jjj in cache while it is
+ * applied to all of them.
+ */
+static void
+dht_apply_block(const gsl_dht * t, size_t nvec, const double * f_in,
+                double * f_out)
+{
+  const size_t size = t->size;
+  size_t n, m, k;
+
+  for(n=0; n<size; n++) {
+    const double * Jn = t->Jjj + n*(n+1)/2;
+
+    for(k=0; k<nvec; k++) {
+      const double * fk = f_in  + k*size;
+      double * gk       = f_out + k*size;
+      const double an   = fk[n] / t->J2[n+1];
+      double sum = 0.0;
+
+      for(m=0; m<n; m++) {
+        sum   += Jn[m] * (fk[m] / t->J2[m+1]);
+        gk[m] += Jn[m] * an;
+      }
+
+      gk[n] += sum + Jn[n] * an;
+    }
+  }
+}
+
+
 int
 gsl_dht_apply(const gsl_dht * t, double * f_in, double * f_out)
+{
+  return gsl_dht_apply_multi(t, 1, f_in, f_out);
+}
+
+
+int
+gsl_dht_apply_multi(const gsl_dht * t, size_t nvec,
+                    const double * f_in, double * f_out)
 {
   const double jN = t->j[t->size + 1];
   const double r  = t->xmax / jN;
-  size_t m;
-  size_t i;
-
-  for(m=0; m<t->size; m++) {
-    double sum = 0.0;
-    double Y;
-    for(i=0; i<t->size; i++) {
-      /* Need to find max and min so that we
-       * address the symmetric Jjj matrix properly.
-       * FIXME: we can presumably optimize this
-       * by just running over the elements of Jjj
-       * in a deterministic manner.
-       */
-      size_t m_local; 
-      size_t n_local;
-      if(i < m) {
-        m_local = i;
-        n_local = m;
-      }
-      else {
-        m_local = m;
-        n_local = i;
-      }
-      Y = t->Jjj[n_local*(n_local+1)/2 + m_local] / t->J2[i+1];
-      sum += Y * f_in[i];
-    }
-    f_out[m] = sum * 2.0 * r*r;
+  const size_t size = t->size;
+  size_t k, i;
+
+  for(i=0; i<nvec*size; i++) {
+    f_out[i] = 0.0;
+  }
+
+  for(k=0; k<nvec; k+=DHT_BLOCK) {
+    const size_t nb = GSL_MIN(DHT_BLOCK, nvec - k);
+    dht_apply_block(t, nb, f_in + k*size, f_out + k*size);
+  }
+
+  for(i=0; i<nvec*size; i++) {
+    f_out[i] *= 2.0 * r*r;
   }
 
   return GSL_SUCCESS;
 }
-
@@ -0,0 +1,97 @@
+/* dht/file.c
+ * 
+ * Copyright (C) 2014 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_block.h>
+#include <gsl/gsl_dht.h>
+
+/* The tables are stored after a header of four doubles holding the
+ * size, nu, xmax and kmax of the transform, in the same raw binary
+ * format as gsl_block_raw_fwrite.
+ */
+
+int
+gsl_dht_fwrite (FILE * stream, const gsl_dht * t)
+{
+  const size_t size = t->size;
+  double header[4];
+  int status;
+
+  header[0] = (double) size;
+  header[1] = t->nu;
+  header[2] = t->xmax;
+  header[3] = t->kmax;
+
+  status = gsl_block_raw_fwrite (stream, header, 4, 1);
+
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite (stream, t->j, size + 2, 1);
+
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite (stream, t->Jjj, size * (size + 1) / 2, 1);
+
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite (stream, t->J2, size + 1, 1);
+  return status;
+}
+
+int
+gsl_dht_fread (FILE * stream, gsl_dht * t)
+{
+  const size_t size = t->size;
+  double header[4];
+  int status = gsl_block_raw_fread (stream, header, 4, 1);
+
+  if (status)
+    return status;
+
+  if (header[0] != (double) size)
+    {
+      GSL_ERROR ("transform size in file does not match object", GSL_EBADLEN);
+    }
+
+  status = gsl_block_raw_fread (stream, t->j, size + 2, 1);
+
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fread (stream, t->Jjj, size * (size + 1) / 2, 1);
+
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fread (stream, t->J2, size + 1, 1);
+
+  if (status)
+    return status;
+
+  t->nu = header[1];
+  t->xmax = header[2];
+  t->kmax = header[3];
+
+  return GSL_SUCCESS;
+}
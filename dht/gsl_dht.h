@@ -22,6 +22,8 @@
 #ifndef __GSL_DHT_H__
 #define __GSL_DHT_H__
 
+#include <stdio.h>
+
 #undef __BEGIN_DECLS
 #undef __END_DECLS
 #ifdef __cplusplus
@@ -82,6 +84,22 @@ void gsl_dht_free(gsl_dht * t);
 int gsl_dht_apply(const gsl_dht * t, double * f_in, double * f_out);
 
 
+/* Perform the transform on nvec sampled arrays stored one after the
+ * other, f_in[k*size] ... f_in[k*size + size-1] for 0 <= k <= nvec-1,
+ * and similarly for f_out[].
+ */
+int gsl_dht_apply_multi(const gsl_dht * t, size_t nvec,
+                        const double * f_in, double * f_out);
+
+
+/* Write and read the precomputed tables of a transform object in
+ * binary form, so that they need not be recomputed.  The object
+ * being read into must have been allocated with the same size.
+ */
+int gsl_dht_fwrite(FILE * stream, const gsl_dht * t);
+int gsl_dht_fread(FILE * stream, gsl_dht * t);
+
+
 __END_DECLS
 
 #endif /* __GSL_DHT_H__ */
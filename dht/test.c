@@ -180,6 +180,69 @@ test_dht_poly1(void)
 }
 
 
+/* Test the blocked transform of several arrays against
+ * separate transforms, and writing and reading the tables.
+ */
+int
+test_dht_multi(void)
+{
+  int stat = 0;
+  int n, k;
+  const int nvec = 11;
+  double f_in[11*64];
+  double f_out[11*64];
+  double g_out[64];
+  gsl_dht * t = gsl_dht_new(64, 2.0, 5.0);
+  gsl_dht * u = gsl_dht_alloc(64);
+
+  for(k=0; k<nvec; k++) {
+    for(n=0; n<64; n++) {
+      const double x = gsl_dht_x_sample(t, n);
+      f_in[k*64 + n] = x*x * exp(-(k+1)*x*x/4.0);
+    }
+  }
+
+  gsl_dht_apply_multi(t, nvec, f_in, f_out);
+
+  for(k=0; k<nvec; k++) {
+    gsl_dht_apply(t, f_in + k*64, g_out);
+    for(n=0; n<64; n++) {
+      if(fabs(f_out[k*64 + n] - g_out[n]) > 1.0e-14 * fabs(g_out[0])) stat++;
+    }
+  }
+
+  {
+    FILE * f = fopen("test.dat", "wb");
+    gsl_dht_fwrite(f, t);
+    fclose(f);
+  }
+
+  {
+    FILE * f = fopen("test.dat", "rb");
+    gsl_dht_fread(f, u);
+    fclose(f);
+  }
+
+  if(u->nu != t->nu || u->xmax != t->xmax || u->kmax != t->kmax) stat++;
+
+  for(n=0; n<64*65/2; n++) {
+    if(u->Jjj[n] != t->Jjj[n]) stat++;
+  }
+
+  gsl_dht_apply(u, f_in, g_out);
+  gsl_dht_apply(t, f_in, f_out);
+
+  for(n=0; n<64; n++) {
+    if(g_out[n] != f_out[n]) stat++;
+  }
+
+  gsl_dht_free(u);
+  gsl_dht_free(t);
+
+  return stat;
+}
+
+
 int main()
 {
   gsl_ieee_env_setup ();
@@ -188,6 +251,7 @@ int main()
   gsl_test( test_dht_simple(),  "Simple  DHT");
   gsl_test( test_dht_exp1(),    "Exp  J1 DHT");
   gsl_test( test_dht_poly1(),   "Poly J1 DHT");
+  gsl_test( test_dht_multi(),   "Multi DHT and fwrite/fread");
 
   exit (gsl_test_summary());
 }
@@ -57,6 +57,39 @@ gsl_eigen_symmv_workspace * gsl_eigen_symmv_alloc (const size_t n);
 void gsl_eigen_symmv_free (gsl_eigen_symmv_workspace * w);
 int gsl_eigen_symmv (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_workspace * w);
 
+typedef struct {
+  size_t size;           /* matrix size */
+  double * d;            /* diagonal of tridiagonal form */
+  double * sd;           /* subdiagonal of tridiagonal form */
+  double * z;            /* rank-one update vector */
+  double * work;         /* scratch workspace, length 3n */
+  size_t * perm;         /* permutations, length 2n */
+  gsl_matrix * Q;        /* eigenvectors of tridiagonal matrix */
+  gsl_matrix * U;        /* eigenvectors of rank-one modified system */
+  gsl_matrix * W;        /* scratch matrix */
+} gsl_eigen_symmdc_workspace;
+
+gsl_eigen_symmdc_workspace * gsl_eigen_symmdc_alloc (const size_t n);
+void gsl_eigen_symmdc_free (gsl_eigen_symmdc_workspace * w);
+int gsl_eigen_symmdc (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmdc_workspace * w);
+
+typedef struct {
+  size_t size;           /* matrix size */
+  double * d;            /* diagonal of tridiagonal form */
+  double * sd;           /* subdiagonal of tridiagonal form */
+  double * tau;          /* Householder coefficients */
+  double * work;         /* scratch workspace, length 7n */
+} gsl_eigen_symmvx_workspace;
+
+gsl_eigen_symmvx_workspace * gsl_eigen_symmvx_alloc (const size_t n);
+void gsl_eigen_symmvx_free (gsl_eigen_symmvx_workspace * w);
+int gsl_eigen_symmvx_index (gsl_matrix * A, const size_t il, const size_t iu,
+                            gsl_vector * eval, gsl_matrix * evec,
+                            gsl_eigen_symmvx_workspace * w);
+int gsl_eigen_symmvx_range (gsl_matrix * A, const double vl, const double vu,
+                            gsl_vector * eval, gsl_matrix * evec,
+                            size_t * nfound, gsl_eigen_symmvx_workspace * w);
+
 typedef struct {
   size_t size;
   double * d;
@@ -0,0 +1,674 @@
+/* eigen/symmdc.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_sort_double.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_errno.h>
+
+/* Compute eigenvalues/eigenvectors of real symmetric matrix using
+   reduction to tridiagonal form, followed by Cuppen's divide and
+   conquer method.
+
+   The tridiagonal matrix T is torn into two halves T1, T2 coupled by
+   a rank-one modification,
+
+     T = [ T1 0 ; 0 T2 ] + rho v v^T
+
+   The halves are solved recursively and the eigensystem of the
+   rank-one modified diagonal matrix D + rho z z^T is obtained from
+   the roots of the secular equation.  Eigenvectors are computed from
+   the modified vector zhat of Gu and Eisenstat, which keeps them
+   numerically orthogonal, and the eigenvectors of the two halves are
+   combined with a single matrix-matrix product per merge.  Small
+   subproblems are handled by the implicit QR method of symmv.c.
+
+   See
+
+   J. J. M. Cuppen, "A divide and conquer method for the symmetric
+   tridiagonal eigenproblem", Numer. Math. 36 (1981), 177-195.
+
+   M. Gu and S. C. Eisenstat, "A divide-and-conquer algorithm for the
+   symmetric tridiagonal eigenproblem", SIAM J. Matrix Anal. Appl. 16
+   (1995), 172-191.
+
+   The deflation strategy follows LAPACK's dlaed2. */
+
+#include "qrstep.c"
+
+/* subproblems of this size or smaller are solved by QR iteration */
+#define SYMMDC_SMALL 25
+
+/* maximum number of iterations for each root of the secular equation */
+#define SYMMDC_MAXITER 100
+
+static void dc_solve (const size_t n, double d[], double sd[],
+                      gsl_matrix * Q, gsl_eigen_symmdc_workspace * w);
+static void dc_qr (const size_t n, double d[], double sd[],
+                   gsl_matrix * Q, gsl_eigen_symmdc_workspace * w);
+static void dc_merge (const size_t n, double d[], double rho, gsl_matrix * Q,
+                      gsl_eigen_symmdc_workspace * w);
+static double secular_root (const size_t k, const size_t j,
+                            const double dl[], const double z[],
+                            const double rho, double delta[]);
+
+gsl_eigen_symmdc_workspace *
+gsl_eigen_symmdc_alloc (const size_t n)
+{
+  gsl_eigen_symmdc_workspace * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+
+  w = (gsl_eigen_symmdc_workspace *) calloc (1, sizeof (gsl_eigen_symmdc_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->size = n;
+
+  w->d = (double *) malloc (n * sizeof (double));
+  w->sd = (double *) malloc (n * sizeof (double));
+  w->z = (double *) malloc (n * sizeof (double));
+  w->work = (double *) malloc (3 * n * sizeof (double));
+  w->perm = (size_t *) malloc (2 * n * sizeof (size_t));
+
+  if (w->d == 0 || w->sd == 0 || w->z == 0 || w->work == 0 || w->perm == 0)
+    {
+      gsl_eigen_symmdc_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for vectors", GSL_ENOMEM);
+    }
+
+  w->Q = gsl_matrix_alloc (n, n);
+  w->U = gsl_matrix_alloc (n, n);
+  w->W = gsl_matrix_alloc (n, n);
+
+  if (w->Q == 0 || w->U == 0 || w->W == 0)
+    {
+      gsl_eigen_symmdc_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for matrices", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_eigen_symmdc_free (gsl_eigen_symmdc_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->W)
+    gsl_matrix_free (w->W);
+
+  if (w->U)
+    gsl_matrix_free (w->U);
+
+  if (w->Q)
+    gsl_matrix_free (w->Q);
+
+  free (w->perm);
+  free (w->work);
+  free (w->z);
+  free (w->sd);
+  free (w->d);
+  free (w);
+}
+
+int
+gsl_eigen_symmdc (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                  gsl_eigen_symmdc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (eval->size != A->size1)
+    {
+      GSL_ERROR ("eigenvalue vector must match matrix size", GSL_EBADLEN);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != A->size1)
+    {
+      GSL_ERROR ("eigenvector matrix must match matrix size", GSL_EBADLEN);
+    }
+  else
+    {
+      double *const d = w->d;
+      double *const sd = w->sd;
+      const size_t N = A->size1;
+      size_t a, b;
+
+      /* handle special case */
+
+      if (N == 1)
+        {
+          double A00 = gsl_matrix_get (A, 0, 0);
+          gsl_vector_set (eval, 0, A00);
+          gsl_matrix_set (evec, 0, 0, 1.0);
+          return GSL_SUCCESS;
+        }
+
+      /* use sd as the temporary workspace for the decomposition when
+         computing eigenvectors */
+
+      {
+        gsl_vector_view d_vec = gsl_vector_view_array (d, N);
+        gsl_vector_view sd_vec = gsl_vector_view_array (sd, N - 1);
+        gsl_vector_view tau = gsl_vector_view_array (sd, N - 1);
+        gsl_linalg_symmtd_decomp (A, &tau.vector);
+        gsl_linalg_symmtd_unpack (A, &tau.vector, evec, &d_vec.vector, &sd_vec.vector);
+      }
+
+      /* split the tridiagonal matrix at negligible off-diagonal
+         elements and solve each unreduced block independently */
+
+      chop_small_elements (N, d, sd);
+
+      gsl_matrix_set_zero (w->Q);
+
+      a = 0;
+
+      while (a < N)
+        {
+          gsl_matrix_view Qb;
+          double scale = 0.0;
+          size_t i, nb;
+
+          b = a;
+
+          while (b < N - 1 && sd[b] != 0.0)
+            b++;
+
+          nb = b - a + 1;
+
+          Qb = gsl_matrix_submatrix (w->Q, a, a, nb, nb);
+
+          /* scale the block to unit norm to avoid overflow/underflow in
+             the secular equation */
+
+          for (i = a; i <= b; i++)
+            {
+              scale = GSL_MAX_DBL (scale, fabs (d[i]));
+              if (i < b)
+                scale = GSL_MAX_DBL (scale, fabs (sd[i]));
+            }
+
+          if (scale == 0.0)
+            {
+              gsl_matrix_set_identity (&Qb.matrix);
+            }
+          else
+            {
+              for (i = a; i <= b; i++)
+                {
+                  d[i] /= scale;
+                  if (i < b)
+                    sd[i] /= scale;
+                }
+
+              dc_solve (nb, d + a, sd + a, &Qb.matrix, w);
+
+              for (i = a; i <= b; i++)
+                d[i] *= scale;
+            }
+
+          a = b + 1;
+        }
+
+      /* back-transform, evec <- Z Q where Z is the orthogonal matrix
+         from the tridiagonal reduction */
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, evec, w->Q, 0.0, w->W);
+      gsl_matrix_memcpy (evec, w->W);
+
+      {
+        gsl_vector_view d_vec = gsl_vector_view_array (d, N);
+        gsl_vector_memcpy (eval, &d_vec.vector);
+      }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* solve the unreduced n-by-n tridiagonal eigenproblem (d,sd),
+   storing the eigenvectors in Q */
+
+static void
+dc_solve (const size_t n, double d[], double sd[], gsl_matrix * Q,
+          gsl_eigen_symmdc_workspace * w)
+{
+  if (n <= SYMMDC_SMALL)
+    {
+      dc_qr (n, d, sd, Q, w);
+    }
+  else
+    {
+      const size_t n1 = n / 2;
+      const size_t n2 = n - n1;
+      const double beta = sd[n1 - 1];
+      const double rho = fabs (beta);
+      gsl_matrix_view Q11 = gsl_matrix_submatrix (Q, 0, 0, n1, n1);
+      gsl_matrix_view Q22 = gsl_matrix_submatrix (Q, n1, n1, n2, n2);
+      gsl_matrix_view Q12 = gsl_matrix_submatrix (Q, 0, n1, n1, n2);
+      gsl_matrix_view Q21 = gsl_matrix_submatrix (Q, n1, 0, n2, n1);
+
+      /* tear: T = diag(T1, T2) + rho v v^T with v = e_{n1-1} + s e_{n1}
+         and s = sign(beta) */
+
+      d[n1 - 1] -= rho;
+      d[n1] -= rho;
+
+      dc_solve (n1, d, sd, &Q11.matrix, w);
+      dc_solve (n2, d + n1, sd + n1, &Q22.matrix, w);
+
+      gsl_matrix_set_zero (&Q12.matrix);
+      gsl_matrix_set_zero (&Q21.matrix);
+
+      /* z = Q^T v, i.e. the last row of Q1 and (signed) first row of Q2 */
+
+      {
+        double *z = w->z;
+        const double s = (beta >= 0.0) ? 1.0 : -1.0;
+        size_t i;
+
+        for (i = 0; i < n1; i++)
+          z[i] = gsl_matrix_get (Q, n1 - 1, i);
+
+        for (i = n1; i < n; i++)
+          z[i] = s * gsl_matrix_get (Q, n1, i);
+      }
+
+      dc_merge (n, d, rho, Q, w);
+    }
+}
+
+/* QR iteration with implicit shifts for small subproblems, as in
+   gsl_eigen_symmv */
+
+static void
+dc_qr (const size_t n, double d[], double sd[], gsl_matrix * Q,
+       gsl_eigen_symmdc_workspace * w)
+{
+  double * const gc = w->work;
+  double * const gs = w->work + n;
+  size_t a, b;
+
+  gsl_matrix_set_identity (Q);
+
+  if (n == 1)
+    return;
+
+  chop_small_elements (n, d, sd);
+
+  b = n - 1;
+
+  while (b > 0)
+    {
+      if (sd[b - 1] == 0.0 || isnan (sd[b - 1]))
+        {
+          b--;
+          continue;
+        }
+
+      a = b - 1;
+
+      while (a > 0)
+        {
+          if (sd[a - 1] == 0.0)
+            {
+              break;
+            }
+          a--;
+        }
+
+      {
+        size_t i;
+        const size_t n_block = b - a + 1;
+
+        qrstep (n_block, d + a, sd + a, gc, gs);
+
+        for (i = 0; i < n_block - 1; i++)
+          {
+            gsl_vector_view qi = gsl_matrix_column (Q, a + i);
+            gsl_vector_view qj = gsl_matrix_column (Q, a + i + 1);
+
+            /* Q <- Q G with G = [c s; -s c] */
+            gsl_blas_drot (&qi.vector, &qj.vector, gc[i], -gs[i]);
+          }
+
+        chop_small_elements (n, d, sd);
+      }
+    }
+}
+
+/* compute the eigensystem of diag(d) + rho z z^T, where the columns
+   of Q hold the eigenvectors of diag(T1, T2) and z = Q^T v is stored
+   in w->z.  On output d holds the eigenvalues and Q the eigenvectors
+   of the merged problem */
+
+static void
+dc_merge (const size_t n, double d[], double rho, gsl_matrix * Q,
+          gsl_eigen_symmdc_workspace * w)
+{
+  double * const z = w->z;
+  double * const ds = w->work;            /* sorted d */
+  double * const zs = w->work + n;        /* sorted z */
+  double * const zhat = w->work + 2 * n;  /* modified z */
+  size_t * const perm = w->perm;
+  size_t * const order = w->perm + n;     /* non-deflated, then deflated */
+  gsl_matrix_view W = gsl_matrix_submatrix (w->W, 0, 0, n, n);
+  double dmax = 0.0, zmax = 0.0, tol;
+  size_t i, j, k, ndefl;
+  size_t pj;
+  int have_pj = 0;
+
+  /* normalize z, so that rho becomes rho*||z||^2 */
+
+  {
+    gsl_vector_view zv = gsl_vector_view_array (z, n);
+    double znorm = gsl_blas_dnrm2 (&zv.vector);
+    gsl_blas_dscal (1.0 / znorm, &zv.vector);
+    rho *= znorm * znorm;
+  }
+
+  /* sort into ascending order of d, permuting columns of Q into W */
+
+  gsl_sort_index (perm, d, 1, n);
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_vector_view src = gsl_matrix_column (Q, perm[i]);
+      gsl_vector_view dest = gsl_matrix_column (&W.matrix, i);
+
+      ds[i] = d[perm[i]];
+      zs[i] = z[perm[i]];
+      gsl_vector_memcpy (&dest.vector, &src.vector);
+
+      dmax = GSL_MAX_DBL (dmax, fabs (ds[i]));
+      zmax = GSL_MAX_DBL (zmax, fabs (zs[i]));
+    }
+
+  tol = 8.0 * GSL_DBL_EPSILON * GSL_MAX_DBL (dmax, zmax);
+
+  /* deflation: components with small z, and pairs of nearly equal
+     d which can be decoupled by a Givens rotation.  The indices of
+     the non-deflated components are collected at the start of order[]
+     and the deflated ones at the end */
+
+  k = 0;
+  ndefl = 0;
+  pj = 0;
+
+  for (j = 0; j < n; j++)
+    {
+      if (rho * fabs (zs[j]) <= tol)
+        {
+          order[n - 1 - ndefl++] = j;
+          continue;
+        }
+
+      if (!have_pj)
+        {
+          pj = j;
+          have_pj = 1;
+          continue;
+        }
+
+      {
+        double s = zs[pj];
+        double c = zs[j];
+        const double tau = hypot (c, s);
+        double t = ds[j] - ds[pj];
+
+        c /= tau;
+        s = -s / tau;
+
+        if (fabs (t * c * s) <= tol)
+          {
+            gsl_vector_view qp = gsl_matrix_column (&W.matrix, pj);
+            gsl_vector_view qj = gsl_matrix_column (&W.matrix, j);
+
+            zs[j] = tau;
+            zs[pj] = 0.0;
+
+            gsl_blas_drot (&qp.vector, &qj.vector, c, s);
+
+            t = ds[pj] * c * c + ds[j] * s * s;
+            ds[j] = ds[pj] * s * s + ds[j] * c * c;
+            ds[pj] = t;
+
+            order[n - 1 - ndefl++] = pj;
+          }
+        else
+          {
+            order[k++] = pj;
+          }
+
+        pj = j;
+      }
+    }
+
+  if (have_pj)
+    order[k++] = pj;
+
+  /* copy the columns back into Q, non-deflated ones first */
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_vector_view src = gsl_matrix_column (&W.matrix, order[i]);
+      gsl_vector_view dest = gsl_matrix_column (Q, i);
+
+      gsl_vector_memcpy (&dest.vector, &src.vector);
+      d[i] = ds[order[i]];
+      z[i] = zs[order[i]];
+    }
+
+  if (k == 0)
+    return;
+
+  /* the k non-deflated components are now stored in ascending order
+     of d at the start of d and z; solve the secular equation for each
+     root, storing the differences d_i - lambda_j in column j of U */
+
+  {
+    gsl_matrix_view U = gsl_matrix_submatrix (w->U, 0, 0, k, k);
+    gsl_matrix_view Qk = gsl_matrix_submatrix (Q, 0, 0, n, k);
+    gsl_matrix_view Wk = gsl_matrix_submatrix (&W.matrix, 0, 0, n, k);
+    double * const delta = ds;
+    double * const lambda = zs;
+
+    for (j = 0; j < k; j++)
+      {
+        lambda[j] = secular_root (k, j, d, z, rho, delta);
+
+        for (i = 0; i < k; i++)
+          gsl_matrix_set (&U.matrix, i, j, delta[i]);
+      }
+
+    /* compute zhat from the computed eigenvalues (Lowner's theorem),
+       so the eigenvectors are orthogonal to working precision */
+
+    for (i = 0; i < k; i++)
+      {
+        double wi = gsl_matrix_get (&U.matrix, i, i);
+
+        for (j = 0; j < k; j++)
+          {
+            if (j != i)
+              wi *= gsl_matrix_get (&U.matrix, i, j) / (d[i] - d[j]);
+          }
+
+        zhat[i] = (z[i] >= 0.0) ? sqrt (-wi) : -sqrt (-wi);
+      }
+
+    /* eigenvectors of the rank-one modified system, u_j(i) = zhat_i
+       / (d_i - lambda_j) normalized */
+
+    for (j = 0; j < k; j++)
+      {
+        gsl_vector_view uj = gsl_matrix_column (&U.matrix, j);
+        double nrm;
+
+        for (i = 0; i < k; i++)
+          {
+            double dij = gsl_matrix_get (&U.matrix, i, j);
+            gsl_matrix_set (&U.matrix, i, j, zhat[i] / dij);
+          }
+
+        nrm = gsl_blas_dnrm2 (&uj.vector);
+        gsl_blas_dscal (1.0 / nrm, &uj.vector);
+      }
+
+    for (j = 0; j < k; j++)
+      d[j] = lambda[j];
+
+    /* Q(:,0:k-1) <- Q(:,0:k-1) U */
+
+    gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Qk.matrix, &U.matrix,
+                    0.0, &Wk.matrix);
+    gsl_matrix_memcpy (&Qk.matrix, &Wk.matrix);
+  }
+}
+
+/* find the j-th root lambda_j of the secular equation
+
+     f(x) = 1 + rho sum_i z_i^2 / (d_i - x)
+
+   for strictly increasing d_0 < d_1 < ... < d_{k-1}, rho > 0 and
+   ||z|| <= 1.  The root is found relative to the nearest pole d_o
+   (x = d_o + t) so that the differences delta_i = d_i - lambda_j are
+   obtained to high relative accuracy.  The pole is removed by
+   iterating on h(t) = (d_o - x) f(x) with a safeguarded Newton
+   method. */
+
+static double
+secular_root (const size_t k, const size_t j, const double dl[],
+              const double z[], const double rho, double delta[])
+{
+  size_t o, i, iter;
+  double lo, hi, t;
+
+  if (j < k - 1)
+    {
+      const double mid = 0.5 * (dl[j] + dl[j + 1]);
+      double f = 1.0;
+
+      for (i = 0; i < k; i++)
+        f += rho * z[i] * z[i] / (dl[i] - mid);
+
+      if (f >= 0.0)
+        {
+          /* root lies in (d_j, mid] */
+          o = j;
+          lo = 0.0;
+          hi = mid - dl[j];
+        }
+      else
+        {
+          /* root lies in (mid, d_{j+1}) */
+          o = j + 1;
+          lo = mid - dl[j + 1];
+          hi = 0.0;
+        }
+    }
+  else
+    {
+      double z2 = 0.0;
+
+      for (i = 0; i < k; i++)
+        z2 += z[i] * z[i];
+
+      o = j;
+      lo = 0.0;
+      hi = rho * z2;
+    }
+
+  for (i = 0; i < k; i++)
+    delta[i] = dl[i] - dl[o];
+
+  t = 0.5 * (lo + hi);
+
+  for (iter = 0; iter < SYMMDC_MAXITER; iter++)
+    {
+      const double zo2 = rho * z[o] * z[o];
+      double r = 0.0, dr = 0.0, rabs = 0.0;
+      double h, dh, g, tnew;
+
+      for (i = 0; i < k; i++)
+        {
+          double term, di;
+
+          if (i == o)
+            continue;
+
+          di = delta[i] - t;
+          term = rho * z[i] * z[i] / di;
+          r += term;
+          rabs += fabs (term);
+          dr += term / di;
+        }
+
+      h = -t * (1.0 + r) + zo2;
+      dh = -(1.0 + r) - t * dr;
+
+      if (fabs (h) <= 4.0 * GSL_DBL_EPSILON * ((double) k * fabs (t) * (1.0 + rabs) + zo2))
+        break;
+
+      /* g = f(d_o + t) has the sign of -h for t > 0 and of h for t < 0;
+         f is increasing so update the bracket accordingly */
+
+      g = (t > 0.0) ? -h : h;
+
+      if (g < 0.0)
+        lo = t;
+      else
+        hi = t;
+
+      tnew = t - h / dh;
+
+      if (!(tnew > lo && tnew < hi))
+        tnew = 0.5 * (lo + hi);
+
+      if (fabs (tnew - t) <= 2.0 * GSL_DBL_EPSILON * fabs (t) || hi - lo <= 2.0 * GSL_DBL_EPSILON * GSL_MAX_DBL (fabs (lo), fabs (hi)))
+        {
+          t = tnew;
+          break;
+        }
+
+      t = tnew;
+    }
+
+  for (i = 0; i < k; i++)
+    delta[i] -= t;
+
+  return dl[o] + t;
+}
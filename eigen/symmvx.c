@@ -0,0 +1,691 @@
+/* eigen/symmvx.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_errno.h>
+
+/* Compute selected eigenvalues/eigenvectors of a real symmetric
+   matrix, specified either by index or by a range of values.
+
+   The matrix is reduced to tridiagonal form T.  The requested
+   eigenvalues of T are located by bisection using Sturm sequence
+   counts, and the corresponding eigenvectors are computed by inverse
+   iteration, reorthogonalizing within clusters of close eigenvalues
+   and once more against all previous vectors on convergence.  Finally the eigenvectors are back-transformed by applying the
+   Householder reflections of the reduction directly, so the cost is
+   O(n m^2) for the tridiagonal stage and O(n^2 m) for the
+   back-transformation when m eigenpairs are requested.
+
+   The bisection and inverse iteration steps follow LAPACK's dstebz
+   and dstein.  See also Golub & Van Loan, "Matrix Computations" (3rd
+   ed), Sections 8.5 and 7.6.1. */
+
+/* maximum number of inverse iteration steps per eigenvector */
+#define SYMMVX_MAXITS 5
+
+/* number of extra iterations after the stopping criterion is met */
+#define SYMMVX_EXTRA 2
+
+static double symmvx_reduce (gsl_matrix * A, gsl_eigen_symmvx_workspace * w);
+static size_t sturm_count (const size_t n, const double d[],
+                           const double sd[], const double x,
+                           const int strict);
+static void symmvx_bisect (const size_t n, const double d[],
+                           const double sd[], const size_t il,
+                           const size_t m, double lambda[]);
+static int symmvx_invit (const size_t n, const double d[], const double sd[],
+                         const size_t m, const double lambda[],
+                         gsl_matrix * Y, double work[]);
+static void symmvx_backtrans (const gsl_matrix * A, const double tau[],
+                              gsl_matrix * Y);
+static int symmvx_solve (gsl_matrix * A, const size_t il, const size_t m,
+                         const double scale, gsl_vector * eval,
+                         gsl_matrix * evec, gsl_eigen_symmvx_workspace * w);
+
+gsl_eigen_symmvx_workspace *
+gsl_eigen_symmvx_alloc (const size_t n)
+{
+  gsl_eigen_symmvx_workspace * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+
+  w = (gsl_eigen_symmvx_workspace *) calloc (1, sizeof (gsl_eigen_symmvx_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->d = (double *) malloc (n * sizeof (double));
+
+  if (w->d == 0)
+    {
+      gsl_eigen_symmvx_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for diagonal", GSL_ENOMEM);
+    }
+
+  w->sd = (double *) malloc (n * sizeof (double));
+
+  if (w->sd == 0)
+    {
+      gsl_eigen_symmvx_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for subdiagonal", GSL_ENOMEM);
+    }
+
+  w->tau = (double *) malloc (n * sizeof (double));
+
+  if (w->tau == 0)
+    {
+      gsl_eigen_symmvx_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for tau", GSL_ENOMEM);
+    }
+
+  w->work = (double *) malloc (7 * n * sizeof (double));
+
+  if (w->work == 0)
+    {
+      gsl_eigen_symmvx_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for work", GSL_ENOMEM);
+    }
+
+  w->size = n;
+
+  return w;
+}
+
+void
+gsl_eigen_symmvx_free (gsl_eigen_symmvx_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w->work);
+  free (w->tau);
+  free (w->sd);
+  free (w->d);
+  free (w);
+}
+
+/*
+gsl_eigen_symmvx_index()
+  Compute eigenvalues il,...,iu (0-based, in ascending order) and
+optionally the corresponding eigenvectors
+
+Inputs: A    - real symmetric matrix, lower triangle and diagonal
+               are destroyed on output
+        il   - index of smallest eigenvalue to compute
+        iu   - index of largest eigenvalue to compute
+        eval - (output) eigenvalues, length iu - il + 1
+        evec - (output) eigenvectors, N-by-(iu - il + 1), or NULL
+               if only eigenvalues are required
+        w    - workspace
+*/
+
+int
+gsl_eigen_symmvx_index (gsl_matrix * A, const size_t il, const size_t iu,
+                        gsl_vector * eval, gsl_matrix * evec,
+                        gsl_eigen_symmvx_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (il > iu || iu >= A->size1)
+    {
+      GSL_ERROR ("must have il <= iu < N", GSL_EINVAL);
+    }
+  else if (eval->size != iu - il + 1)
+    {
+      GSL_ERROR ("eigenvalue vector must match number of requested eigenvalues",
+                 GSL_EBADLEN);
+    }
+  else if (evec != NULL &&
+           (evec->size1 != A->size1 || evec->size2 != iu - il + 1))
+    {
+      GSL_ERROR ("eigenvector matrix must be N-by-(iu - il + 1)", GSL_EBADLEN);
+    }
+  else
+    {
+      const double scale = symmvx_reduce (A, w);
+
+      return symmvx_solve (A, il, iu - il + 1, scale, eval, evec, w);
+    }
+}
+
+/*
+gsl_eigen_symmvx_range()
+  Compute eigenvalues in the interval [vl,vu] and optionally the
+corresponding eigenvectors
+
+Inputs: A      - real symmetric matrix, lower triangle and diagonal
+                 are destroyed on output
+        vl     - lower bound of interval
+        vu     - upper bound of interval
+        eval   - (output) eigenvalues in ascending order, stored in
+                 the first *nfound elements, length N
+        evec   - (output) N-by-N, eigenvectors stored in the first
+                 *nfound columns, or NULL if only eigenvalues are
+                 required
+        nfound - (output) number of eigenvalues in [vl,vu]
+        w      - workspace
+
+Notes: the number of eigenvalues in the interval is only known after
+A has been reduced, so as in LAPACK dsyevx the outputs must have room
+for all N eigenpairs and are checked before A is modified
+*/
+
+int
+gsl_eigen_symmvx_range (gsl_matrix * A, const double vl, const double vu,
+                        gsl_vector * eval, gsl_matrix * evec,
+                        size_t * nfound, gsl_eigen_symmvx_workspace * w)
+{
+  *nfound = 0;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (vl > vu)
+    {
+      GSL_ERROR ("must have vl <= vu", GSL_EINVAL);
+    }
+  else if (eval->size != A->size1)
+    {
+      GSL_ERROR ("eigenvalue vector must match matrix size", GSL_EBADLEN);
+    }
+  else if (evec != NULL &&
+           (evec->size1 != A->size1 || evec->size2 != A->size1))
+    {
+      GSL_ERROR ("eigenvector matrix must match matrix size", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t N = A->size1;
+      const double scale = symmvx_reduce (A, w);
+      const size_t il = sturm_count (N, w->d, w->sd, vl / scale, 1);
+      const size_t iu = sturm_count (N, w->d, w->sd, vu / scale, 0);
+      const size_t m = iu - il;
+
+      *nfound = m;
+
+      if (m == 0)
+        {
+          return GSL_SUCCESS;
+        }
+      else
+        {
+          gsl_vector_view ev = gsl_vector_subvector (eval, 0, m);
+
+          if (evec != NULL)
+            {
+              gsl_matrix_view em = gsl_matrix_submatrix (evec, 0, 0, N, m);
+              return symmvx_solve (A, il, m, scale, &ev.vector, &em.matrix, w);
+            }
+          else
+            {
+              return symmvx_solve (A, il, m, scale, &ev.vector, NULL, w);
+            }
+        }
+    }
+}
+
+/* reduce A to tridiagonal form, storing the diagonal and subdiagonal
+   scaled to unit norm in w->d, w->sd.  Returns the scale factor */
+
+static double
+symmvx_reduce (gsl_matrix * A, gsl_eigen_symmvx_workspace * w)
+{
+  const size_t N = A->size1;
+  double *const d = w->d;
+  double *const sd = w->sd;
+  double scale = 0.0;
+  size_t i;
+
+  if (N == 1)
+    {
+      d[0] = gsl_matrix_get (A, 0, 0);
+    }
+  else
+    {
+      gsl_vector_view d_vec = gsl_vector_view_array (d, N);
+      gsl_vector_view sd_vec = gsl_vector_view_array (sd, N - 1);
+      gsl_vector_view tau = gsl_vector_view_array (w->tau, N - 1);
+
+      gsl_linalg_symmtd_decomp (A, &tau.vector);
+      gsl_linalg_symmtd_unpack_T (A, &d_vec.vector, &sd_vec.vector);
+    }
+
+  for (i = 0; i < N; i++)
+    {
+      scale = GSL_MAX_DBL (scale, fabs (d[i]));
+      if (i < N - 1)
+        scale = GSL_MAX_DBL (scale, fabs (sd[i]));
+    }
+
+  if (scale == 0.0)
+    return 1.0;
+
+  for (i = 0; i < N; i++)
+    {
+      d[i] /= scale;
+      if (i < N - 1)
+        sd[i] /= scale;
+    }
+
+  return scale;
+}
+
+static int
+symmvx_solve (gsl_matrix * A, const size_t il, const size_t m,
+              const double scale, gsl_vector * eval, gsl_matrix * evec,
+              gsl_eigen_symmvx_workspace * w)
+{
+  const size_t N = A->size1;
+  double *lambda = w->work;
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  symmvx_bisect (N, w->d, w->sd, il, m, lambda);
+
+  if (evec != NULL)
+    {
+      if (N == 1)
+        {
+          gsl_matrix_set (evec, 0, 0, 1.0);
+        }
+      else
+        {
+          status = symmvx_invit (N, w->d, w->sd, m, lambda, evec, w->work + N);
+          symmvx_backtrans (A, w->tau, evec);
+        }
+    }
+
+  for (i = 0; i < m; i++)
+    gsl_vector_set (eval, i, scale * lambda[i]);
+
+  if (status)
+    {
+      GSL_ERROR ("inverse iteration failed to converge", status);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* return the number of eigenvalues of the tridiagonal matrix (d,sd)
+   which are less than x if strict is set, or less than or equal to x
+   otherwise.  A zero pivot is replaced by a tiny one whose sign moves
+   x just below or above an eigenvalue lying exactly at x */
+
+static size_t
+sturm_count (const size_t n, const double d[], const double sd[],
+             const double x, const int strict)
+{
+  const double pivmin = strict ? GSL_DBL_MIN : -GSL_DBL_MIN;
+  size_t i, count = 0;
+  double q = d[0] - x;
+
+  if (fabs (q) < GSL_DBL_MIN)
+    q = pivmin;
+
+  if (q < 0.0)
+    count++;
+
+  for (i = 1; i < n; i++)
+    {
+      q = (d[i] - x) - sd[i - 1] * sd[i - 1] / q;
+
+      if (fabs (q) < GSL_DBL_MIN)
+        q = pivmin;
+
+      if (q < 0.0)
+        count++;
+    }
+
+  return count;
+}
+
+/* compute eigenvalues il,...,il+m-1 of the tridiagonal matrix (d,sd)
+   by bisection */
+
+static void
+symmvx_bisect (const size_t n, const double d[], const double sd[],
+               const size_t il, const size_t m, double lambda[])
+{
+  double gl = d[0], gu = d[0], bnorm, lo;
+  size_t i, j;
+
+  /* Gershgorin bounds */
+
+  for (i = 0; i < n; i++)
+    {
+      double r = 0.0;
+
+      if (i > 0)
+        r += fabs (sd[i - 1]);
+      if (i < n - 1)
+        r += fabs (sd[i]);
+
+      gl = GSL_MIN_DBL (gl, d[i] - r);
+      gu = GSL_MAX_DBL (gu, d[i] + r);
+    }
+
+  bnorm = GSL_MAX_DBL (fabs (gl), fabs (gu));
+  gl -= 2.0 * GSL_DBL_EPSILON * bnorm * n + 2.0 * GSL_DBL_MIN;
+  gu += 2.0 * GSL_DBL_EPSILON * bnorm * n + 2.0 * GSL_DBL_MIN;
+
+  /* the eigenvalues are found in increasing order, so the lower end of
+     each bracket can start from the previous eigenvalue */
+
+  lo = gl;
+
+  for (j = 0; j < m; j++)
+    {
+      const size_t idx = il + j;
+      double a = lo, b = gu;
+
+      /* invariant: count(a) <= idx < count(b) */
+
+      while (b - a > 2.0 * GSL_DBL_EPSILON * (GSL_MAX_DBL (fabs (a), fabs (b)) + bnorm * GSL_DBL_EPSILON))
+        {
+          const double mid = 0.5 * (a + b);
+
+          if (mid <= a || mid >= b)
+            break;
+
+          if (sturm_count (n, d, sd, mid, 0) > idx)
+            b = mid;
+          else
+            a = mid;
+        }
+
+      lambda[j] = 0.5 * (a + b);
+      lo = a;
+    }
+}
+
+/* compute eigenvectors of the tridiagonal matrix (d,sd) corresponding
+   to the ascending eigenvalues lambda[0..m-1] by inverse iteration,
+   storing them in the first n rows of the columns of Y */
+
+static int
+symmvx_invit (const size_t n, const double d[], const double sd[],
+              const size_t m, const double lambda[], gsl_matrix * Y,
+              double work[])
+{
+  double *u0 = work;            /* diagonal of U */
+  double *u1 = work + n;        /* first superdiagonal of U */
+  double *u2 = work + 2 * n;    /* second superdiagonal of U */
+  double *l = work + 3 * n;     /* multipliers of L */
+  double *x = work + 4 * n;     /* iterate, pivots stored in sign of l */
+  const double dtpcrt = sqrt (0.1 / n);
+  double onenrm = 0.0, ortol, pivtol;
+  double xjm = 0.0;
+  unsigned long int seed = 1;
+  size_t gpind = 0;
+  size_t i, j;
+  int status = GSL_SUCCESS;
+  char *piv = (char *) (work + 5 * n);
+
+  for (i = 0; i < n; i++)
+    {
+      double r = fabs (d[i]);
+
+      if (i > 0)
+        r += fabs (sd[i - 1]);
+      if (i < n - 1)
+        r += fabs (sd[i]);
+
+      onenrm = GSL_MAX_DBL (onenrm, r);
+    }
+
+  ortol = 1.0e-3 * onenrm;
+  pivtol = GSL_DBL_EPSILON * onenrm;
+
+  if (pivtol == 0.0)
+    pivtol = GSL_DBL_MIN;
+
+  for (j = 0; j < m; j++)
+    {
+      gsl_vector_view yj = gsl_matrix_column (Y, j);
+      double xj = lambda[j];
+      size_t its = 0, nrmchk = 0, jmax = 0;
+
+      /* perturb nearly equal eigenvalues so inverse iteration yields
+         independent vectors, and start a new orthogonalization group
+         when the gap is large */
+
+      if (j > 0)
+        {
+          const double pertol = 10.0 * fabs (GSL_DBL_EPSILON * xj);
+
+          if (xj - xjm < pertol)
+            xj = xjm + pertol;
+
+          if (fabs (xj - xjm) > ortol)
+            gpind = j;
+        }
+
+      /* LU factorization with partial pivoting of T - xj I */
+
+      {
+        double a = d[0] - xj;
+        double c = (n > 1) ? sd[0] : 0.0;
+        size_t k;
+
+        for (k = 0; k < n - 1; k++)
+          {
+            const double b = sd[k];
+            const double anext = d[k + 1] - xj;
+            const double cnext = (k + 1 < n - 1) ? sd[k + 1] : 0.0;
+
+            if (fabs (a) >= fabs (b))
+              {
+                if (fabs (a) < pivtol)
+                  a = (a >= 0.0) ? pivtol : -pivtol;
+
+                l[k] = b / a;
+                piv[k] = 0;
+                u0[k] = a;
+                u1[k] = c;
+                u2[k] = 0.0;
+                a = anext - l[k] * c;
+                c = cnext;
+              }
+            else
+              {
+                l[k] = a / b;
+                piv[k] = 1;
+                u0[k] = b;
+                u1[k] = anext;
+                u2[k] = cnext;
+                a = c - l[k] * anext;
+                c = -l[k] * cnext;
+              }
+          }
+
+        if (fabs (a) < pivtol)
+          a = (a >= 0.0) ? pivtol : -pivtol;
+
+        u0[n - 1] = a;
+      }
+
+      /* pseudo-random starting vector in (-1,1) */
+
+      for (i = 0; i < n; i++)
+        {
+          seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+          x[i] = 2.0 * ((double) seed / 2147483648.0) - 1.0;
+        }
+
+      while (1)
+        {
+          double scl, nrm;
+          size_t k;
+
+          if (++its > SYMMVX_MAXITS)
+            {
+              status = GSL_EMAXITER;
+              break;
+            }
+
+          /* scale the right hand side */
+
+          jmax = 0;
+          for (i = 1; i < n; i++)
+            {
+              if (fabs (x[i]) > fabs (x[jmax]))
+                jmax = i;
+            }
+
+          scl = n * onenrm * GSL_MAX_DBL (GSL_DBL_EPSILON, fabs (u0[n - 1])) / fabs (x[jmax]);
+
+          for (i = 0; i < n; i++)
+            x[i] *= scl;
+
+          /* solve P L U x = b */
+
+          for (k = 0; k < n - 1; k++)
+            {
+              if (piv[k])
+                {
+                  double tmp = x[k];
+                  x[k] = x[k + 1];
+                  x[k + 1] = tmp;
+                }
+
+              x[k + 1] -= l[k] * x[k];
+            }
+
+          x[n - 1] /= u0[n - 1];
+
+          if (n > 1)
+            x[n - 2] = (x[n - 2] - u1[n - 2] * x[n - 1]) / u0[n - 2];
+
+          for (k = n - 2; k-- > 0;)
+            x[k] = (x[k] - u1[k] * x[k + 1] - u2[k] * x[k + 2]) / u0[k];
+
+          /* reorthogonalize against previous vectors in this group */
+
+          for (k = gpind; k < j; k++)
+            {
+              gsl_vector_view yk = gsl_matrix_column (Y, k);
+              gsl_vector_view xv = gsl_vector_view_array (x, n);
+              double ztr;
+
+              gsl_blas_ddot (&xv.vector, &yk.vector, &ztr);
+              gsl_blas_daxpy (-ztr, &yk.vector, &xv.vector);
+            }
+
+          jmax = 0;
+          for (i = 1; i < n; i++)
+            {
+              if (fabs (x[i]) > fabs (x[jmax]))
+                jmax = i;
+            }
+
+          nrm = fabs (x[jmax]);
+
+          if (nrm < dtpcrt)
+            continue;
+
+          if (++nrmchk < SYMMVX_EXTRA + 1)
+            continue;
+
+          break;
+        }
+
+      /* a final orthogonalization against all previous vectors removes
+         the O(eps ||T|| / gap) loss of orthogonality between vectors of
+         well separated eigenvalues */
+
+      {
+        gsl_vector_view xv = gsl_vector_view_array (x, n);
+        double scl;
+        size_t k;
+
+        scl = 1.0 / gsl_blas_dnrm2 (&xv.vector);
+        gsl_blas_dscal (scl, &xv.vector);
+
+        for (k = 0; k < j; k++)
+          {
+            gsl_vector_view yk = gsl_matrix_column (Y, k);
+            double ztr;
+
+            gsl_blas_ddot (&xv.vector, &yk.vector, &ztr);
+            gsl_blas_daxpy (-ztr, &yk.vector, &xv.vector);
+          }
+
+        /* normalize so the largest component is positive */
+
+        jmax = 0;
+        for (i = 1; i < n; i++)
+          {
+            if (fabs (x[i]) > fabs (x[jmax]))
+              jmax = i;
+          }
+
+        scl = 1.0 / gsl_blas_dnrm2 (&xv.vector);
+
+        if (x[jmax] < 0.0)
+          scl = -scl;
+
+        gsl_blas_dscal (scl, &xv.vector);
+        gsl_vector_memcpy (&yj.vector, &xv.vector);
+      }
+
+      xjm = xj;
+    }
+
+  return status;
+}
+
+/* apply the orthogonal matrix Q = Q_1 ... Q_(N-2) of the tridiagonal
+   reduction to Y, Y <- Q Y */
+
+static void
+symmvx_backtrans (const gsl_matrix * A, const double tau[], gsl_matrix * Y)
+{
+  const size_t N = A->size1;
+  size_t i;
+
+  for (i = N - 2; i-- > 0;)
+    {
+      gsl_vector_const_view c = gsl_matrix_const_column (A, i);
+      gsl_vector_const_view h = gsl_vector_const_subvector (&c.vector, i + 1, N - (i + 1));
+      gsl_matrix_view m = gsl_matrix_submatrix (Y, i + 1, 0, N - (i + 1), Y->size2);
+
+      gsl_linalg_householder_hm (tau[i], &h.vector, &m.matrix);
+    }
+}
@@ -294,6 +294,7 @@ test_eigen_symm_results (const gsl_matrix * A,
                          const char * desc2)
 {
   const size_t N = A->size1;
+  const size_t M = eval->size;
   size_t i, j;
   double emax = 0;
 
@@ -301,13 +302,13 @@ test_eigen_symm_results (const gsl_matrix * A,
   gsl_vector * y = gsl_vector_alloc(N);
 
   /* check eigenvalues */
-  for (i = 0; i < N; i++) 
+  for (i = 0; i < M; i++) 
     {
       double ei = gsl_vector_get (eval, i);
       if (fabs(ei) > emax) emax = fabs(ei);
     }
 
-  for (i = 0; i < N; i++)
+  for (i = 0; i < M; i++)
     {
       double ei = gsl_vector_get (eval, i);
       gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
@@ -326,7 +327,7 @@ test_eigen_symm_results (const gsl_matrix * A,
 
   /* check eigenvectors are orthonormal */
 
-  for (i = 0; i < N; i++)
+  for (i = 0; i < M; i++)
     {
       gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
       double nrm_v = gsl_blas_dnrm2(&vi.vector);
@@ -334,10 +335,10 @@ test_eigen_symm_results (const gsl_matrix * A,
                     desc, i, desc2);
     }
 
-  for (i = 0; i < N; i++)
+  for (i = 0; i < M; i++)
     {
       gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
-      for (j = i + 1; j < N; j++)
+      for (j = i + 1; j < M; j++)
         {
           gsl_vector_const_view vj = gsl_matrix_const_column(evec, j);
           double vivj;
@@ -364,6 +365,22 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_matrix * evec = gsl_matrix_alloc(N, N);
   gsl_eigen_symm_workspace * w = gsl_eigen_symm_alloc(N);
   gsl_eigen_symmv_workspace * wv = gsl_eigen_symmv_alloc(N);
+  gsl_eigen_symmdc_workspace * wdc = gsl_eigen_symmdc_alloc(N);
+
+  gsl_matrix_memcpy(A, m);
+
+  gsl_eigen_symmdc(A, evalv, evec, wdc);
+  test_eigen_symm_results(m, evalv, evec, count, desc, "dc unsorted");
+
+  gsl_matrix_memcpy(A, m);
+
+  gsl_eigen_symm(A, eval, w);
+
+  gsl_vector_memcpy(x, eval);
+  gsl_vector_memcpy(y, evalv);
+  gsl_sort_vector(x);
+  gsl_sort_vector(y);
+  test_eigenvalues_real(y, x, desc, "dc unsorted");
 
   gsl_matrix_memcpy(A, m);
 
@@ -401,8 +418,74 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_matrix_free(evec);
   gsl_eigen_symm_free(w);
   gsl_eigen_symmv_free(wv);
+  gsl_eigen_symmdc_free(wdc);
 } /* test_eigen_symm_matrix() */
 
+/* test selected eigenpairs of m by index and by value range */
+void
+test_eigen_symmvx_matrix(const gsl_matrix * m, const size_t il,
+                         const size_t iu, const char * desc)
+{
+  const size_t N = m->size1;
+  const size_t M = iu - il + 1;
+  gsl_matrix * A = gsl_matrix_alloc(N, N);
+  gsl_vector * eval = gsl_vector_alloc(N);
+  gsl_vector * evalx = gsl_vector_alloc(M);
+  gsl_matrix * evecx = gsl_matrix_alloc(N, M);
+  gsl_vector * evalr = gsl_vector_alloc(N);
+  gsl_matrix * evecr = gsl_matrix_alloc(N, N);
+  gsl_eigen_symm_workspace * w = gsl_eigen_symm_alloc(N);
+  gsl_eigen_symmvx_workspace * wx = gsl_eigen_symmvx_alloc(N);
+  gsl_vector_view v;
+  size_t nfound;
+
+  /* reference eigenvalues */
+  gsl_matrix_memcpy(A, m);
+  gsl_eigen_symm(A, eval, w);
+  gsl_sort_vector(eval);
+
+  gsl_matrix_memcpy(A, m);
+  gsl_eigen_symmvx_index(A, il, iu, evalx, evecx, wx);
+  test_eigen_symm_results(m, evalx, evecx, 0, desc, "index");
+
+  v = gsl_vector_subvector(eval, il, M);
+  test_eigenvalues_real(evalx, &v.vector, desc, "index");
+
+  /* choose an interval containing eigenvalues il..iu */
+  {
+    double vl = (il == 0) ? gsl_vector_get(eval, 0) - 1.0 :
+      0.5 * (gsl_vector_get(eval, il - 1) + gsl_vector_get(eval, il));
+    double vu = (iu == N - 1) ? gsl_vector_get(eval, N - 1) + 1.0 :
+      0.5 * (gsl_vector_get(eval, iu) + gsl_vector_get(eval, iu + 1));
+
+    if ((il == 0 || gsl_vector_get(eval, il - 1) < vl) &&
+        (iu == N - 1 || gsl_vector_get(eval, iu + 1) > vu))
+      {
+        gsl_matrix_memcpy(A, m);
+        gsl_eigen_symmvx_range(A, vl, vu, evalr, evecr, &nfound, wx);
+        gsl_test(nfound != M, "%s, range nfound=%d expected=%d",
+                 desc, (int) nfound, (int) M);
+
+        if (nfound == M)
+          {
+            gsl_vector_view er = gsl_vector_subvector(evalr, 0, M);
+            gsl_matrix_view Vr = gsl_matrix_submatrix(evecr, 0, 0, N, M);
+            test_eigen_symm_results(m, &er.vector, &Vr.matrix, 0, desc, "range");
+            test_eigenvalues_real(&er.vector, &v.vector, desc, "range");
+          }
+      }
+  }
+
+  gsl_matrix_free(A);
+  gsl_vector_free(eval);
+  gsl_vector_free(evalx);
+  gsl_matrix_free(evecx);
+  gsl_vector_free(evalr);
+  gsl_matrix_free(evecr);
+  gsl_eigen_symm_free(w);
+  gsl_eigen_symmvx_free(wx);
+} /* test_eigen_symmvx_matrix() */
+
 void
 test_eigen_symm(void)
 {
@@ -418,11 +501,136 @@ test_eigen_symm(void)
         {
           create_random_symm_matrix(A, r, -10, 10);
           test_eigen_symm_matrix(A, i, "symm random");
+          test_eigen_symmvx_matrix(A, n / 3, n - 1 - n / 3, "symmvx random");
         }
 
       gsl_matrix_free(A);
     }
 
+  /* larger matrices exercise the divide and conquer merge */
+  {
+    const size_t sizes[] = { 50, 97, 150 };
+
+    for (n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n)
+      {
+        const size_t N = sizes[n];
+        gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+        create_random_symm_matrix(A, r, -10, 10);
+        test_eigen_symm_matrix(A, 0, "symm random large");
+        test_eigen_symmvx_matrix(A, 0, N / 10, "symmvx random large");
+        test_eigen_symmvx_matrix(A, N - 5, N - 1, "symmvx random large top");
+
+        /* tridiagonal (1,2,1) matrix with known eigenvalues */
+        gsl_matrix_set_zero(A);
+        for (i = 0; i < N; ++i)
+          {
+            gsl_matrix_set(A, i, i, 2.0);
+            if (i + 1 < N)
+              {
+                gsl_matrix_set(A, i, i + 1, 1.0);
+                gsl_matrix_set(A, i + 1, i, 1.0);
+              }
+          }
+        test_eigen_symm_matrix(A, 0, "symm tridiag large");
+        test_eigen_symmvx_matrix(A, N / 2, N / 2 + 3, "symmvx tridiag large");
+
+        /* matrices with repeated eigenvalues exercise deflation */
+        gsl_matrix_set_identity(A);
+        test_eigen_symm_matrix(A, 0, "symm identity large");
+
+        gsl_matrix_set_all(A, 1.0);
+        test_eigen_symm_matrix(A, 0, "symm ones large");
+
+        /* Wilkinson matrix W+, whose eigenvalues come in nearly equal
+           pairs which are deflated by Givens rotations in the merge */
+        gsl_matrix_set_zero(A);
+        for (i = 0; i < N; ++i)
+          {
+            gsl_matrix_set(A, i, i, fabs(i - (N - 1) / 2.0));
+            if (i + 1 < N)
+              {
+                gsl_matrix_set(A, i, i + 1, 1.0);
+                gsl_matrix_set(A, i + 1, i, 1.0);
+              }
+          }
+        test_eigen_symm_matrix(A, 0, "symm wilkinson large");
+        test_eigen_symmvx_matrix(A, N - 4, N - 1, "symmvx wilkinson large");
+
+        /* repeated diagonal entries with tiny off-diagonal coupling */
+        gsl_matrix_set_zero(A);
+        for (i = 0; i < N; ++i)
+          {
+            gsl_matrix_set(A, i, i, (double) (i % 5));
+            if (i + 1 < N)
+              {
+                gsl_matrix_set(A, i, i + 1, 1e-12);
+                gsl_matrix_set(A, i + 1, i, 1e-12);
+              }
+          }
+        test_eigen_symm_matrix(A, 0, "symm tiny offdiag large");
+
+        gsl_matrix_free(A);
+      }
+  }
+
+  /* the value range is closed, eigenvalues at the end points count */
+  {
+    const size_t N = 8;
+    gsl_matrix * A = gsl_matrix_alloc(N, N);
+    gsl_vector * eval = gsl_vector_alloc(N);
+    gsl_eigen_symmvx_workspace * wx = gsl_eigen_symmvx_alloc(N);
+    size_t nfound;
+
+    gsl_matrix_set_zero(A);
+    for (i = 0; i < N; ++i)
+      gsl_matrix_set(A, i, i, i + 1.0);
+
+    gsl_eigen_symmvx_range(A, 3.0, 6.0, eval, NULL, &nfound, wx);
+    gsl_test(nfound != 4, "symmvx range [3,6] nfound=%d expected=4",
+             (int) nfound);
+    if (nfound == 4)
+      {
+        gsl_test_rel(gsl_vector_get(eval, 0), 3.0, GSL_DBL_EPSILON,
+                     "symmvx range [3,6] lower end point");
+        gsl_test_rel(gsl_vector_get(eval, 3), 6.0, 4 * GSL_DBL_EPSILON,
+                     "symmvx range [3,6] upper end point");
+      }
+
+    gsl_matrix_set_zero(A);
+    for (i = 0; i < N; ++i)
+      gsl_matrix_set(A, i, i, i + 1.0);
+
+    gsl_eigen_symmvx_range(A, 5.0, 5.0, eval, NULL, &nfound, wx);
+    gsl_test(nfound != 1, "symmvx range [5,5] nfound=%d expected=1",
+             (int) nfound);
+
+    /* outputs too small for all N eigenpairs are rejected before A
+       is reduced */
+    {
+      gsl_vector_view e4 = gsl_vector_subvector(eval, 0, 4);
+      gsl_error_handler_t * old = gsl_set_error_handler_off();
+      int status;
+
+      gsl_matrix_set_all(A, 0.25);
+      for (i = 0; i < N; ++i)
+        gsl_matrix_set(A, i, i, i + 1.0);
+
+      status = gsl_eigen_symmvx_range(A, 0.0, 10.0, &e4.vector, NULL,
+                                      &nfound, wx);
+      gsl_test(status != GSL_EBADLEN,
+               "symmvx range short eval returns GSL_EBADLEN");
+      gsl_test(gsl_matrix_get(A, N - 1, 0) != 0.25,
+               "symmvx range short eval leaves A unchanged");
+
+      gsl_set_error_handler(old);
+    }
+
+    gsl_eigen_symmvx_free(wx);
+    gsl_vector_free(eval);
+    gsl_matrix_free(A);
+  }
+
   gsl_rng_free(r);
 
   {
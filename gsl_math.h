@@ -19,6 +19,7 @@
 
 #ifndef __GSL_MATH_H__
 #define __GSL_MATH_H__
+#include <stddef.h>
 #include <math.h>
 #include <gsl/gsl_sys.h>
 #include <gsl/gsl_inline.h>
@@ -159,6 +160,19 @@ typedef struct gsl_function_vec_struct gsl_function_vec ;
 
 #define GSL_FN_VEC_EVAL(F,x,y) (*((F)->function))(x,y,(F)->params)
 
+/* Definition of an arbitrary function evaluated at n points at once,
+   y[i] = f(x[i]) for i = 0 ... n-1 */
+
+struct gsl_function_batch_struct 
+{
+  void (* function) (const double x[], size_t n, void * params, double y[]);
+  void * params;
+};
+
+typedef struct gsl_function_batch_struct gsl_function_batch ;
+
+#define GSL_FN_BATCH_EVAL(F,x,n,y) (*((F)->function))(x,n,(F)->params,y)
+
 __END_DECLS
 
 #endif /* __GSL_MATH_H__ */
@@ -18,6 +18,7 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 
@@ -53,3 +54,41 @@ gsl_histogram_accumulate (gsl_histogram * h, double x, double weight)
 
   return GSL_SUCCESS;
 }
+
+int
+gsl_histogram_increment_array (gsl_histogram * h, const double x[],
+                               const size_t n)
+{
+  return gsl_histogram_accumulate_array (h, x, NULL, n);
+}
+
+/* Add the samples x[k] with weights w[k] (or 1 if w is NULL), computing
+   the scale factor for the bin search once.  Samples outside the range
+   of the histogram are skipped and reported by a return value of
+   GSL_EDOM after all the others have been added. */
+
+int
+gsl_histogram_accumulate_array (gsl_histogram * h, const double x[],
+                                const double w[], const size_t n)
+{
+  const size_t nbins = h->n;
+  const double scale = nbins / (h->range[nbins] - h->range[0]);
+  int result = GSL_SUCCESS;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      size_t index = 0;
+      int status = find_scaled (nbins, h->range, scale, x[k], &index);
+
+      if (status)
+        {
+          result = GSL_EDOM;
+          continue;
+        }
+
+      h->bin[index] += (w == NULL) ? 1.0 : w[k];
+    }
+
+  return result;
+}
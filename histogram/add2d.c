@@ -64,3 +64,42 @@ gsl_histogram2d_accumulate (gsl_histogram2d * h,
 
   return GSL_SUCCESS;
 }
+
+int
+gsl_histogram2d_increment_array (gsl_histogram2d * h, const double x[],
+                                 const double y[], const size_t n)
+{
+  return gsl_histogram2d_accumulate_array (h, x, y, NULL, n);
+}
+
+/* Add the samples (x[k], y[k]) with weights w[k], or 1 if w is NULL,
+   as for gsl_histogram_accumulate_array */
+
+int
+gsl_histogram2d_accumulate_array (gsl_histogram2d * h, const double x[],
+                                  const double y[], const double w[],
+                                  const size_t n)
+{
+  const size_t nx = h->nx;
+  const size_t ny = h->ny;
+  const double xscale = nx / (h->xrange[nx] - h->xrange[0]);
+  const double yscale = ny / (h->yrange[ny] - h->yrange[0]);
+  int result = GSL_SUCCESS;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      size_t i = 0, j = 0;
+
+      if (find_scaled (nx, h->xrange, xscale, x[k], &i)
+          || find_scaled (ny, h->yrange, yscale, y[k], &j))
+        {
+          result = GSL_EDOM;
+          continue;
+        }
+
+      h->bin[i * ny + j] += (w == NULL) ? 1.0 : w[k];
+    }
+
+  return result;
+}
@@ -23,8 +23,22 @@
 static int find (const size_t n, const double range[], 
                  const double x, size_t * i);
 
+static int find_scaled (const size_t n, const double range[],
+                        const double scale, const double x, size_t * i);
+
 static int
 find (const size_t n, const double range[], const double x, size_t * i)
+{
+  return find_scaled (n, range, n / (range[n] - range[0]), x, i);
+}
+
+/* as find(), with the factor scale = n / (range[n] - range[0]) used
+   for the linear guess supplied by the caller, so that it can be
+   computed once when many values are binned */
+
+static int
+find_scaled (const size_t n, const double range[], const double scale,
+             const double x, size_t * i)
 {
   size_t i_linear, lower, upper, mid;
 
@@ -41,12 +55,9 @@ find (const size_t n, const double range[], const double x, size_t * i)
   /* optimize for linear case */
 
 #ifdef LINEAR_OPT
-  {
-    double u =  (x - range[0]) / (range[n] - range[0]);
-    i_linear = (size_t) (u * n);
-  }
+  i_linear = (size_t) ((x - range[0]) * scale);
 
-  if (x >= range[i_linear] && x < range[i_linear + 1])
+  if (i_linear < n && x >= range[i_linear] && x < range[i_linear + 1])
     {
       *i = i_linear;
       return 0;
@@ -83,4 +94,3 @@ find (const size_t n, const double range[], const double x, size_t * i)
 
   return 0;
 }
-
@@ -60,6 +60,11 @@ void gsl_histogram2d_free (gsl_histogram2d * h);
 int gsl_histogram2d_increment (gsl_histogram2d * h, double x, double y);
 int gsl_histogram2d_accumulate (gsl_histogram2d * h, 
                                 double x, double y, double weight);
+int gsl_histogram2d_increment_array (gsl_histogram2d * h, const double x[],
+                                     const double y[], const size_t n);
+int gsl_histogram2d_accumulate_array (gsl_histogram2d * h, const double x[],
+                                      const double y[], const double w[],
+                                      const size_t n);
 int gsl_histogram2d_find (const gsl_histogram2d * h, 
                           const double x, const double y, size_t * i, size_t * j);
 
@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_ieee_utils.h>
@@ -476,6 +477,63 @@ test1d (void)
     fclose (f);
   }
 
+  {
+    double x[NR * 7], w[NR * 7];
+    gsl_histogram *ha = gsl_histogram_calloc_uniform (N, -1.0, 11.0);
+    gsl_histogram *hb = gsl_histogram_calloc_uniform (N, -1.0, 11.0);
+    gsl_histogram *hra = gsl_histogram_calloc_range (NR, xr);
+    gsl_histogram *hrb = gsl_histogram_calloc_range (NR, xr);
+    int status = 0, s1, s2;
+
+    for (i = 0; i < NR * 7; i++)
+      {
+        x[i] = -2.0 + 0.2 * (i * 37 % (NR * 7));
+        w[i] = 0.5 + i;
+      }
+
+    s1 = gsl_histogram_increment_array (ha, x, NR * 7);
+
+    for (i = 0; i < NR * 7; i++)
+      gsl_histogram_increment (hb, x[i]);
+
+    gsl_test (s1 != GSL_EDOM,
+              "gsl_histogram_increment_array reports out of range values");
+
+    for (i = 0; i < N; i++)
+      {
+        if (ha->bin[i] != hb->bin[i])
+          status = 1;
+      }
+
+    gsl_test (status, "gsl_histogram_increment_array uniform");
+
+    status = 0;
+    s1 = gsl_histogram_accumulate_array (hra, x, w, NR * 7);
+    s2 = gsl_histogram_accumulate_array (hra, xr, NULL, NR);
+
+    for (i = 0; i < NR * 7; i++)
+      gsl_histogram_accumulate (hrb, x[i], w[i]);
+
+    for (i = 0; i < NR; i++)
+      gsl_histogram_increment (hrb, xr[i]);
+
+    gsl_test (s1 != GSL_EDOM || s2 != GSL_SUCCESS,
+              "gsl_histogram_accumulate_array return values");
+
+    for (i = 0; i < NR; i++)
+      {
+        if (hra->bin[i] != hrb->bin[i])
+          status = 1;
+      }
+
+    gsl_test (status, "gsl_histogram_accumulate_array range");
+
+    gsl_histogram_free (ha);
+    gsl_histogram_free (hb);
+    gsl_histogram_free (hra);
+    gsl_histogram_free (hrb);
+  }
+
   gsl_histogram_free (h);
   gsl_histogram_free (g);
   gsl_histogram_free (h1);
@@ -746,6 +746,47 @@ test2d (void)
     fclose (f);
   }
 
+  {
+    double x[M1 * N1], y[M1 * N1], w[M1 * N1];
+    gsl_histogram2d *ha = gsl_histogram2d_calloc_range (MR, NR, xr, yr);
+    gsl_histogram2d *hb = gsl_histogram2d_calloc_range (MR, NR, xr, yr);
+    int status = 0, s1;
+
+    for (k = 0; k < M1 * N1; k++)
+      {
+        x[k] = -1.0 + 0.05 * (k * 13 % (M1 * N1));
+        y[k] = 89.5 + 0.03 * (k * 29 % (M1 * N1));
+        w[k] = 0.25 * k;
+      }
+
+    s1 = gsl_histogram2d_increment_array (ha, x, y, M1 * N1);
+
+    for (k = 0; k < M1 * N1; k++)
+      gsl_histogram2d_increment (hb, x[k], y[k]);
+
+    gsl_test (s1 != GSL_EDOM,
+              "gsl_histogram2d_increment_array reports out of range values");
+
+    s1 = gsl_histogram2d_accumulate_array (ha, x, y, w, M1 * N1);
+
+    for (k = 0; k < M1 * N1; k++)
+      gsl_histogram2d_accumulate (hb, x[k], y[k], w[k]);
+
+    gsl_test (s1 != GSL_EDOM,
+              "gsl_histogram2d_accumulate_array reports out of range values");
+
+    for (k = 0; k < MR * NR; k++)
+      {
+        if (ha->bin[k] != hb->bin[k])
+          status = 1;
+      }
+
+    gsl_test (status, "gsl_histogram2d_increment_array and accumulate_array");
+
+    gsl_histogram2d_free (ha);
+    gsl_histogram2d_free (hb);
+  }
+
   gsl_histogram2d_free (h);
   gsl_histogram2d_free (h1);
   gsl_histogram2d_free (g);
@@ -184,8 +184,44 @@ downdate (double *c, int n, int d, int *nans, int nnans)
 }
 
 
-/* The actual integration routine.
-    */
+/* Evaluate the function at the nodes m + xi[i] * h for i = i0, i0 + di,
+    ... <= i1, storing the values in fx[i].  Returns the number of
+    evaluations. */
+
+static int
+eval_nodes (const gsl_function * f, const gsl_function_batch * fb,
+	    double m, double h, int i0, int i1, int di, double *fx)
+{
+
+  int i, k = 0;
+
+  if (fb == NULL)
+    {
+      for (i = i0; i <= i1; i += di, k++)
+	fx[i] = GSL_FN_EVAL (f, m + xi[i] * h);
+    }
+  else
+    {
+      double x[33] = { 0 }, y[33] = { 0 };
+
+      for (i = i0; i <= i1; i += di)
+	x[k++] = m + xi[i] * h;
+
+      GSL_FN_BATCH_EVAL (fb, x, (size_t) k, y);
+
+      for (i = i0, k = 0; i <= i1; i += di)
+	fx[i] = y[k++];
+    }
+
+  return k;
+
+}
+
+
+static int cquad (const gsl_function * f, const gsl_function_batch * fb,
+		  double a, double b, double epsabs, double epsrel,
+		  gsl_integration_cquad_workspace * ws,
+		  double *result, double *abserr, size_t * nevals);
 
 int
 gsl_integration_cquad (const gsl_function * f, double a, double b,
@@ -194,6 +230,42 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 		       double *result, double *abserr, size_t * nevals)
 {
 
+  /* Check the input arguments. */
+  if (f == NULL)
+    GSL_ERROR ("function pointer shouldn't be NULL", GSL_EINVAL);
+
+  return cquad (f, NULL, a, b, epsabs, epsrel, ws, result, abserr, nevals);
+
+}
+
+
+int
+gsl_integration_cquad_batch (const gsl_function_batch * f,
+			     double a, double b,
+			     double epsabs, double epsrel,
+			     gsl_integration_cquad_workspace * ws,
+			     double *result, double *abserr, size_t * nevals)
+{
+
+  /* Check the input arguments. */
+  if (f == NULL)
+    GSL_ERROR ("function pointer shouldn't be NULL", GSL_EINVAL);
+
+  return cquad (NULL, f, a, b, epsabs, epsrel, ws, result, abserr, nevals);
+
+}
+
+
+/* The actual integration routine.
+    */
+
+static int
+cquad (const gsl_function * f, const gsl_function_batch * fb,
+       double a, double b, double epsabs, double epsrel,
+       gsl_integration_cquad_workspace * ws,
+       double *result, double *abserr, size_t * nevals)
+{
+
   /* Some constants that we will need. */
   static const int n[4] = { 4, 8, 16, 32 };
   static const int skip[4] = { 8, 4, 2, 1 };
@@ -211,8 +283,6 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
   double nc, ncdiff;
 
   /* Check the input arguments. */
-  if (f == NULL)
-    GSL_ERROR ("function pointer shouldn't be NULL", GSL_EINVAL);
   if (result == NULL)
     GSL_ERROR ("result pointer shouldn't be NULL", GSL_EINVAL);
   if (ws == NULL)
@@ -231,10 +301,9 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
   m = (a + b) / 2;
   h = (b - a) / 2;
   nnans = 0;
+  neval += eval_nodes (f, fb, m, h, 0, n[3], 1, iv->fx);
   for (i = 0; i <= n[3]; i++)
     {
-      iv->fx[i] = GSL_FN_EVAL (f, m + xi[i] * h);
-      neval++;
       if (!gsl_finite (iv->fx[i]))
 	{
 	  nans[nnans++] = i;
@@ -311,11 +380,7 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 	  d = ++iv->depth;
 
 	  /* Get the new (missing) function values */
-	  for (i = skip[d]; i <= 32; i += 2 * skip[d])
-	    {
-	      iv->fx[i] = GSL_FN_EVAL (f, m + xi[i] * h);
-	      neval++;
-	    }
+	  neval += eval_nodes (f, fb, m, h, skip[d], 32, 2 * skip[d], iv->fx);
 	  nnans = 0;
 	  for (i = 0; i <= 32; i += skip[d])
 	    {
@@ -435,12 +500,8 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 	  ivl->rdepth = iv->rdepth + 1;
 	  ivl->fx[0] = iv->fx[0];
 	  ivl->fx[32] = iv->fx[16];
-	  for (i = skip[0]; i < 32; i += skip[0])
-	    {
-	      ivl->fx[i] =
-		GSL_FN_EVAL (f, (ivl->a + ivl->b) / 2 + xi[i] * h / 2);
-	      neval++;
-	    }
+	  neval += eval_nodes (f, fb, (ivl->a + ivl->b) / 2, h / 2,
+			       skip[0], 31, skip[0], ivl->fx);
 	  nnans = 0;
 	  for (i = 0; i <= 32; i += skip[0])
 	    {
@@ -501,12 +562,8 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 	  ivr->rdepth = iv->rdepth + 1;
 	  ivr->fx[0] = iv->fx[16];
 	  ivr->fx[32] = iv->fx[32];
-	  for (i = skip[0]; i < 32; i += skip[0])
-	    {
-	      ivr->fx[i] =
-		GSL_FN_EVAL (f, (ivr->a + ivr->b) / 2 + xi[i] * h / 2);
-	      neval++;
-	    }
+	  neval += eval_nodes (f, fb, (ivr->a + ivr->b) / 2, h / 2,
+			       skip[0], 31, skip[0], ivr->fx);
 	  nnans = 0;
 	  for (i = 0; i <= 32; i += skip[0])
 	    {
@@ -148,6 +148,44 @@ void gsl_integration_qk61 (const gsl_function * f, double a, double b,
                            double *result, double *abserr,
                            double *resabs, double *resasc);
 
+/* Integration rules for batched functions, evaluating all the nodes
+   of the rule in a single call */
+
+typedef void gsl_integration_rule_batch (const gsl_function_batch * f,
+                                         double a, double b,
+                                         double *result, double *abserr,
+                                         double *defabs, double *resabs);
+
+void gsl_integration_qk15_batch (const gsl_function_batch * f, 
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk21_batch (const gsl_function_batch * f, 
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk31_batch (const gsl_function_batch * f, 
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk41_batch (const gsl_function_batch * f, 
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk51_batch (const gsl_function_batch * f, 
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk61_batch (const gsl_function_batch * f, 
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
 void gsl_integration_qcheb (gsl_function * f, double a, double b, 
                             double *cheb12, double *cheb24);
 
@@ -172,6 +210,14 @@ gsl_integration_qk (const int n, const double xgk[],
                     double * result, double * abserr, 
                     double * resabs, double * resasc);
 
+void 
+gsl_integration_qk_batch (const int n, const double xgk[], 
+                          const double wg[], const double wgk[],
+                          double fv1[], double fv2[],
+                          const gsl_function_batch *f, double a, double b,
+                          double * result, double * abserr, 
+                          double * resabs, double * resasc);
+
 
 int gsl_integration_qng (const gsl_function * f,
                          double a, double b,
@@ -186,6 +232,13 @@ int gsl_integration_qag (const gsl_function * f,
                          gsl_integration_workspace * workspace,
                          double *result, double *abserr);
 
+int gsl_integration_qag_batch (const gsl_function_batch * f,
+                               double a, double b,
+                               double epsabs, double epsrel, size_t limit,
+                               int key,
+                               gsl_integration_workspace * workspace,
+                               double *result, double *abserr);
+
 int gsl_integration_qagi (gsl_function * f,
                           double epsabs, double epsrel, size_t limit,
                           gsl_integration_workspace * workspace,
@@ -210,12 +263,24 @@ int gsl_integration_qags (const gsl_function * f,
                           gsl_integration_workspace * workspace,
                           double *result, double *abserr);
 
+int gsl_integration_qags_batch (const gsl_function_batch * f,
+                                double a, double b,
+                                double epsabs, double epsrel, size_t limit,
+                                gsl_integration_workspace * workspace,
+                                double *result, double *abserr);
+
 int gsl_integration_qagp (const gsl_function * f,
                           double *pts, size_t npts,
                           double epsabs, double epsrel, size_t limit,
                           gsl_integration_workspace * workspace,
                           double *result, double *abserr);
 
+int gsl_integration_qagp_batch (const gsl_function_batch * f,
+                                double *pts, size_t npts,
+                                double epsabs, double epsrel, size_t limit,
+                                gsl_integration_workspace * workspace,
+                                double *result, double *abserr);
+
 int gsl_integration_qawc (gsl_function *f,
                           const double a, const double b, const double c,
                           const double epsabs, const double epsrel, const size_t limit,
@@ -317,6 +382,12 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 		       gsl_integration_cquad_workspace * ws,
 		       double *result, double *abserr, size_t * nevals);
 
+int
+gsl_integration_cquad_batch (const gsl_function_batch * f, 
+			     double a, double b,
+			     double epsabs, double epsrel,
+			     gsl_integration_cquad_workspace * ws,
+			     double *result, double *abserr, size_t * nevals);
 
 __END_DECLS
 
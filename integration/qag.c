@@ -27,15 +27,15 @@
 #include "set_initial.c"
 #include "qpsrt.c"
 #include "util.c"
+#include "rule.c"
 
 static int
-qag (const gsl_function *f,
+qag (const integ_rule * r,
      const double a, const double b,
      const double epsabs, const double epsrel,
      const size_t limit,
      gsl_integration_workspace * workspace,
-     double * result, double * abserr,
-     gsl_integration_rule * q) ;
+     double * result, double * abserr) ;
 
 int
 gsl_integration_qag (const gsl_function *f,
@@ -82,22 +82,80 @@ gsl_integration_qag (const gsl_function *f,
                 GSL_EINVAL) ;
     }
 
-  status = qag (f, a, b, epsabs, epsrel, limit,
-                workspace, 
-                result, abserr, 
-                integration_rule) ;
+  {
+    integ_rule r = rule_function (f, integration_rule);
+
+    status = qag (&r, a, b, epsabs, epsrel, limit,
+                  workspace, 
+                  result, abserr) ;
+  }
+  
+  return status ;
+}
+
+int
+gsl_integration_qag_batch (const gsl_function_batch *f,
+                           double a, double b,
+                           double epsabs, double epsrel, size_t limit,
+                           int key,
+                           gsl_integration_workspace * workspace,
+                           double * result, double * abserr)
+{
+  int status ;
+  gsl_integration_rule_batch * integration_rule = gsl_integration_qk15_batch ;
+
+  if (key < GSL_INTEG_GAUSS15)
+    {
+      key = GSL_INTEG_GAUSS15 ;
+    } 
+  else if (key > GSL_INTEG_GAUSS61) 
+    {
+      key = GSL_INTEG_GAUSS61 ;
+    }
+
+  switch (key) 
+    {
+    case GSL_INTEG_GAUSS15:
+      integration_rule = gsl_integration_qk15_batch ;
+      break ;
+    case GSL_INTEG_GAUSS21:
+      integration_rule = gsl_integration_qk21_batch ;
+      break ;
+    case GSL_INTEG_GAUSS31:
+      integration_rule = gsl_integration_qk31_batch ; 
+      break ;
+    case GSL_INTEG_GAUSS41:
+      integration_rule = gsl_integration_qk41_batch ;
+      break ;      
+    case GSL_INTEG_GAUSS51:
+      integration_rule = gsl_integration_qk51_batch ;
+      break ;      
+    case GSL_INTEG_GAUSS61:
+      integration_rule = gsl_integration_qk61_batch ;
+      break ;      
+    default:
+      GSL_ERROR("value of key does specify a known integration rule", 
+                GSL_EINVAL) ;
+    }
+
+  {
+    integ_rule r = rule_batch (f, integration_rule);
+
+    status = qag (&r, a, b, epsabs, epsrel, limit,
+                  workspace, 
+                  result, abserr) ;
+  }
   
   return status ;
 }
 
 static int
-qag (const gsl_function * f,
+qag (const integ_rule * r,
      const double a, const double b,
      const double epsabs, const double epsrel,
      const size_t limit,
      gsl_integration_workspace * workspace,
-     double *result, double *abserr,
-     gsl_integration_rule * q)
+     double *result, double *abserr)
 {
   double area, errsum;
   double result0, abserr0, resabs0, resasc0;
@@ -127,7 +185,7 @@ qag (const gsl_function * f,
 
   /* perform the first integration */
 
-  q (f, a, b, &result0, &abserr0, &resabs0, &resasc0);
+  apply_rule (r, a, b, &result0, &abserr0, &resabs0, &resasc0);
 
   set_initial_result (workspace, result0, abserr0);
 
@@ -185,8 +243,8 @@ qag (const gsl_function * f,
       a2 = b1;
       b2 = b_i;
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
-      q (f, a2, b2, &area2, &error2, &resabs2, &resasc2);
+      apply_rule (r, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      apply_rule (r, a2, b2, &area2, &error2, &resabs2, &resasc2);
 
       area12 = area1 + area2;
       error12 = error1 + error2;
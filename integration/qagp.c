@@ -22,13 +22,14 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_integration.h>
 
+#include "rule.c"
+
 static int
-qagp (const gsl_function *f,
+qagp (const integ_rule * r,
       const double *pts, const size_t npts,
       const double epsabs, const double epsrel, const size_t limit,
       gsl_integration_workspace * workspace,
-      double *result, double *abserr,
-      gsl_integration_rule * q);
+      double *result, double *abserr);
 
 #include "initialise.c"
 #include "qpsrt.c"
@@ -47,24 +48,39 @@ gsl_integration_qagp (const gsl_function *f,
                       gsl_integration_workspace * workspace,
                       double * result, double * abserr)
 {
-  int status = qagp (f, pts, npts,  
+  integ_rule r = rule_function (f, &gsl_integration_qk21);
+  int status = qagp (&r, pts, npts,  
+                     epsabs, epsrel, limit,
+                     workspace,
+                     result, abserr) ;
+  
+  return status ;
+}
+
+int
+gsl_integration_qagp_batch (const gsl_function_batch *f,
+                            double * pts, size_t npts,
+                            double epsabs, double epsrel, size_t limit,
+                            gsl_integration_workspace * workspace,
+                            double * result, double * abserr)
+{
+  integ_rule r = rule_batch (f, &gsl_integration_qk21_batch);
+  int status = qagp (&r, pts, npts,  
                      epsabs, epsrel, limit,
                      workspace,
-                     result, abserr,
-                     &gsl_integration_qk21) ;
+                     result, abserr) ;
   
   return status ;
 }
 
 
 static int
-qagp (const gsl_function * f,
+qagp (const integ_rule * r,
       const double *pts, const size_t npts,
       const double epsabs, const double epsrel, 
       const size_t limit,
       gsl_integration_workspace * workspace,
-      double *result, double *abserr,
-      gsl_integration_rule * q)
+      double *result, double *abserr)
 {
   double area, errsum;
   double res_ext, err_ext;
@@ -140,7 +156,7 @@ qagp (const gsl_function * f,
       const double a1 = pts[i];
       const double b1 = pts[i + 1];
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      apply_rule (r, a1, b1, &area1, &error1, &resabs1, &resasc1);
 
       result0 = result0 + area1;
       abserr0 = abserr0 + error1;
@@ -251,8 +267,8 @@ qagp (const gsl_function * f,
 
       iteration++;
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
-      q (f, a2, b2, &area2, &error2, &resabs2, &resasc2);
+      apply_rule (r, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      apply_rule (r, a2, b2, &area2, &error2, &resabs2, &resasc2);
 
       area12 = area1 + area2;
       error12 = error1 + error2;
@@ -20,9 +20,22 @@
 #include <config.h>
 #include <float.h>
 #include <math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_integration.h>
 #include "err.c"
 
+/* maximum number of points of a rule evaluated in a single batch */
+#define QK_BATCH_MAX 61
+
+static void
+qk (const int n, 
+    const double xgk[], const double wg[], const double wgk[],
+    double fv1[], double fv2[],
+    const gsl_function * f, const gsl_function_batch * fb,
+    double a, double b,
+    double *result, double *abserr,
+    double *resabs, double *resasc);
+
 void
 gsl_integration_qk (const int n, 
                     const double xgk[], const double wg[], const double wgk[],
@@ -31,21 +44,103 @@ gsl_integration_qk (const int n,
                     double *result, double *abserr,
                     double *resabs, double *resasc)
 {
+  qk (n, xgk, wg, wgk, fv1, fv2, f, 0, a, b, 
+      result, abserr, resabs, resasc);
+}
+
+void
+gsl_integration_qk_batch (const int n, 
+                          const double xgk[], const double wg[], 
+                          const double wgk[],
+                          double fv1[], double fv2[],
+                          const gsl_function_batch * f, double a, double b,
+                          double *result, double *abserr,
+                          double *resabs, double *resasc)
+{
+  if (2 * n - 1 > QK_BATCH_MAX)
+    {
+      GSL_ERROR_VOID ("rule has too many points for batched evaluation",
+                      GSL_EINVAL);
+    }
+
+  qk (n, xgk, wg, wgk, fv1, fv2, 0, f, a, b, 
+      result, abserr, resabs, resasc);
+}
+
+static void
+qk (const int n, 
+    const double xgk[], const double wg[], const double wgk[],
+    double fv1[], double fv2[],
+    const gsl_function * f, const gsl_function_batch * fb,
+    double a, double b,
+    double *result, double *abserr,
+    double *resabs, double *resasc)
+{
 
   const double center = 0.5 * (a + b);
   const double half_length = 0.5 * (b - a);
   const double abs_half_length = fabs (half_length);
-  const double f_center = GSL_FN_EVAL (f, center);
+  double f_center;
 
   double result_gauss = 0;
-  double result_kronrod = f_center * wgk[n - 1];
+  double result_kronrod;
 
-  double result_abs = fabs (result_kronrod);
+  double result_abs;
   double result_asc = 0;
   double mean = 0, err = 0;
 
   int j;
 
+  /* evaluate the function at the center and at the pairs of nodes
+     center -/+ abscissa, storing the values in fv1 and fv2 */
+
+  if (fb == 0)
+    {
+      f_center = GSL_FN_EVAL (f, center);
+
+      for (j = 0; j < (n - 1) / 2; j++)
+        {
+          const int jtw = j * 2 + 1;
+          const double abscissa = half_length * xgk[jtw];
+          fv1[jtw] = GSL_FN_EVAL (f, center - abscissa);
+          fv2[jtw] = GSL_FN_EVAL (f, center + abscissa);
+        }
+
+      for (j = 0; j < n / 2; j++)
+        {
+          const int jtwm1 = j * 2;
+          const double abscissa = half_length * xgk[jtwm1];
+          fv1[jtwm1] = GSL_FN_EVAL (f, center - abscissa);
+          fv2[jtwm1] = GSL_FN_EVAL (f, center + abscissa);
+        }
+    }
+  else
+    {
+      double x[QK_BATCH_MAX], y[QK_BATCH_MAX];
+
+      x[0] = center;
+
+      for (j = 0; j < n - 1; j++)
+        {
+          const double abscissa = half_length * xgk[j];
+          x[2 * j + 1] = center - abscissa;
+          x[2 * j + 2] = center + abscissa;
+        }
+
+      GSL_FN_BATCH_EVAL (fb, x, (size_t) (2 * n - 1), y);
+
+      f_center = y[0];
+
+      for (j = 0; j < n - 1; j++)
+        {
+          fv1[j] = y[2 * j + 1];
+          fv2[j] = y[2 * j + 2];
+        }
+    }
+
+  result_kronrod = f_center * wgk[n - 1];
+  result_abs = fabs (result_kronrod);
+
   if (n % 2 == 0)
     {
       result_gauss = f_center * wg[n / 2 - 1];
@@ -54,12 +149,9 @@ gsl_integration_qk (const int n,
   for (j = 0; j < (n - 1) / 2; j++)
     {
       const int jtw = j * 2 + 1;  /* in original fortran j=1,2,3 jtw=2,4,6 */
-      const double abscissa = half_length * xgk[jtw];
-      const double fval1 = GSL_FN_EVAL (f, center - abscissa);
-      const double fval2 = GSL_FN_EVAL (f, center + abscissa);
+      const double fval1 = fv1[jtw];
+      const double fval2 = fv2[jtw];
       const double fsum = fval1 + fval2;
-      fv1[jtw] = fval1;
-      fv2[jtw] = fval2;
       result_gauss += wg[j] * fsum;
       result_kronrod += wgk[jtw] * fsum;
       result_abs += wgk[jtw] * (fabs (fval1) + fabs (fval2));
@@ -68,11 +160,8 @@ gsl_integration_qk (const int n,
   for (j = 0; j < n / 2; j++)
     {
       int jtwm1 = j * 2;
-      const double abscissa = half_length * xgk[jtwm1];
-      const double fval1 = GSL_FN_EVAL (f, center - abscissa);
-      const double fval2 = GSL_FN_EVAL (f, center + abscissa);
-      fv1[jtwm1] = fval1;
-      fv2[jtwm1] = fval2;
+      const double fval1 = fv1[jtwm1];
+      const double fval2 = fv2[jtwm1];
       result_kronrod += wgk[jtwm1] * (fval1 + fval2);
       result_abs += wgk[jtwm1] * (fabs (fval1) + fabs (fval2));
     };
@@ -68,3 +68,12 @@ gsl_integration_qk15 (const gsl_function * f, double a, double b,
   gsl_integration_qk (8, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
 
+void
+gsl_integration_qk15_batch (const gsl_function_batch * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double fv1[8], fv2[8];
+  gsl_integration_qk_batch (8, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
+}
+
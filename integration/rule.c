@@ -0,0 +1,67 @@
+/* integration/rule.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A Gauss-Kronrod rule bound to its integrand, which is either an
+   ordinary gsl_function (f, q) or a batched function (fb, qb) */
+
+typedef struct
+{
+  const gsl_function * f;
+  gsl_integration_rule * q;
+  const gsl_function_batch * fb;
+  gsl_integration_rule_batch * qb;
+}
+integ_rule;
+
+static void
+apply_rule (const integ_rule * r, double a, double b,
+            double *result, double *abserr,
+            double *resabs, double *resasc)
+{
+  if (r->fb != 0)
+    {
+      r->qb (r->fb, a, b, result, abserr, resabs, resasc);
+    }
+  else
+    {
+      r->q (r->f, a, b, result, abserr, resabs, resasc);
+    }
+}
+
+static integ_rule
+rule_function (const gsl_function * f, gsl_integration_rule * q)
+{
+  integ_rule r;
+  r.f = f;
+  r.q = q;
+  r.fb = 0;
+  r.qb = 0;
+  return r;
+}
+
+static integ_rule
+rule_batch (const gsl_function_batch * fb, gsl_integration_rule_batch * qb)
+{
+  integ_rule r;
+  r.f = 0;
+  r.q = 0;
+  r.fb = fb;
+  r.qb = qb;
+  return r;
+}
@@ -70,6 +70,44 @@ gsl_function make_counter (gsl_function * f, struct counter_params * p)
   return f_new;
 }
 
+struct batch_params {
+  gsl_function * f;
+  int ncalls;
+  int neval;
+} ;
+
+void batch (const double x[], size_t n, void * params, double y[]);
+gsl_function_batch make_batch (gsl_function * f, struct batch_params * p);
+
+void
+batch (const double x[], size_t n, void * params, double y[])
+{
+  struct batch_params * p = (struct batch_params *) params;
+  size_t i;
+
+  p->ncalls++ ;
+  
+  for (i = 0; i < n; i++)
+    {
+      p->neval++ ;
+      y[i] = GSL_FN_EVAL(p->f, x[i]);
+    }
+}
+
+gsl_function_batch make_batch (gsl_function * f, struct batch_params * p)
+{
+  gsl_function_batch f_new;
+
+  p->f = f;
+  p->ncalls = 0 ;
+  p->neval = 0 ;
+  
+  f_new.function = &batch ;
+  f_new.params = p ;
+
+  return f_new;
+}
+
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
@@ -2371,8 +2409,69 @@ int main (void)
       gsl_test (fabs(result - exact) > 5.0 * abserr, "cquad f%d error (%g actual vs %g estimated)", fid, fabs(result-exact), abserr);
       gsl_test_int (status, GSL_SUCCESS, "cquad return code");
 
+      /* The batched integrand must give identical results */
+      {
+        struct batch_params p;
+        gsl_function_batch fb = make_batch (&f, &p);
+        double result_b, abserr_b;
+        size_t neval_b;
+        int status_b = gsl_integration_cquad_batch (&fb, ranges[2*fid], ranges[2*fid+1], 0.0, 1.0e-12, ws, &result_b, &abserr_b, &neval_b);
+
+        gsl_test_int (status_b, status, "cquad_batch f%d return code", fid);
+        gsl_test_rel (result_b, result, 0.0, "cquad_batch f%d result", fid);
+        gsl_test_rel (abserr_b, abserr, 0.0, "cquad_batch f%d abserr", fid);
+        gsl_test_int (neval_b, neval, "cquad_batch f%d neval", fid);
+        gsl_test_int (p.neval, neval, "cquad_batch f%d function evaluations", fid);
+        gsl_test (p.ncalls >= p.neval, "cquad_batch f%d batched calls (%d for %d points)", fid, p.ncalls, p.neval);
+      }
+
       gsl_integration_cquad_workspace_free(ws);
     }
+
+    /* Test the batched QUADPACK routines against the ordinary ones on
+       the same functions */
+
+    for ( fid = 0 ; fid < 25 ; fid++ ) {
+      gsl_integration_workspace * w = gsl_integration_workspace_alloc (1000);
+      gsl_function f = make_function(funs[fid], NULL);
+      const double a = ranges[2*fid], b = ranges[2*fid+1];
+      double result_b, abserr_b;
+      int key, status, status_b;
+      struct batch_params p;
+      gsl_function_batch fb = make_batch (&f, &p);
+
+      for (key = GSL_INTEG_GAUSS15; key <= GSL_INTEG_GAUSS61; key++)
+        {
+          status = gsl_integration_qag (&f, a, b, 0.0, 1e-10, 1000, key, w, &result, &abserr);
+          status_b = gsl_integration_qag_batch (&fb, a, b, 0.0, 1e-10, 1000, key, w, &result_b, &abserr_b);
+          gsl_test_int (status_b, status, "qag_batch f%d key %d return code", fid, key);
+          gsl_test_rel (result_b, result, 0.0, "qag_batch f%d key %d result", fid, key);
+          gsl_test_rel (abserr_b, abserr, 0.0, "qag_batch f%d key %d abserr", fid, key);
+        }
+
+      status = gsl_integration_qags (&f, a, b, 0.0, 1e-10, 1000, w, &result, &abserr);
+      p.ncalls = p.neval = 0;
+      status_b = gsl_integration_qags_batch (&fb, a, b, 0.0, 1e-10, 1000, w, &result_b, &abserr_b);
+      gsl_test_int (status_b, status, "qags_batch f%d return code", fid);
+      gsl_test_rel (result_b, result, 0.0, "qags_batch f%d result", fid);
+      gsl_test_rel (abserr_b, abserr, 0.0, "qags_batch f%d abserr", fid);
+      gsl_test_int (p.neval, 21 * p.ncalls, "qags_batch f%d points per call", fid);
+
+      {
+        double pts[3];
+        pts[0] = a;
+        pts[1] = a + (b - a) / 3;
+        pts[2] = b;
+
+        status = gsl_integration_qagp (&f, pts, 3, 0.0, 1e-10, 1000, w, &result, &abserr);
+        status_b = gsl_integration_qagp_batch (&fb, pts, 3, 0.0, 1e-10, 1000, w, &result_b, &abserr_b);
+        gsl_test_int (status_b, status, "qagp_batch f%d return code", fid);
+        gsl_test_rel (result_b, result, 0.0, "qagp_batch f%d result", fid);
+        gsl_test_rel (abserr_b, abserr, 0.0, "qagp_batch f%d abserr", fid);
+      }
+
+      gsl_integration_workspace_free (w);
+    }
   }        
 
 
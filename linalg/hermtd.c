@@ -57,6 +57,19 @@
 
 #include <gsl/gsl_linalg.h>
 
+/* For large matrices the reduction is blocked as in LAPACK's
+ * zhetrd, see symmtd.c for details: panels of HERMTD_BLOCKSIZE
+ * columns are reduced with level-2 operations (zlatrd) and the
+ * trailing submatrix is updated with a rank-2k update (zher2k). */
+
+#define HERMTD_BLOCKSIZE 32
+#define HERMTD_CROSSOVER 128
+
+static void hermtd_decomp_L2 (gsl_matrix_complex * A,
+                              gsl_vector_complex * tau, const size_t k0);
+static void hermtd_panel (gsl_matrix_complex * A, gsl_vector_complex * tau,
+                          const size_t k0, gsl_matrix_complex * W);
+
 int 
 gsl_linalg_hermtd_decomp (gsl_matrix_complex * A, gsl_vector_complex * tau)  
 {
@@ -72,55 +85,194 @@ gsl_linalg_hermtd_decomp (gsl_matrix_complex * A, gsl_vector_complex * tau)
   else
     {
       const size_t N = A->size1;
-      size_t i;
-  
-      const gsl_complex zero = gsl_complex_rect (0.0, 0.0);
-      const gsl_complex one = gsl_complex_rect (1.0, 0.0);
-      const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+      size_t i = 0;
 
-      for (i = 0 ; i < N - 1; i++)
+      if (N > HERMTD_CROSSOVER)
         {
-          gsl_vector_complex_view c = gsl_matrix_complex_column (A, i);
-          gsl_vector_complex_view v = gsl_vector_complex_subvector (&c.vector, i + 1, N - (i + 1));
-          gsl_complex tau_i = gsl_linalg_complex_householder_transform (&v.vector);
-          
-          /* Apply the transformation H^T A H to the remaining columns */
+          /* if the panel workspace cannot be allocated, fall back on
+             the unblocked algorithm */
+
+          gsl_matrix_complex * W = gsl_matrix_complex_alloc (N, HERMTD_BLOCKSIZE);
 
-          if ((i + 1) < (N - 1) 
-              && !(GSL_REAL(tau_i) == 0.0 && GSL_IMAG(tau_i) == 0.0)) 
+          if (W != 0)
             {
-              gsl_matrix_complex_view m = 
-                gsl_matrix_complex_submatrix (A, i + 1, i + 1, 
-                                              N - (i+1), N - (i+1));
-              gsl_complex ei = gsl_vector_complex_get(&v.vector, 0);
-              gsl_vector_complex_view x = gsl_vector_complex_subvector (tau, i, N-(i+1));
-              gsl_vector_complex_set (&v.vector, 0, one);
-              
-              /* x = tau * A * v */
-              gsl_blas_zhemv (CblasLower, tau_i, &m.matrix, &v.vector, zero, &x.vector);
-
-              /* w = x - (1/2) tau * (x' * v) * v  */
-              {
-                gsl_complex xv, txv, alpha;
-                gsl_blas_zdotc(&x.vector, &v.vector, &xv);
-                txv = gsl_complex_mul(tau_i, xv);
-                alpha = gsl_complex_mul_real(txv, -0.5);
-                gsl_blas_zaxpy(alpha, &v.vector, &x.vector);
-              }
-              
-              /* apply the transformation A = A - v w' - w v' */
-              gsl_blas_zher2(CblasLower, neg_one, &v.vector, &x.vector, &m.matrix);
-
-              gsl_vector_complex_set (&v.vector, 0, ei);
+              for (i = 0; N - i > HERMTD_CROSSOVER; i += HERMTD_BLOCKSIZE)
+                {
+                  hermtd_panel (A, tau, i, W);
+                }
+
+              gsl_matrix_complex_free (W);
             }
-          
-          gsl_vector_complex_set (tau, i, tau_i);
         }
-      
+
+      hermtd_decomp_L2 (A, tau, i);
+
       return GSL_SUCCESS;
     }
 }  
 
+/* reduce columns k0,...,N-2 of A one at a time using hermitian rank-2
+   updates */
+
+static void
+hermtd_decomp_L2 (gsl_matrix_complex * A, gsl_vector_complex * tau,
+                  const size_t k0)
+{
+  const size_t N = A->size1;
+  size_t i;
+  
+  const gsl_complex zero = gsl_complex_rect (0.0, 0.0);
+  const gsl_complex one = gsl_complex_rect (1.0, 0.0);
+  const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+
+  for (i = k0 ; i + 1 < N; i++)
+    {
+      gsl_vector_complex_view c = gsl_matrix_complex_column (A, i);
+      gsl_vector_complex_view v = gsl_vector_complex_subvector (&c.vector, i + 1, N - (i + 1));
+      gsl_complex tau_i = gsl_linalg_complex_householder_transform (&v.vector);
+      
+      /* Apply the transformation H^T A H to the remaining columns */
+
+      if ((i + 1) < (N - 1) 
+          && !(GSL_REAL(tau_i) == 0.0 && GSL_IMAG(tau_i) == 0.0)) 
+        {
+          gsl_matrix_complex_view m = 
+            gsl_matrix_complex_submatrix (A, i + 1, i + 1, 
+                                          N - (i+1), N - (i+1));
+          gsl_complex ei = gsl_vector_complex_get(&v.vector, 0);
+          gsl_vector_complex_view x = gsl_vector_complex_subvector (tau, i, N-(i+1));
+          gsl_vector_complex_set (&v.vector, 0, one);
+          
+          /* x = tau * A * v */
+          gsl_blas_zhemv (CblasLower, tau_i, &m.matrix, &v.vector, zero, &x.vector);
+
+          /* w = x - (1/2) tau * (x' * v) * v  */
+          {
+            gsl_complex xv, txv, alpha;
+            gsl_blas_zdotc(&x.vector, &v.vector, &xv);
+            txv = gsl_complex_mul(tau_i, xv);
+            alpha = gsl_complex_mul_real(txv, -0.5);
+            gsl_blas_zaxpy(alpha, &v.vector, &x.vector);
+          }
+          
+          /* apply the transformation A = A - v w' - w v' */
+          gsl_blas_zher2(CblasLower, neg_one, &v.vector, &x.vector, &m.matrix);
+
+          gsl_vector_complex_set (&v.vector, 0, ei);
+        }
+      
+      gsl_vector_complex_set (tau, i, tau_i);
+    }
+}
+
+/* reduce columns k0,...,k0+nb-1 of A, accumulating the panel matrix W,
+   then apply the rank-2k update to the trailing submatrix */
+
+static void
+hermtd_panel (gsl_matrix_complex * A, gsl_vector_complex * tau,
+              const size_t k0, gsl_matrix_complex * W)
+{
+  const size_t nb = W->size2;
+  const size_t n = A->size1 - k0;
+  gsl_matrix_complex_view S = gsl_matrix_complex_submatrix (A, k0, k0, n, n);
+  gsl_matrix_complex_view Ws = gsl_matrix_complex_submatrix (W, 0, 0, n, nb);
+  double e[HERMTD_BLOCKSIZE];
+  size_t i, j;
+
+  const gsl_complex zero = gsl_complex_rect (0.0, 0.0);
+  const gsl_complex one = gsl_complex_rect (1.0, 0.0);
+  const gsl_complex neg_one = gsl_complex_rect (-1.0, 0.0);
+
+  for (j = 0; j < nb; j++)
+    {
+      gsl_vector_complex_view c = gsl_matrix_complex_column (&S.matrix, j);
+      gsl_vector_complex_view v = gsl_vector_complex_subvector (&c.vector, j + 1, n - (j + 1));
+      gsl_vector_complex_view wj = gsl_matrix_complex_subcolumn (&Ws.matrix, j, j + 1, n - (j + 1));
+      gsl_complex tau_j, Ajj;
+
+      /* apply the previous transformations of this panel to column j,
+         A(j:n,j) -= V(j:n,0:j) W(j,0:j)' + W(j:n,0:j) V(j,0:j)' */
+
+      if (j > 0)
+        {
+          gsl_vector_complex_view aj = gsl_vector_complex_subvector (&c.vector, j, n - j);
+          gsl_matrix_complex_view Vp = gsl_matrix_complex_submatrix (&S.matrix, j, 0, n - j, j);
+          gsl_matrix_complex_view Wp = gsl_matrix_complex_submatrix (&Ws.matrix, j, 0, n - j, j);
+          gsl_vector_complex_view t = gsl_matrix_complex_subcolumn (&Ws.matrix, j, 0, j);
+
+          for (i = 0; i < j; i++)
+            gsl_vector_complex_set (&t.vector, i, gsl_complex_conjugate (gsl_matrix_complex_get (&Ws.matrix, j, i)));
+
+          gsl_blas_zgemv (CblasNoTrans, neg_one, &Vp.matrix, &t.vector, one, &aj.vector);
+
+          for (i = 0; i < j; i++)
+            gsl_vector_complex_set (&t.vector, i, gsl_complex_conjugate (gsl_matrix_complex_get (&S.matrix, j, i)));
+
+          gsl_blas_zgemv (CblasNoTrans, neg_one, &Wp.matrix, &t.vector, one, &aj.vector);
+        }
+
+      Ajj = gsl_matrix_complex_get (&S.matrix, j, j);
+      gsl_matrix_complex_set (&S.matrix, j, j, gsl_complex_rect (GSL_REAL (Ajj), 0.0));
+
+      /* generate the Householder vector annihilating A(j+2:n,j); the
+         subdiagonal element becomes real */
+
+      tau_j = gsl_linalg_complex_householder_transform (&v.vector);
+      e[j] = GSL_REAL (gsl_vector_complex_get (&v.vector, 0));
+      gsl_vector_complex_set (&v.vector, 0, one);
+
+      /* compute w_j = tau A v - (1/2) tau (w' v) v, with A the
+         trailing matrix updated by the previous columns of the panel */
+
+      {
+        gsl_matrix_complex_view m =
+          gsl_matrix_complex_submatrix (&S.matrix, j + 1, j + 1, n - (j + 1), n - (j + 1));
+        gsl_blas_zhemv (CblasLower, one, &m.matrix, &v.vector, zero, &wj.vector);
+      }
+
+      if (j > 0)
+        {
+          gsl_matrix_complex_view Vp = gsl_matrix_complex_submatrix (&S.matrix, j + 1, 0, n - (j + 1), j);
+          gsl_matrix_complex_view Wp = gsl_matrix_complex_submatrix (&Ws.matrix, j + 1, 0, n - (j + 1), j);
+          gsl_vector_complex_view t = gsl_matrix_complex_subcolumn (&Ws.matrix, j, 0, j);
+
+          gsl_blas_zgemv (CblasConjTrans, one, &Wp.matrix, &v.vector, zero, &t.vector);
+          gsl_blas_zgemv (CblasNoTrans, neg_one, &Vp.matrix, &t.vector, one, &wj.vector);
+          gsl_blas_zgemv (CblasConjTrans, one, &Vp.matrix, &v.vector, zero, &t.vector);
+          gsl_blas_zgemv (CblasNoTrans, neg_one, &Wp.matrix, &t.vector, one, &wj.vector);
+        }
+
+      gsl_blas_zscal (tau_j, &wj.vector);
+
+      {
+        gsl_complex wv, alpha;
+        gsl_blas_zdotc (&wj.vector, &v.vector, &wv);
+        alpha = gsl_complex_mul_real (gsl_complex_mul (tau_j, wv), -0.5);
+        gsl_blas_zaxpy (alpha, &v.vector, &wj.vector);
+      }
+
+      gsl_vector_complex_set (tau, k0 + j, tau_j);
+    }
+
+  /* update the trailing submatrix, A <- A - V W' - W V' */
+
+  {
+    gsl_matrix_complex_view V2 = gsl_matrix_complex_submatrix (&S.matrix, nb, 0, n - nb, nb);
+    gsl_matrix_complex_view W2 = gsl_matrix_complex_submatrix (&Ws.matrix, nb, 0, n - nb, nb);
+    gsl_matrix_complex_view A22 = gsl_matrix_complex_submatrix (&S.matrix, nb, nb, n - nb, n - nb);
+
+    gsl_blas_zher2k (CblasLower, CblasNoTrans, neg_one, &V2.matrix, &W2.matrix,
+                     1.0, &A22.matrix);
+  }
+
+  /* restore the subdiagonal elements */
+
+  for (j = 0; j < nb; j++)
+    {
+      gsl_matrix_complex_set (&S.matrix, j + 1, j, gsl_complex_rect (e[j], 0.0));
+    }
+}
+
 
 /*  Form the orthogonal matrix U from the packed QR matrix */
 
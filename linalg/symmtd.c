@@ -60,6 +60,23 @@
 
 #include <gsl/gsl_linalg.h>
 
+/* For large matrices the reduction is blocked as in LAPACK's
+ * dsytrd: a panel of SYMMTD_BLOCKSIZE columns is reduced with
+ * level-2 operations while accumulating the matrix W such that the
+ * trailing submatrix is updated with a single rank-2k update
+ *
+ *       A <- A - V W' - W V'
+ *
+ * (dlatrd/dsyr2k).  The last SYMMTD_CROSSOVER columns, and matrices
+ * smaller than this, are reduced one column at a time. */
+
+#define SYMMTD_BLOCKSIZE 32
+#define SYMMTD_CROSSOVER 128
+
+static void symmtd_decomp_L2 (gsl_matrix * A, gsl_vector * tau, const size_t k0);
+static void symmtd_panel (gsl_matrix * A, gsl_vector * tau, const size_t k0,
+                          gsl_matrix * W);
+
 int 
 gsl_linalg_symmtd_decomp (gsl_matrix * A, gsl_vector * tau)  
 {
@@ -75,48 +92,173 @@ gsl_linalg_symmtd_decomp (gsl_matrix * A, gsl_vector * tau)
   else
     {
       const size_t N = A->size1;
-      size_t i;
-  
-      for (i = 0 ; i < N - 2; i++)
+      size_t i = 0;
+
+      if (N > SYMMTD_CROSSOVER)
         {
-          gsl_vector_view c = gsl_matrix_column (A, i);
-          gsl_vector_view v = gsl_vector_subvector (&c.vector, i + 1, N - (i + 1));
-          double tau_i = gsl_linalg_householder_transform (&v.vector);
-          
-          /* Apply the transformation H^T A H to the remaining columns */
+          /* if the panel workspace cannot be allocated, fall back on
+             the unblocked algorithm */
 
-          if (tau_i != 0.0) 
+          gsl_matrix * W = gsl_matrix_alloc (N, SYMMTD_BLOCKSIZE);
+
+          if (W != 0)
             {
-              gsl_matrix_view m = gsl_matrix_submatrix (A, i + 1, i + 1, 
-                                                        N - (i+1), N - (i+1));
-              double ei = gsl_vector_get(&v.vector, 0);
-              gsl_vector_view x = gsl_vector_subvector (tau, i, N-(i+1));
-              gsl_vector_set (&v.vector, 0, 1.0);
-              
-              /* x = tau * A * v */
-              gsl_blas_dsymv (CblasLower, tau_i, &m.matrix, &v.vector, 0.0, &x.vector);
-
-              /* w = x - (1/2) tau * (x' * v) * v  */
-              {
-                double xv, alpha;
-                gsl_blas_ddot(&x.vector, &v.vector, &xv);
-                alpha = - (tau_i / 2.0) * xv;
-                gsl_blas_daxpy(alpha, &v.vector, &x.vector);
-              }
-              
-              /* apply the transformation A = A - v w' - w v' */
-              gsl_blas_dsyr2(CblasLower, -1.0, &v.vector, &x.vector, &m.matrix);
-
-              gsl_vector_set (&v.vector, 0, ei);
+              for (i = 0; N - i > SYMMTD_CROSSOVER; i += SYMMTD_BLOCKSIZE)
+                {
+                  symmtd_panel (A, tau, i, W);
+                }
+
+              gsl_matrix_free (W);
             }
-          
-          gsl_vector_set (tau, i, tau_i);
         }
+
+      symmtd_decomp_L2 (A, tau, i);
       
       return GSL_SUCCESS;
     }
 }  
 
+/* reduce columns k0,...,N-3 of A one at a time using symmetric rank-2
+   updates */
+
+static void
+symmtd_decomp_L2 (gsl_matrix * A, gsl_vector * tau, const size_t k0)
+{
+  const size_t N = A->size1;
+  size_t i;
+
+  for (i = k0 ; i + 2 < N; i++)
+    {
+      gsl_vector_view c = gsl_matrix_column (A, i);
+      gsl_vector_view v = gsl_vector_subvector (&c.vector, i + 1, N - (i + 1));
+      double tau_i = gsl_linalg_householder_transform (&v.vector);
+      
+      /* Apply the transformation H^T A H to the remaining columns */
+
+      if (tau_i != 0.0) 
+        {
+          gsl_matrix_view m = gsl_matrix_submatrix (A, i + 1, i + 1, 
+                                                    N - (i+1), N - (i+1));
+          double ei = gsl_vector_get(&v.vector, 0);
+          gsl_vector_view x = gsl_vector_subvector (tau, i, N-(i+1));
+          gsl_vector_set (&v.vector, 0, 1.0);
+          
+          /* x = tau * A * v */
+          gsl_blas_dsymv (CblasLower, tau_i, &m.matrix, &v.vector, 0.0, &x.vector);
+
+          /* w = x - (1/2) tau * (x' * v) * v  */
+          {
+            double xv, alpha;
+            gsl_blas_ddot(&x.vector, &v.vector, &xv);
+            alpha = - (tau_i / 2.0) * xv;
+            gsl_blas_daxpy(alpha, &v.vector, &x.vector);
+          }
+          
+          /* apply the transformation A = A - v w' - w v' */
+          gsl_blas_dsyr2(CblasLower, -1.0, &v.vector, &x.vector, &m.matrix);
+
+          gsl_vector_set (&v.vector, 0, ei);
+        }
+      
+      gsl_vector_set (tau, i, tau_i);
+    }
+}
+
+/* reduce columns k0,...,k0+nb-1 of A, accumulating the panel matrix W,
+   then apply the rank-2k update to the trailing submatrix.  On entry
+   the previous panels have been applied to A(k0:N,k0:N) */
+
+static void
+symmtd_panel (gsl_matrix * A, gsl_vector * tau, const size_t k0,
+              gsl_matrix * W)
+{
+  const size_t nb = W->size2;
+  const size_t n = A->size1 - k0;
+  gsl_matrix_view S = gsl_matrix_submatrix (A, k0, k0, n, n);
+  gsl_matrix_view Ws = gsl_matrix_submatrix (W, 0, 0, n, nb);
+  double e[SYMMTD_BLOCKSIZE];
+  size_t j;
+
+  for (j = 0; j < nb; j++)
+    {
+      gsl_vector_view c = gsl_matrix_column (&S.matrix, j);
+      gsl_vector_view v = gsl_vector_subvector (&c.vector, j + 1, n - (j + 1));
+      gsl_vector_view wj = gsl_matrix_subcolumn (&Ws.matrix, j, j + 1, n - (j + 1));
+      double tau_j;
+
+      /* apply the previous transformations of this panel to column j,
+         A(j:n,j) -= V(j:n,0:j) W(j,0:j)' + W(j:n,0:j) V(j,0:j)' */
+
+      if (j > 0)
+        {
+          gsl_vector_view aj = gsl_vector_subvector (&c.vector, j, n - j);
+          gsl_matrix_view Vp = gsl_matrix_submatrix (&S.matrix, j, 0, n - j, j);
+          gsl_matrix_view Wp = gsl_matrix_submatrix (&Ws.matrix, j, 0, n - j, j);
+          gsl_vector_view vrow = gsl_matrix_subrow (&S.matrix, j, 0, j);
+          gsl_vector_view wrow = gsl_matrix_subrow (&Ws.matrix, j, 0, j);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Vp.matrix, &wrow.vector, 1.0, &aj.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Wp.matrix, &vrow.vector, 1.0, &aj.vector);
+        }
+
+      /* generate the Householder vector annihilating A(j+2:n,j) */
+
+      tau_j = gsl_linalg_householder_transform (&v.vector);
+      e[j] = gsl_vector_get (&v.vector, 0);
+      gsl_vector_set (&v.vector, 0, 1.0);
+
+      /* compute w_j = tau A v - (1/2) tau (v' tau A v) v, with A the
+         trailing matrix updated by the previous columns of the panel */
+
+      {
+        gsl_matrix_view m = gsl_matrix_submatrix (&S.matrix, j + 1, j + 1,
+                                                  n - (j + 1), n - (j + 1));
+        gsl_blas_dsymv (CblasLower, 1.0, &m.matrix, &v.vector, 0.0, &wj.vector);
+      }
+
+      if (j > 0)
+        {
+          gsl_matrix_view Vp = gsl_matrix_submatrix (&S.matrix, j + 1, 0, n - (j + 1), j);
+          gsl_matrix_view Wp = gsl_matrix_submatrix (&Ws.matrix, j + 1, 0, n - (j + 1), j);
+          gsl_vector_view t = gsl_matrix_subcolumn (&Ws.matrix, j, 0, j);
+
+          gsl_blas_dgemv (CblasTrans, 1.0, &Wp.matrix, &v.vector, 0.0, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Vp.matrix, &t.vector, 1.0, &wj.vector);
+          gsl_blas_dgemv (CblasTrans, 1.0, &Vp.matrix, &v.vector, 0.0, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Wp.matrix, &t.vector, 1.0, &wj.vector);
+        }
+
+      gsl_blas_dscal (tau_j, &wj.vector);
+
+      {
+        double wv, alpha;
+        gsl_blas_ddot (&wj.vector, &v.vector, &wv);
+        alpha = -0.5 * tau_j * wv;
+        gsl_blas_daxpy (alpha, &v.vector, &wj.vector);
+      }
+
+      gsl_vector_set (tau, k0 + j, tau_j);
+    }
+
+  /* update the trailing submatrix, A <- A - V W' - W V' */
+
+  {
+    gsl_matrix_view V2 = gsl_matrix_submatrix (&S.matrix, nb, 0, n - nb, nb);
+    gsl_matrix_view W2 = gsl_matrix_submatrix (&Ws.matrix, nb, 0, n - nb, nb);
+    gsl_matrix_view A22 = gsl_matrix_submatrix (&S.matrix, nb, nb, n - nb, n - nb);
+
+    gsl_blas_dsyr2k (CblasLower, CblasNoTrans, -1.0, &V2.matrix, &W2.matrix,
+                     1.0, &A22.matrix);
+  }
+
+  /* restore the subdiagonal elements */
+
+  for (j = 0; j < nb; j++)
+    {
+      gsl_matrix_set (&S.matrix, j + 1, j, e[j]);
+    }
+}
+
 
 /*  Form the orthogonal matrix Q from the packed QR matrix */
 
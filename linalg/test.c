@@ -111,6 +111,10 @@ int test_TDN_cyc_solve_dim(unsigned long dim, double d, double a, double b, cons
 int test_TDN_cyc_solve(void);
 int test_bidiag_decomp_dim(const gsl_matrix * m, double eps);
 int test_bidiag_decomp(void);
+int test_symmtd_decomp_dim(const size_t N, double eps);
+int test_symmtd_decomp(void);
+int test_hermtd_decomp_dim(const size_t N, double eps);
+int test_hermtd_decomp(void);
 
 int 
 check (double x, double actual, double eps)
@@ -4240,6 +4244,181 @@ int test_bidiag_decomp(void)
   return s;
 }
 
+/* check A = Q T Q^T for the symmetric matrix A_ij = sin((i+1)(j+1)),
+   with sizes on both sides of the blocking crossover */
+int
+test_symmtd_decomp_dim(const size_t N, double eps)
+{
+  int s = 0;
+  size_t i, j;
+
+  gsl_matrix * m = gsl_matrix_alloc(N, N);
+  gsl_matrix * A = gsl_matrix_alloc(N, N);
+  gsl_matrix * Q = gsl_matrix_alloc(N, N);
+  gsl_matrix * T = gsl_matrix_calloc(N, N);
+  gsl_matrix * QT = gsl_matrix_alloc(N, N);
+  gsl_vector * tau = gsl_vector_alloc(N - 1);
+  gsl_vector * d = gsl_vector_alloc(N);
+  gsl_vector * sd = gsl_vector_alloc(N - 1);
+
+  for (i = 0; i < N; i++)
+    for (j = 0; j < N; j++)
+      gsl_matrix_set(m, i, j, sin((i + 1.0) * (j + 1.0)));
+
+  gsl_matrix_memcpy(A, m);
+
+  s += gsl_linalg_symmtd_decomp(A, tau);
+  s += gsl_linalg_symmtd_unpack(A, tau, Q, d, sd);
+
+  for (i = 0; i < N; i++)
+    {
+      gsl_matrix_set(T, i, i, gsl_vector_get(d, i));
+      if (i + 1 < N)
+        {
+          gsl_matrix_set(T, i, i + 1, gsl_vector_get(sd, i));
+          gsl_matrix_set(T, i + 1, i, gsl_vector_get(sd, i));
+        }
+    }
+
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, Q, T, 0.0, QT);
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, QT, Q, 0.0, A);
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          double aij = gsl_matrix_get(A, i, j);
+          double mij = gsl_matrix_get(m, i, j);
+          int foo = fabs(aij - mij) > eps;
+          if (foo)
+            {
+              printf("(%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n", N, N, i, j, aij, mij);
+            }
+          s += foo;
+        }
+    }
+
+  gsl_matrix_free(m);
+  gsl_matrix_free(A);
+  gsl_matrix_free(Q);
+  gsl_matrix_free(T);
+  gsl_matrix_free(QT);
+  gsl_vector_free(tau);
+  gsl_vector_free(d);
+  gsl_vector_free(sd);
+
+  return s;
+}
+
+int test_symmtd_decomp(void)
+{
+  const size_t sizes[] = { 2, 3, 10, 129, 200, 300 };
+  size_t k;
+  int f;
+  int s = 0;
+
+  for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+      const size_t N = sizes[k];
+      f = test_symmtd_decomp_dim(N, N * 64.0 * GSL_DBL_EPSILON);
+      gsl_test(f, "  symmtd_decomp sin(%d)", N);
+      s += f;
+    }
+
+  return s;
+}
+
+/* check A = U T U^H for the hermitian matrix
+   A_ij = cos((i+1)(j+1)) + i sin(i-j) */
+int
+test_hermtd_decomp_dim(const size_t N, double eps)
+{
+  int s = 0;
+  size_t i, j;
+
+  const gsl_complex zero = gsl_complex_rect(0.0, 0.0);
+  const gsl_complex one = gsl_complex_rect(1.0, 0.0);
+
+  gsl_matrix_complex * m = gsl_matrix_complex_alloc(N, N);
+  gsl_matrix_complex * A = gsl_matrix_complex_alloc(N, N);
+  gsl_matrix_complex * U = gsl_matrix_complex_alloc(N, N);
+  gsl_matrix_complex * T = gsl_matrix_complex_calloc(N, N);
+  gsl_matrix_complex * UT = gsl_matrix_complex_alloc(N, N);
+  gsl_vector_complex * tau = gsl_vector_complex_alloc(N - 1);
+  gsl_vector * d = gsl_vector_alloc(N);
+  gsl_vector * sd = gsl_vector_alloc(N - 1);
+
+  for (i = 0; i < N; i++)
+    for (j = 0; j < N; j++)
+      gsl_matrix_complex_set(m, i, j, gsl_complex_rect(cos((i + 1.0) * (j + 1.0)),
+                                                       sin((double) i - (double) j)));
+
+  gsl_matrix_complex_memcpy(A, m);
+
+  s += gsl_linalg_hermtd_decomp(A, tau);
+  s += gsl_linalg_hermtd_unpack(A, tau, U, d, sd);
+
+  for (i = 0; i < N; i++)
+    {
+      gsl_matrix_complex_set(T, i, i, gsl_complex_rect(gsl_vector_get(d, i), 0.0));
+      if (i + 1 < N)
+        {
+          gsl_complex sdi = gsl_complex_rect(gsl_vector_get(sd, i), 0.0);
+          gsl_matrix_complex_set(T, i, i + 1, sdi);
+          gsl_matrix_complex_set(T, i + 1, i, sdi);
+        }
+    }
+
+  gsl_blas_zgemm(CblasNoTrans, CblasNoTrans, one, U, T, zero, UT);
+  gsl_blas_zgemm(CblasNoTrans, CblasConjTrans, one, UT, U, zero, A);
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          gsl_complex aij = gsl_matrix_complex_get(A, i, j);
+          gsl_complex mij = gsl_matrix_complex_get(m, i, j);
+          int foo = gsl_complex_abs(gsl_complex_sub(aij, mij)) > eps;
+          if (foo)
+            {
+              printf("(%3lu,%3lu)[%lu,%lu]: %22.18g + %22.18g i   %22.18g + %22.18g i\n",
+                     N, N, i, j, GSL_REAL(aij), GSL_IMAG(aij),
+                     GSL_REAL(mij), GSL_IMAG(mij));
+            }
+          s += foo;
+        }
+    }
+
+  gsl_matrix_complex_free(m);
+  gsl_matrix_complex_free(A);
+  gsl_matrix_complex_free(U);
+  gsl_matrix_complex_free(T);
+  gsl_matrix_complex_free(UT);
+  gsl_vector_complex_free(tau);
+  gsl_vector_free(d);
+  gsl_vector_free(sd);
+
+  return s;
+}
+
+int test_hermtd_decomp(void)
+{
+  const size_t sizes[] = { 2, 3, 10, 129, 200, 300 };
+  size_t k;
+  int f;
+  int s = 0;
+
+  for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+      const size_t N = sizes[k];
+      f = test_hermtd_decomp_dim(N, N * 64.0 * GSL_DBL_EPSILON);
+      gsl_test(f, "  hermtd_decomp(%d)", N);
+      s += f;
+    }
+
+  return s;
+}
+
 void
 my_error_handler (const char *reason, const char *file, int line, int err)
 {
@@ -4308,6 +4487,8 @@ int main(void)
   gsl_test(test_matmult_mod(),           "Matrix Multiply with Modification"); 
 #endif
   gsl_test(test_bidiag_decomp(),         "Bidiagonal Decomposition");
+  gsl_test(test_symmtd_decomp(),         "Symmetric Tridiagonal Decomposition");
+  gsl_test(test_hermtd_decomp(),         "Hermitian Tridiagonal Decomposition");
   gsl_test(test_LU_solve(),              "LU Decomposition and Solve");
   gsl_test(test_LUc_solve(),             "Complex LU Decomposition and Solve");
   gsl_test(test_QR_decomp(),             "QR Decomposition");
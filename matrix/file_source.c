@@ -84,6 +84,81 @@ FUNCTION (gsl_matrix, fwrite) (FILE * stream, const TYPE (gsl_matrix) * m)
 
 }
 
+/* Binary files with a header giving the element type and dimensions,
+   see gsl_block_raw_fwrite_header */
+
+int
+FUNCTION (gsl_matrix, fsave) (FILE * stream, const TYPE (gsl_matrix) * m)
+{
+  int status = FUNCTION (gsl_block, raw_fwrite_header) (stream, m->size1,
+                                                        m->size2);
+
+  if (status)
+    return status;
+
+  return FUNCTION (gsl_matrix, fwrite) (stream, m);
+}
+
+TYPE (gsl_matrix) *
+FUNCTION (gsl_matrix, fload) (FILE * stream)
+{
+  TYPE (gsl_matrix) * m;
+  size_t size1, size2;
+  int status;
+
+  status = FUNCTION (gsl_block, raw_fread_header) (stream, &size1, &size2);
+
+  if (status)
+    return 0;
+
+  m = FUNCTION (gsl_matrix, alloc) (size1, size2);
+
+  if (m == 0)
+    return 0;
+
+  status = FUNCTION (gsl_matrix, fread) (stream, m);
+
+  if (status)
+    {
+      FUNCTION (gsl_matrix, free) (m);
+      return 0;
+    }
+
+  return m;
+}
+
+const TYPE (gsl_matrix) *
+FUNCTION (gsl_matrix, mmap) (const char * filename)
+{
+  TYPE (gsl_matrix) * m;
+  TYPE (gsl_block) * b;
+  size_t size1, size2;
+
+  b = FUNCTION (gsl_block, mmap) (filename, &size1, &size2);
+
+  if (b == 0)
+    return 0;
+
+  m = FUNCTION (gsl_matrix, alloc_from_block) (b, 0, size1, size2, size2);
+
+  if (m == 0)
+    {
+      FUNCTION (gsl_block, munmap) (b);
+      return 0;
+    }
+
+  return m;
+}
+
+void
+FUNCTION (gsl_matrix, munmap) (const TYPE (gsl_matrix) * m)
+{
+  RETURN_IF_NULL (m);
+
+  FUNCTION (gsl_block, munmap) (m->block);
+  free ((TYPE (gsl_matrix) *) m);
+}
+
 #if !(USES_LONGDOUBLE && !HAVE_PRINTF_LONGDOUBLE)
 int
 FUNCTION (gsl_matrix, fprintf) (FILE * stream, const TYPE (gsl_matrix) * m,
@@ -211,6 +211,10 @@ void gsl_matrix_char_set_all (gsl_matrix_char * m, char x);
 
 int gsl_matrix_char_fread (FILE * stream, gsl_matrix_char * m) ;
 int gsl_matrix_char_fwrite (FILE * stream, const gsl_matrix_char * m) ;
+int gsl_matrix_char_fsave (FILE * stream, const gsl_matrix_char * m) ;
+gsl_matrix_char * gsl_matrix_char_fload (FILE * stream) ;
+const gsl_matrix_char * gsl_matrix_char_mmap (const char * filename) ;
+void gsl_matrix_char_munmap (const gsl_matrix_char * m) ;
 int gsl_matrix_char_fscanf (FILE * stream, gsl_matrix_char * m);
 int gsl_matrix_char_fprintf (FILE * stream, const gsl_matrix_char * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_char_swap_columns(gsl_matrix_char * m, const size_t i, const size
 int gsl_matrix_char_swap_rowcol(gsl_matrix_char * m, const size_t i, const size_t j);
 int gsl_matrix_char_transpose (gsl_matrix_char * m);
 int gsl_matrix_char_transpose_memcpy (gsl_matrix_char * dest, const gsl_matrix_char * src);
+int gsl_matrix_char_transpose_inplace (gsl_matrix_char * m);
 
 char gsl_matrix_char_max (const gsl_matrix_char * m);
 char gsl_matrix_char_min (const gsl_matrix_char * m);
@@ -245,6 +250,9 @@ int gsl_matrix_char_div_elements (gsl_matrix_char * a, const gsl_matrix_char * b
 int gsl_matrix_char_scale (gsl_matrix_char * a, const double x);
 int gsl_matrix_char_add_constant (gsl_matrix_char * a, const double x);
 int gsl_matrix_char_add_diagonal (gsl_matrix_char * a, const double x);
+int gsl_matrix_char_axpby (const double alpha, const gsl_matrix_char * x, const double beta, gsl_matrix_char * y);
+int gsl_matrix_char_axpbyc (const double alpha, const gsl_matrix_char * x, const double beta, const double c, gsl_matrix_char * y);
+int gsl_matrix_char_map (gsl_matrix_char * a, char (* f) (char x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
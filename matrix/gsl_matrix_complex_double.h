@@ -211,6 +211,10 @@ void gsl_matrix_complex_set_all (gsl_matrix_complex * m, gsl_complex x);
 
 int gsl_matrix_complex_fread (FILE * stream, gsl_matrix_complex * m) ;
 int gsl_matrix_complex_fwrite (FILE * stream, const gsl_matrix_complex * m) ;
+int gsl_matrix_complex_fsave (FILE * stream, const gsl_matrix_complex * m) ;
+gsl_matrix_complex * gsl_matrix_complex_fload (FILE * stream) ;
+const gsl_matrix_complex * gsl_matrix_complex_mmap (const char * filename) ;
+void gsl_matrix_complex_munmap (const gsl_matrix_complex * m) ;
 int gsl_matrix_complex_fscanf (FILE * stream, gsl_matrix_complex * m);
 int gsl_matrix_complex_fprintf (FILE * stream, const gsl_matrix_complex * m, const char * format);
 
@@ -223,6 +227,7 @@ int gsl_matrix_complex_swap_rowcol(gsl_matrix_complex * m, const size_t i, const
 
 int gsl_matrix_complex_transpose (gsl_matrix_complex * m);
 int gsl_matrix_complex_transpose_memcpy (gsl_matrix_complex * dest, const gsl_matrix_complex * src);
+int gsl_matrix_complex_transpose_inplace (gsl_matrix_complex * m);
 
 int gsl_matrix_complex_equal (const gsl_matrix_complex * a, const gsl_matrix_complex * b);
 
@@ -238,6 +243,9 @@ int gsl_matrix_complex_div_elements (gsl_matrix_complex * a, const gsl_matrix_co
 int gsl_matrix_complex_scale (gsl_matrix_complex * a, const gsl_complex x);
 int gsl_matrix_complex_add_constant (gsl_matrix_complex * a, const gsl_complex x);
 int gsl_matrix_complex_add_diagonal (gsl_matrix_complex * a, const gsl_complex x);
+int gsl_matrix_complex_axpby (const gsl_complex alpha, const gsl_matrix_complex * x, const gsl_complex beta, gsl_matrix_complex * y);
+int gsl_matrix_complex_axpbyc (const gsl_complex alpha, const gsl_matrix_complex * x, const gsl_complex beta, const gsl_complex c, gsl_matrix_complex * y);
+int gsl_matrix_complex_map (gsl_matrix_complex * a, gsl_complex (* f) (gsl_complex z, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
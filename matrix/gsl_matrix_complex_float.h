@@ -211,6 +211,10 @@ void gsl_matrix_complex_float_set_all (gsl_matrix_complex_float * m, gsl_complex
 
 int gsl_matrix_complex_float_fread (FILE * stream, gsl_matrix_complex_float * m) ;
 int gsl_matrix_complex_float_fwrite (FILE * stream, const gsl_matrix_complex_float * m) ;
+int gsl_matrix_complex_float_fsave (FILE * stream, const gsl_matrix_complex_float * m) ;
+gsl_matrix_complex_float * gsl_matrix_complex_float_fload (FILE * stream) ;
+const gsl_matrix_complex_float * gsl_matrix_complex_float_mmap (const char * filename) ;
+void gsl_matrix_complex_float_munmap (const gsl_matrix_complex_float * m) ;
 int gsl_matrix_complex_float_fscanf (FILE * stream, gsl_matrix_complex_float * m);
 int gsl_matrix_complex_float_fprintf (FILE * stream, const gsl_matrix_complex_float * m, const char * format);
 
@@ -223,6 +227,7 @@ int gsl_matrix_complex_float_swap_rowcol(gsl_matrix_complex_float * m, const siz
 
 int gsl_matrix_complex_float_transpose (gsl_matrix_complex_float * m);
 int gsl_matrix_complex_float_transpose_memcpy (gsl_matrix_complex_float * dest, const gsl_matrix_complex_float * src);
+int gsl_matrix_complex_float_transpose_inplace (gsl_matrix_complex_float * m);
 
 int gsl_matrix_complex_float_equal (const gsl_matrix_complex_float * a, const gsl_matrix_complex_float * b);
 
@@ -238,6 +243,9 @@ int gsl_matrix_complex_float_div_elements (gsl_matrix_complex_float * a, const g
 int gsl_matrix_complex_float_scale (gsl_matrix_complex_float * a, const gsl_complex_float x);
 int gsl_matrix_complex_float_add_constant (gsl_matrix_complex_float * a, const gsl_complex_float x);
 int gsl_matrix_complex_float_add_diagonal (gsl_matrix_complex_float * a, const gsl_complex_float x);
+int gsl_matrix_complex_float_axpby (const gsl_complex_float alpha, const gsl_matrix_complex_float * x, const gsl_complex_float beta, gsl_matrix_complex_float * y);
+int gsl_matrix_complex_float_axpbyc (const gsl_complex_float alpha, const gsl_matrix_complex_float * x, const gsl_complex_float beta, const gsl_complex_float c, gsl_matrix_complex_float * y);
+int gsl_matrix_complex_float_map (gsl_matrix_complex_float * a, gsl_complex_float (* f) (gsl_complex_float z, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
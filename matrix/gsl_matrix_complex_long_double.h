@@ -211,6 +211,10 @@ void gsl_matrix_complex_long_double_set_all (gsl_matrix_complex_long_double * m,
 
 int gsl_matrix_complex_long_double_fread (FILE * stream, gsl_matrix_complex_long_double * m) ;
 int gsl_matrix_complex_long_double_fwrite (FILE * stream, const gsl_matrix_complex_long_double * m) ;
+int gsl_matrix_complex_long_double_fsave (FILE * stream, const gsl_matrix_complex_long_double * m) ;
+gsl_matrix_complex_long_double * gsl_matrix_complex_long_double_fload (FILE * stream) ;
+const gsl_matrix_complex_long_double * gsl_matrix_complex_long_double_mmap (const char * filename) ;
+void gsl_matrix_complex_long_double_munmap (const gsl_matrix_complex_long_double * m) ;
 int gsl_matrix_complex_long_double_fscanf (FILE * stream, gsl_matrix_complex_long_double * m);
 int gsl_matrix_complex_long_double_fprintf (FILE * stream, const gsl_matrix_complex_long_double * m, const char * format);
 
@@ -223,6 +227,7 @@ int gsl_matrix_complex_long_double_swap_rowcol(gsl_matrix_complex_long_double *
 
 int gsl_matrix_complex_long_double_transpose (gsl_matrix_complex_long_double * m);
 int gsl_matrix_complex_long_double_transpose_memcpy (gsl_matrix_complex_long_double * dest, const gsl_matrix_complex_long_double * src);
+int gsl_matrix_complex_long_double_transpose_inplace (gsl_matrix_complex_long_double * m);
 
 int gsl_matrix_complex_long_double_equal (const gsl_matrix_complex_long_double * a, const gsl_matrix_complex_long_double * b);
 
@@ -238,6 +243,9 @@ int gsl_matrix_complex_long_double_div_elements (gsl_matrix_complex_long_double
 int gsl_matrix_complex_long_double_scale (gsl_matrix_complex_long_double * a, const gsl_complex_long_double x);
 int gsl_matrix_complex_long_double_add_constant (gsl_matrix_complex_long_double * a, const gsl_complex_long_double x);
 int gsl_matrix_complex_long_double_add_diagonal (gsl_matrix_complex_long_double * a, const gsl_complex_long_double x);
+int gsl_matrix_complex_long_double_axpby (const gsl_complex_long_double alpha, const gsl_matrix_complex_long_double * x, const gsl_complex_long_double beta, gsl_matrix_complex_long_double * y);
+int gsl_matrix_complex_long_double_axpbyc (const gsl_complex_long_double alpha, const gsl_matrix_complex_long_double * x, const gsl_complex_long_double beta, const gsl_complex_long_double c, gsl_matrix_complex_long_double * y);
+int gsl_matrix_complex_long_double_map (gsl_matrix_complex_long_double * a, gsl_complex_long_double (* f) (gsl_complex_long_double z, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -211,6 +211,10 @@ void gsl_matrix_set_all (gsl_matrix * m, double x);
 
 int gsl_matrix_fread (FILE * stream, gsl_matrix * m) ;
 int gsl_matrix_fwrite (FILE * stream, const gsl_matrix * m) ;
+int gsl_matrix_fsave (FILE * stream, const gsl_matrix * m) ;
+gsl_matrix * gsl_matrix_fload (FILE * stream) ;
+const gsl_matrix * gsl_matrix_mmap (const char * filename) ;
+void gsl_matrix_munmap (const gsl_matrix * m) ;
 int gsl_matrix_fscanf (FILE * stream, gsl_matrix * m);
 int gsl_matrix_fprintf (FILE * stream, const gsl_matrix * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_swap_columns(gsl_matrix * m, const size_t i, const size_t j);
 int gsl_matrix_swap_rowcol(gsl_matrix * m, const size_t i, const size_t j);
 int gsl_matrix_transpose (gsl_matrix * m);
 int gsl_matrix_transpose_memcpy (gsl_matrix * dest, const gsl_matrix * src);
+int gsl_matrix_transpose_inplace (gsl_matrix * m);
 
 double gsl_matrix_max (const gsl_matrix * m);
 double gsl_matrix_min (const gsl_matrix * m);
@@ -245,6 +250,9 @@ int gsl_matrix_div_elements (gsl_matrix * a, const gsl_matrix * b);
 int gsl_matrix_scale (gsl_matrix * a, const double x);
 int gsl_matrix_add_constant (gsl_matrix * a, const double x);
 int gsl_matrix_add_diagonal (gsl_matrix * a, const double x);
+int gsl_matrix_axpby (const double alpha, const gsl_matrix * x, const double beta, gsl_matrix * y);
+int gsl_matrix_axpbyc (const double alpha, const gsl_matrix * x, const double beta, const double c, gsl_matrix * y);
+int gsl_matrix_map (gsl_matrix * a, double (* f) (double x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
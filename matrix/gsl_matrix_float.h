@@ -211,6 +211,10 @@ void gsl_matrix_float_set_all (gsl_matrix_float * m, float x);
 
 int gsl_matrix_float_fread (FILE * stream, gsl_matrix_float * m) ;
 int gsl_matrix_float_fwrite (FILE * stream, const gsl_matrix_float * m) ;
+int gsl_matrix_float_fsave (FILE * stream, const gsl_matrix_float * m) ;
+gsl_matrix_float * gsl_matrix_float_fload (FILE * stream) ;
+const gsl_matrix_float * gsl_matrix_float_mmap (const char * filename) ;
+void gsl_matrix_float_munmap (const gsl_matrix_float * m) ;
 int gsl_matrix_float_fscanf (FILE * stream, gsl_matrix_float * m);
 int gsl_matrix_float_fprintf (FILE * stream, const gsl_matrix_float * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_float_swap_columns(gsl_matrix_float * m, const size_t i, const si
 int gsl_matrix_float_swap_rowcol(gsl_matrix_float * m, const size_t i, const size_t j);
 int gsl_matrix_float_transpose (gsl_matrix_float * m);
 int gsl_matrix_float_transpose_memcpy (gsl_matrix_float * dest, const gsl_matrix_float * src);
+int gsl_matrix_float_transpose_inplace (gsl_matrix_float * m);
 
 float gsl_matrix_float_max (const gsl_matrix_float * m);
 float gsl_matrix_float_min (const gsl_matrix_float * m);
@@ -245,6 +250,9 @@ int gsl_matrix_float_div_elements (gsl_matrix_float * a, const gsl_matrix_float
 int gsl_matrix_float_scale (gsl_matrix_float * a, const double x);
 int gsl_matrix_float_add_constant (gsl_matrix_float * a, const double x);
 int gsl_matrix_float_add_diagonal (gsl_matrix_float * a, const double x);
+int gsl_matrix_float_axpby (const double alpha, const gsl_matrix_float * x, const double beta, gsl_matrix_float * y);
+int gsl_matrix_float_axpbyc (const double alpha, const gsl_matrix_float * x, const double beta, const double c, gsl_matrix_float * y);
+int gsl_matrix_float_map (gsl_matrix_float * a, float (* f) (float x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
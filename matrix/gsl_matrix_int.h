@@ -211,6 +211,10 @@ void gsl_matrix_int_set_all (gsl_matrix_int * m, int x);
 
 int gsl_matrix_int_fread (FILE * stream, gsl_matrix_int * m) ;
 int gsl_matrix_int_fwrite (FILE * stream, const gsl_matrix_int * m) ;
+int gsl_matrix_int_fsave (FILE * stream, const gsl_matrix_int * m) ;
+gsl_matrix_int * gsl_matrix_int_fload (FILE * stream) ;
+const gsl_matrix_int * gsl_matrix_int_mmap (const char * filename) ;
+void gsl_matrix_int_munmap (const gsl_matrix_int * m) ;
 int gsl_matrix_int_fscanf (FILE * stream, gsl_matrix_int * m);
 int gsl_matrix_int_fprintf (FILE * stream, const gsl_matrix_int * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_int_swap_columns(gsl_matrix_int * m, const size_t i, const size_t
 int gsl_matrix_int_swap_rowcol(gsl_matrix_int * m, const size_t i, const size_t j);
 int gsl_matrix_int_transpose (gsl_matrix_int * m);
 int gsl_matrix_int_transpose_memcpy (gsl_matrix_int * dest, const gsl_matrix_int * src);
+int gsl_matrix_int_transpose_inplace (gsl_matrix_int * m);
 
 int gsl_matrix_int_max (const gsl_matrix_int * m);
 int gsl_matrix_int_min (const gsl_matrix_int * m);
@@ -245,6 +250,9 @@ int gsl_matrix_int_div_elements (gsl_matrix_int * a, const gsl_matrix_int * b);
 int gsl_matrix_int_scale (gsl_matrix_int * a, const double x);
 int gsl_matrix_int_add_constant (gsl_matrix_int * a, const double x);
 int gsl_matrix_int_add_diagonal (gsl_matrix_int * a, const double x);
+int gsl_matrix_int_axpby (const double alpha, const gsl_matrix_int * x, const double beta, gsl_matrix_int * y);
+int gsl_matrix_int_axpbyc (const double alpha, const gsl_matrix_int * x, const double beta, const double c, gsl_matrix_int * y);
+int gsl_matrix_int_map (gsl_matrix_int * a, int (* f) (int x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -211,6 +211,10 @@ void gsl_matrix_long_set_all (gsl_matrix_long * m, long x);
 
 int gsl_matrix_long_fread (FILE * stream, gsl_matrix_long * m) ;
 int gsl_matrix_long_fwrite (FILE * stream, const gsl_matrix_long * m) ;
+int gsl_matrix_long_fsave (FILE * stream, const gsl_matrix_long * m) ;
+gsl_matrix_long * gsl_matrix_long_fload (FILE * stream) ;
+const gsl_matrix_long * gsl_matrix_long_mmap (const char * filename) ;
+void gsl_matrix_long_munmap (const gsl_matrix_long * m) ;
 int gsl_matrix_long_fscanf (FILE * stream, gsl_matrix_long * m);
 int gsl_matrix_long_fprintf (FILE * stream, const gsl_matrix_long * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_long_swap_columns(gsl_matrix_long * m, const size_t i, const size
 int gsl_matrix_long_swap_rowcol(gsl_matrix_long * m, const size_t i, const size_t j);
 int gsl_matrix_long_transpose (gsl_matrix_long * m);
 int gsl_matrix_long_transpose_memcpy (gsl_matrix_long * dest, const gsl_matrix_long * src);
+int gsl_matrix_long_transpose_inplace (gsl_matrix_long * m);
 
 long gsl_matrix_long_max (const gsl_matrix_long * m);
 long gsl_matrix_long_min (const gsl_matrix_long * m);
@@ -245,6 +250,9 @@ int gsl_matrix_long_div_elements (gsl_matrix_long * a, const gsl_matrix_long * b
 int gsl_matrix_long_scale (gsl_matrix_long * a, const double x);
 int gsl_matrix_long_add_constant (gsl_matrix_long * a, const double x);
 int gsl_matrix_long_add_diagonal (gsl_matrix_long * a, const double x);
+int gsl_matrix_long_axpby (const double alpha, const gsl_matrix_long * x, const double beta, gsl_matrix_long * y);
+int gsl_matrix_long_axpbyc (const double alpha, const gsl_matrix_long * x, const double beta, const double c, gsl_matrix_long * y);
+int gsl_matrix_long_map (gsl_matrix_long * a, long (* f) (long x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -211,6 +211,10 @@ void gsl_matrix_long_double_set_all (gsl_matrix_long_double * m, long double x);
 
 int gsl_matrix_long_double_fread (FILE * stream, gsl_matrix_long_double * m) ;
 int gsl_matrix_long_double_fwrite (FILE * stream, const gsl_matrix_long_double * m) ;
+int gsl_matrix_long_double_fsave (FILE * stream, const gsl_matrix_long_double * m) ;
+gsl_matrix_long_double * gsl_matrix_long_double_fload (FILE * stream) ;
+const gsl_matrix_long_double * gsl_matrix_long_double_mmap (const char * filename) ;
+void gsl_matrix_long_double_munmap (const gsl_matrix_long_double * m) ;
 int gsl_matrix_long_double_fscanf (FILE * stream, gsl_matrix_long_double * m);
 int gsl_matrix_long_double_fprintf (FILE * stream, const gsl_matrix_long_double * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_long_double_swap_columns(gsl_matrix_long_double * m, const size_t
 int gsl_matrix_long_double_swap_rowcol(gsl_matrix_long_double * m, const size_t i, const size_t j);
 int gsl_matrix_long_double_transpose (gsl_matrix_long_double * m);
 int gsl_matrix_long_double_transpose_memcpy (gsl_matrix_long_double * dest, const gsl_matrix_long_double * src);
+int gsl_matrix_long_double_transpose_inplace (gsl_matrix_long_double * m);
 
 long double gsl_matrix_long_double_max (const gsl_matrix_long_double * m);
 long double gsl_matrix_long_double_min (const gsl_matrix_long_double * m);
@@ -245,6 +250,9 @@ int gsl_matrix_long_double_div_elements (gsl_matrix_long_double * a, const gsl_m
 int gsl_matrix_long_double_scale (gsl_matrix_long_double * a, const double x);
 int gsl_matrix_long_double_add_constant (gsl_matrix_long_double * a, const double x);
 int gsl_matrix_long_double_add_diagonal (gsl_matrix_long_double * a, const double x);
+int gsl_matrix_long_double_axpby (const double alpha, const gsl_matrix_long_double * x, const double beta, gsl_matrix_long_double * y);
+int gsl_matrix_long_double_axpbyc (const double alpha, const gsl_matrix_long_double * x, const double beta, const double c, gsl_matrix_long_double * y);
+int gsl_matrix_long_double_map (gsl_matrix_long_double * a, long double (* f) (long double x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
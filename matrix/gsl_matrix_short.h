@@ -211,6 +211,10 @@ void gsl_matrix_short_set_all (gsl_matrix_short * m, short x);
 
 int gsl_matrix_short_fread (FILE * stream, gsl_matrix_short * m) ;
 int gsl_matrix_short_fwrite (FILE * stream, const gsl_matrix_short * m) ;
+int gsl_matrix_short_fsave (FILE * stream, const gsl_matrix_short * m) ;
+gsl_matrix_short * gsl_matrix_short_fload (FILE * stream) ;
+const gsl_matrix_short * gsl_matrix_short_mmap (const char * filename) ;
+void gsl_matrix_short_munmap (const gsl_matrix_short * m) ;
 int gsl_matrix_short_fscanf (FILE * stream, gsl_matrix_short * m);
 int gsl_matrix_short_fprintf (FILE * stream, const gsl_matrix_short * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_short_swap_columns(gsl_matrix_short * m, const size_t i, const si
 int gsl_matrix_short_swap_rowcol(gsl_matrix_short * m, const size_t i, const size_t j);
 int gsl_matrix_short_transpose (gsl_matrix_short * m);
 int gsl_matrix_short_transpose_memcpy (gsl_matrix_short * dest, const gsl_matrix_short * src);
+int gsl_matrix_short_transpose_inplace (gsl_matrix_short * m);
 
 short gsl_matrix_short_max (const gsl_matrix_short * m);
 short gsl_matrix_short_min (const gsl_matrix_short * m);
@@ -245,6 +250,9 @@ int gsl_matrix_short_div_elements (gsl_matrix_short * a, const gsl_matrix_short
 int gsl_matrix_short_scale (gsl_matrix_short * a, const double x);
 int gsl_matrix_short_add_constant (gsl_matrix_short * a, const double x);
 int gsl_matrix_short_add_diagonal (gsl_matrix_short * a, const double x);
+int gsl_matrix_short_axpby (const double alpha, const gsl_matrix_short * x, const double beta, gsl_matrix_short * y);
+int gsl_matrix_short_axpbyc (const double alpha, const gsl_matrix_short * x, const double beta, const double c, gsl_matrix_short * y);
+int gsl_matrix_short_map (gsl_matrix_short * a, short (* f) (short x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
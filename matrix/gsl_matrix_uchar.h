@@ -211,6 +211,10 @@ void gsl_matrix_uchar_set_all (gsl_matrix_uchar * m, unsigned char x);
 
 int gsl_matrix_uchar_fread (FILE * stream, gsl_matrix_uchar * m) ;
 int gsl_matrix_uchar_fwrite (FILE * stream, const gsl_matrix_uchar * m) ;
+int gsl_matrix_uchar_fsave (FILE * stream, const gsl_matrix_uchar * m) ;
+gsl_matrix_uchar * gsl_matrix_uchar_fload (FILE * stream) ;
+const gsl_matrix_uchar * gsl_matrix_uchar_mmap (const char * filename) ;
+void gsl_matrix_uchar_munmap (const gsl_matrix_uchar * m) ;
 int gsl_matrix_uchar_fscanf (FILE * stream, gsl_matrix_uchar * m);
 int gsl_matrix_uchar_fprintf (FILE * stream, const gsl_matrix_uchar * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_uchar_swap_columns(gsl_matrix_uchar * m, const size_t i, const si
 int gsl_matrix_uchar_swap_rowcol(gsl_matrix_uchar * m, const size_t i, const size_t j);
 int gsl_matrix_uchar_transpose (gsl_matrix_uchar * m);
 int gsl_matrix_uchar_transpose_memcpy (gsl_matrix_uchar * dest, const gsl_matrix_uchar * src);
+int gsl_matrix_uchar_transpose_inplace (gsl_matrix_uchar * m);
 
 unsigned char gsl_matrix_uchar_max (const gsl_matrix_uchar * m);
 unsigned char gsl_matrix_uchar_min (const gsl_matrix_uchar * m);
@@ -245,6 +250,9 @@ int gsl_matrix_uchar_div_elements (gsl_matrix_uchar * a, const gsl_matrix_uchar
 int gsl_matrix_uchar_scale (gsl_matrix_uchar * a, const double x);
 int gsl_matrix_uchar_add_constant (gsl_matrix_uchar * a, const double x);
 int gsl_matrix_uchar_add_diagonal (gsl_matrix_uchar * a, const double x);
+int gsl_matrix_uchar_axpby (const double alpha, const gsl_matrix_uchar * x, const double beta, gsl_matrix_uchar * y);
+int gsl_matrix_uchar_axpbyc (const double alpha, const gsl_matrix_uchar * x, const double beta, const double c, gsl_matrix_uchar * y);
+int gsl_matrix_uchar_map (gsl_matrix_uchar * a, unsigned char (* f) (unsigned char x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -211,6 +211,10 @@ void gsl_matrix_uint_set_all (gsl_matrix_uint * m, unsigned int x);
 
 int gsl_matrix_uint_fread (FILE * stream, gsl_matrix_uint * m) ;
 int gsl_matrix_uint_fwrite (FILE * stream, const gsl_matrix_uint * m) ;
+int gsl_matrix_uint_fsave (FILE * stream, const gsl_matrix_uint * m) ;
+gsl_matrix_uint * gsl_matrix_uint_fload (FILE * stream) ;
+const gsl_matrix_uint * gsl_matrix_uint_mmap (const char * filename) ;
+void gsl_matrix_uint_munmap (const gsl_matrix_uint * m) ;
 int gsl_matrix_uint_fscanf (FILE * stream, gsl_matrix_uint * m);
 int gsl_matrix_uint_fprintf (FILE * stream, const gsl_matrix_uint * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_uint_swap_columns(gsl_matrix_uint * m, const size_t i, const size
 int gsl_matrix_uint_swap_rowcol(gsl_matrix_uint * m, const size_t i, const size_t j);
 int gsl_matrix_uint_transpose (gsl_matrix_uint * m);
 int gsl_matrix_uint_transpose_memcpy (gsl_matrix_uint * dest, const gsl_matrix_uint * src);
+int gsl_matrix_uint_transpose_inplace (gsl_matrix_uint * m);
 
 unsigned int gsl_matrix_uint_max (const gsl_matrix_uint * m);
 unsigned int gsl_matrix_uint_min (const gsl_matrix_uint * m);
@@ -245,6 +250,9 @@ int gsl_matrix_uint_div_elements (gsl_matrix_uint * a, const gsl_matrix_uint * b
 int gsl_matrix_uint_scale (gsl_matrix_uint * a, const double x);
 int gsl_matrix_uint_add_constant (gsl_matrix_uint * a, const double x);
 int gsl_matrix_uint_add_diagonal (gsl_matrix_uint * a, const double x);
+int gsl_matrix_uint_axpby (const double alpha, const gsl_matrix_uint * x, const double beta, gsl_matrix_uint * y);
+int gsl_matrix_uint_axpbyc (const double alpha, const gsl_matrix_uint * x, const double beta, const double c, gsl_matrix_uint * y);
+int gsl_matrix_uint_map (gsl_matrix_uint * a, unsigned int (* f) (unsigned int x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
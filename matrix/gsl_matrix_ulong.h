@@ -211,6 +211,10 @@ void gsl_matrix_ulong_set_all (gsl_matrix_ulong * m, unsigned long x);
 
 int gsl_matrix_ulong_fread (FILE * stream, gsl_matrix_ulong * m) ;
 int gsl_matrix_ulong_fwrite (FILE * stream, const gsl_matrix_ulong * m) ;
+int gsl_matrix_ulong_fsave (FILE * stream, const gsl_matrix_ulong * m) ;
+gsl_matrix_ulong * gsl_matrix_ulong_fload (FILE * stream) ;
+const gsl_matrix_ulong * gsl_matrix_ulong_mmap (const char * filename) ;
+void gsl_matrix_ulong_munmap (const gsl_matrix_ulong * m) ;
 int gsl_matrix_ulong_fscanf (FILE * stream, gsl_matrix_ulong * m);
 int gsl_matrix_ulong_fprintf (FILE * stream, const gsl_matrix_ulong * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_ulong_swap_columns(gsl_matrix_ulong * m, const size_t i, const si
 int gsl_matrix_ulong_swap_rowcol(gsl_matrix_ulong * m, const size_t i, const size_t j);
 int gsl_matrix_ulong_transpose (gsl_matrix_ulong * m);
 int gsl_matrix_ulong_transpose_memcpy (gsl_matrix_ulong * dest, const gsl_matrix_ulong * src);
+int gsl_matrix_ulong_transpose_inplace (gsl_matrix_ulong * m);
 
 unsigned long gsl_matrix_ulong_max (const gsl_matrix_ulong * m);
 unsigned long gsl_matrix_ulong_min (const gsl_matrix_ulong * m);
@@ -245,6 +250,9 @@ int gsl_matrix_ulong_div_elements (gsl_matrix_ulong * a, const gsl_matrix_ulong
 int gsl_matrix_ulong_scale (gsl_matrix_ulong * a, const double x);
 int gsl_matrix_ulong_add_constant (gsl_matrix_ulong * a, const double x);
 int gsl_matrix_ulong_add_diagonal (gsl_matrix_ulong * a, const double x);
+int gsl_matrix_ulong_axpby (const double alpha, const gsl_matrix_ulong * x, const double beta, gsl_matrix_ulong * y);
+int gsl_matrix_ulong_axpbyc (const double alpha, const gsl_matrix_ulong * x, const double beta, const double c, gsl_matrix_ulong * y);
+int gsl_matrix_ulong_map (gsl_matrix_ulong * a, unsigned long (* f) (unsigned long x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
@@ -211,6 +211,10 @@ void gsl_matrix_ushort_set_all (gsl_matrix_ushort * m, unsigned short x);
 
 int gsl_matrix_ushort_fread (FILE * stream, gsl_matrix_ushort * m) ;
 int gsl_matrix_ushort_fwrite (FILE * stream, const gsl_matrix_ushort * m) ;
+int gsl_matrix_ushort_fsave (FILE * stream, const gsl_matrix_ushort * m) ;
+gsl_matrix_ushort * gsl_matrix_ushort_fload (FILE * stream) ;
+const gsl_matrix_ushort * gsl_matrix_ushort_mmap (const char * filename) ;
+void gsl_matrix_ushort_munmap (const gsl_matrix_ushort * m) ;
 int gsl_matrix_ushort_fscanf (FILE * stream, gsl_matrix_ushort * m);
 int gsl_matrix_ushort_fprintf (FILE * stream, const gsl_matrix_ushort * m, const char * format);
  
@@ -222,6 +226,7 @@ int gsl_matrix_ushort_swap_columns(gsl_matrix_ushort * m, const size_t i, const
 int gsl_matrix_ushort_swap_rowcol(gsl_matrix_ushort * m, const size_t i, const size_t j);
 int gsl_matrix_ushort_transpose (gsl_matrix_ushort * m);
 int gsl_matrix_ushort_transpose_memcpy (gsl_matrix_ushort * dest, const gsl_matrix_ushort * src);
+int gsl_matrix_ushort_transpose_inplace (gsl_matrix_ushort * m);
 
 unsigned short gsl_matrix_ushort_max (const gsl_matrix_ushort * m);
 unsigned short gsl_matrix_ushort_min (const gsl_matrix_ushort * m);
@@ -245,6 +250,9 @@ int gsl_matrix_ushort_div_elements (gsl_matrix_ushort * a, const gsl_matrix_usho
 int gsl_matrix_ushort_scale (gsl_matrix_ushort * a, const double x);
 int gsl_matrix_ushort_add_constant (gsl_matrix_ushort * a, const double x);
 int gsl_matrix_ushort_add_diagonal (gsl_matrix_ushort * a, const double x);
+int gsl_matrix_ushort_axpby (const double alpha, const gsl_matrix_ushort * x, const double beta, gsl_matrix_ushort * y);
+int gsl_matrix_ushort_axpbyc (const double alpha, const gsl_matrix_ushort * x, const double beta, const double c, gsl_matrix_ushort * y);
+int gsl_matrix_ushort_map (gsl_matrix_ushort * a, unsigned short (* f) (unsigned short x, void * params), void * params);
 
 /***********************************************************************/
 /* The functions below are obsolete                                    */
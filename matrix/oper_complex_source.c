@@ -35,15 +35,27 @@ FUNCTION (gsl_matrix, add) (TYPE (gsl_matrix) * a,
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < 2 * M * N; i++)
             {
-              const size_t aij = 2 * (i * tda_a + j);
-              const size_t bij = 2 * (i * tda_b + j);
+              pa[i] += pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              ATOMIC * const pa = a->data + 2 * i * tda_a;
+              const ATOMIC * const pb = b->data + 2 * i * tda_b;
 
-              a->data[aij] += b->data[bij];
-              a->data[aij + 1] += b->data[bij + 1];
+              for (j = 0; j < 2 * N; j++)
+                {
+                  pa[j] += pb[j];
+                }
             }
         }
 
@@ -69,15 +81,27 @@ FUNCTION (gsl_matrix, sub) (TYPE (gsl_matrix) * a,
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < 2 * M * N; i++)
             {
-              const size_t aij = 2 * (i * tda_a + j);
-              const size_t bij = 2 * (i * tda_b + j);
+              pa[i] -= pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              ATOMIC * const pa = a->data + 2 * i * tda_a;
+              const ATOMIC * const pb = b->data + 2 * i * tda_b;
 
-              a->data[aij] -= b->data[bij];
-              a->data[aij + 1] -= b->data[bij + 1];
+              for (j = 0; j < 2 * N; j++)
+                {
+                  pa[j] -= pb[j];
+                }
             }
         }
 
@@ -206,12 +230,17 @@ int FUNCTION (gsl_matrix, add_constant) (TYPE (gsl_matrix) * a, const BASE x)
 
   size_t i, j;
 
+  const ATOMIC xr = GSL_REAL (x);
+  const ATOMIC xi = GSL_IMAG (x);
+
   for (i = 0; i < M; i++)
     {
+      ATOMIC * const pa = a->data + 2 * i * tda;
+
       for (j = 0; j < N; j++)
         {
-          a->data[2 * (i * tda + j)] += GSL_REAL (x);
-          a->data[2 * (i * tda + j) + 1] += GSL_IMAG (x);
+          pa[2 * j] += xr;
+          pa[2 * j + 1] += xi;
         }
     }
 
@@ -234,3 +263,89 @@ int FUNCTION (gsl_matrix, add_diagonal) (TYPE (gsl_matrix) * a, const BASE x)
 
   return GSL_SUCCESS;
 }
+
+/* Compute y = alpha x + beta y in a single pass over x and y */
+
+int
+FUNCTION (gsl_matrix, axpby) (const BASE alpha, const TYPE (gsl_matrix) * x,
+                              const BASE beta, TYPE (gsl_matrix) * y)
+{
+  const BASE zero = ZERO;
+
+  return FUNCTION (gsl_matrix, axpbyc) (alpha, x, beta, zero, y);
+}
+
+/* Compute y = alpha x + beta y + c in a single pass over x and y */
+
+int
+FUNCTION (gsl_matrix, axpbyc) (const BASE alpha, const TYPE (gsl_matrix) * x,
+                               const BASE beta, const BASE c,
+                               TYPE (gsl_matrix) * y)
+{
+  const size_t M = x->size1;
+  const size_t N = x->size2;
+
+  if (y->size1 != M || y->size2 != N)
+    {
+      GSL_ERROR ("matrices must have same dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t tda_x = x->tda;
+      const size_t tda_y = y->tda;
+
+      const ATOMIC ar = GSL_REAL (alpha);
+      const ATOMIC ai = GSL_IMAG (alpha);
+      const ATOMIC br = GSL_REAL (beta);
+      const ATOMIC bi = GSL_IMAG (beta);
+      const ATOMIC cr = GSL_REAL (c);
+      const ATOMIC ci = GSL_IMAG (c);
+
+      size_t i, j;
+
+      for (i = 0; i < M; i++)
+        {
+          const ATOMIC * const px = x->data + 2 * i * tda_x;
+          ATOMIC * const py = y->data + 2 * i * tda_y;
+
+          for (j = 0; j < N; j++)
+            {
+              const ATOMIC xr = px[2 * j];
+              const ATOMIC xi = px[2 * j + 1];
+              const ATOMIC yr = py[2 * j];
+              const ATOMIC yi = py[2 * j + 1];
+
+              py[2 * j] = (ar * xr - ai * xi) + (br * yr - bi * yi) + cr;
+              py[2 * j + 1] = (ar * xi + ai * xr) + (br * yi + bi * yr) + ci;
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Replace each element a_ij by f(a_ij, params) */
+
+int
+FUNCTION (gsl_matrix, map) (TYPE (gsl_matrix) * a,
+                            BASE (* f) (BASE z, void * params),
+                            void * params)
+{
+  const size_t M = a->size1;
+  const size_t N = a->size2;
+  const size_t tda = a->tda;
+
+  size_t i, j;
+
+  for (i = 0; i < M; i++)
+    {
+      BASE * const pa = (BASE *) (a->data + 2 * i * tda);
+
+      for (j = 0; j < N; j++)
+        {
+          pa[j] = f (pa[j], params);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
@@ -34,11 +34,27 @@ FUNCTION(gsl_matrix, add) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix) * b)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < M * N; i++)
             {
-              a->data[i * tda_a + j] += b->data[i * tda_b + j];
+              pa[i] += pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              ATOMIC * const pa = a->data + i * tda_a;
+              const ATOMIC * const pb = b->data + i * tda_b;
+
+              for (j = 0; j < N; j++)
+                {
+                  pa[j] += pb[j];
+                }
             }
         }
       
@@ -63,11 +79,27 @@ FUNCTION(gsl_matrix, sub) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix) * b)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < M * N; i++)
+            {
+              pa[i] -= pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
             {
-              a->data[i * tda_a + j] -= b->data[i * tda_b + j];
+              ATOMIC * const pa = a->data + i * tda_a;
+              const ATOMIC * const pb = b->data + i * tda_b;
+
+              for (j = 0; j < N; j++)
+                {
+                  pa[j] -= pb[j];
+                }
             }
         }
       
@@ -92,11 +124,27 @@ FUNCTION(gsl_matrix, mul_elements) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < M * N; i++)
+            {
+              pa[i] *= pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
             {
-              a->data[i * tda_a + j] *= b->data[i * tda_b + j];
+              ATOMIC * const pa = a->data + i * tda_a;
+              const ATOMIC * const pb = b->data + i * tda_b;
+
+              for (j = 0; j < N; j++)
+                {
+                  pa[j] *= pb[j];
+                }
             }
         }
       
@@ -121,11 +169,27 @@ FUNCTION(gsl_matrix, div_elements) (TYPE(gsl_matrix) * a, const TYPE(gsl_matrix)
 
       size_t i, j;
 
-      for (i = 0; i < M; i++)
+      if (tda_a == N && tda_b == N)
         {
-          for (j = 0; j < N; j++)
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < M * N; i++)
+            {
+              pa[i] /= pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
             {
-              a->data[i * tda_a + j] /= b->data[i * tda_b + j];
+              ATOMIC * const pa = a->data + i * tda_a;
+              const ATOMIC * const pb = b->data + i * tda_b;
+
+              for (j = 0; j < N; j++)
+                {
+                  pa[j] /= pb[j];
+                }
             }
         }
       
@@ -141,12 +205,26 @@ FUNCTION(gsl_matrix, scale) (TYPE(gsl_matrix) * a, const double x)
   const size_t tda = a->tda;
   
   size_t i, j;
-  
-  for (i = 0; i < M; i++)
+
+  if (tda == N)
     {
-      for (j = 0; j < N; j++)
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < M * N; i++)
         {
-          a->data[i * tda + j] *= x;
+          pa[i] *= x;
+        }
+    }
+  else
+    {
+      for (i = 0; i < M; i++)
+        {
+          ATOMIC * const pa = a->data + i * tda;
+
+          for (j = 0; j < N; j++)
+            {
+              pa[j] *= x;
+            }
         }
     }
   
@@ -162,18 +240,31 @@ FUNCTION(gsl_matrix, add_constant) (TYPE(gsl_matrix) * a, const double x)
 
   size_t i, j;
 
-  for (i = 0; i < M; i++)
+  if (tda == N)
     {
-      for (j = 0; j < N; j++)
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < M * N; i++)
         {
-          a->data[i * tda + j] += x;
+          pa[i] += x;
+        }
+    }
+  else
+    {
+      for (i = 0; i < M; i++)
+        {
+          ATOMIC * const pa = a->data + i * tda;
+
+          for (j = 0; j < N; j++)
+            {
+              pa[j] += x;
+            }
         }
     }
   
   return GSL_SUCCESS;
 }
 
-
 int 
 FUNCTION(gsl_matrix, add_diagonal) (TYPE(gsl_matrix) * a, const double x)
 {
@@ -189,3 +280,138 @@ FUNCTION(gsl_matrix, add_diagonal) (TYPE(gsl_matrix) * a, const double x)
 
   return GSL_SUCCESS;
 }
+
+/* Compute y = alpha x + beta y in a single pass over x and y */
+
+int
+FUNCTION(gsl_matrix, axpby) (const double alpha, const TYPE(gsl_matrix) * x,
+                             const double beta, TYPE(gsl_matrix) * y)
+{
+  const size_t M = x->size1;
+  const size_t N = x->size2;
+
+  if (y->size1 != M || y->size2 != N)
+    {
+      GSL_ERROR ("matrices must have same dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t tda_x = x->tda;
+      const size_t tda_y = y->tda;
+
+      size_t i, j;
+
+      if (tda_x == N && tda_y == N)
+        {
+          const ATOMIC * const px = x->data;
+          ATOMIC * const py = y->data;
+
+          for (i = 0; i < M * N; i++)
+            {
+              py[i] = alpha * px[i] + beta * py[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              const ATOMIC * const px = x->data + i * tda_x;
+              ATOMIC * const py = y->data + i * tda_y;
+
+              for (j = 0; j < N; j++)
+                {
+                  py[j] = alpha * px[j] + beta * py[j];
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Compute y = alpha x + beta y + c in a single pass over x and y */
+
+int
+FUNCTION(gsl_matrix, axpbyc) (const double alpha, const TYPE(gsl_matrix) * x,
+                              const double beta, const double c,
+                              TYPE(gsl_matrix) * y)
+{
+  const size_t M = x->size1;
+  const size_t N = x->size2;
+
+  if (y->size1 != M || y->size2 != N)
+    {
+      GSL_ERROR ("matrices must have same dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t tda_x = x->tda;
+      const size_t tda_y = y->tda;
+
+      size_t i, j;
+
+      if (tda_x == N && tda_y == N)
+        {
+          const ATOMIC * const px = x->data;
+          ATOMIC * const py = y->data;
+
+          for (i = 0; i < M * N; i++)
+            {
+              py[i] = alpha * px[i] + beta * py[i] + c;
+            }
+        }
+      else
+        {
+          for (i = 0; i < M; i++)
+            {
+              const ATOMIC * const px = x->data + i * tda_x;
+              ATOMIC * const py = y->data + i * tda_y;
+
+              for (j = 0; j < N; j++)
+                {
+                  py[j] = alpha * px[j] + beta * py[j] + c;
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Replace each element a_ij by f(a_ij, params) */
+
+int
+FUNCTION(gsl_matrix, map) (TYPE(gsl_matrix) * a,
+                           BASE (* f) (BASE x, void * params),
+                           void * params)
+{
+  const size_t M = a->size1;
+  const size_t N = a->size2;
+  const size_t tda = a->tda;
+
+  size_t i, j;
+
+  if (tda == N)
+    {
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < M * N; i++)
+        {
+          pa[i] = f (pa[i], params);
+        }
+    }
+  else
+    {
+      for (i = 0; i < M; i++)
+        {
+          ATOMIC * const pa = a->data + i * tda;
+
+          for (j = 0; j < N; j++)
+            {
+              pa[j] = f (pa[j], params);
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+}
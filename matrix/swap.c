@@ -1,8 +1,12 @@
 #include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_errno.h>
 
+#define TRANSPOSE_BLOCK 32
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "swap_source.c"
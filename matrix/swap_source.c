@@ -142,31 +142,47 @@ FUNCTION (gsl_matrix, swap_rowcol) (TYPE (gsl_matrix) * m,
 }
 
 
+/* The transposes below visit the matrix in square tiles of
+   TRANSPOSE_BLOCK elements on a side, so that the rows touched on both
+   sides of the exchange stay in cache while a tile is processed,
+   instead of striding through memory by tda on every element. */
+
 int
 FUNCTION (gsl_matrix, transpose) (TYPE (gsl_matrix) * m)
 {
   const size_t size1 = m->size1;
   const size_t size2 = m->size2;
-  size_t i, j, k;
+  const size_t tda = m->tda;
+  size_t ib, jb, i, j, k;
 
   if (size1 != size2)
     {
       GSL_ERROR ("matrix must be square to take transpose", GSL_ENOTSQR);
     }
 
-  for (i = 0; i < size1; i++)
+  for (ib = 0; ib < size1; ib += TRANSPOSE_BLOCK)
     {
-      for (j = i + 1 ; j < size2 ; j++) 
+      const size_t imax = GSL_MIN (ib + TRANSPOSE_BLOCK, size1);
+
+      for (jb = ib; jb < size2; jb += TRANSPOSE_BLOCK)
         {
-          for (k = 0; k < MULTIPLICITY; k++)
+          const size_t jmax = GSL_MIN (jb + TRANSPOSE_BLOCK, size2);
+
+          for (i = ib; i < imax; i++)
             {
-              size_t e1 = (i *  m->tda + j) * MULTIPLICITY + k ;
-              size_t e2 = (j *  m->tda + i) * MULTIPLICITY + k ;
-              {
-                ATOMIC tmp = m->data[e1] ;
-                m->data[e1] = m->data[e2] ;
-                m->data[e2] = tmp ;
-              }
+              for (j = GSL_MAX (jb, i + 1); j < jmax; j++)
+                {
+                  for (k = 0; k < MULTIPLICITY; k++)
+                    {
+                      size_t e1 = (i * tda + j) * MULTIPLICITY + k ;
+                      size_t e2 = (j * tda + i) * MULTIPLICITY + k ;
+                      {
+                        ATOMIC tmp = m->data[e1] ;
+                        m->data[e1] = m->data[e2] ;
+                        m->data[e2] = tmp ;
+                      }
+                    }
+                }
             }
         }
     }
@@ -184,7 +200,7 @@ FUNCTION (gsl_matrix, transpose_memcpy) (TYPE (gsl_matrix) * dest,
   const size_t dest_size1 = dest->size1;
   const size_t dest_size2 = dest->size2;
 
-  size_t i, j, k;
+  size_t ib, jb, i, j, k;
 
   if (dest_size2 != src_size1 || dest_size1 != src_size2)
     {
@@ -192,19 +208,101 @@ FUNCTION (gsl_matrix, transpose_memcpy) (TYPE (gsl_matrix) * dest,
                  GSL_EBADLEN);
     }
 
-  for (i = 0; i < dest_size1; i++)
+  for (ib = 0; ib < dest_size1; ib += TRANSPOSE_BLOCK)
+    {
+      const size_t imax = GSL_MIN (ib + TRANSPOSE_BLOCK, dest_size1);
+
+      for (jb = 0; jb < dest_size2; jb += TRANSPOSE_BLOCK)
+        {
+          const size_t jmax = GSL_MIN (jb + TRANSPOSE_BLOCK, dest_size2);
+
+          for (i = ib; i < imax; i++)
+            {
+              for (j = jb; j < jmax; j++)
+                {
+                  for (k = 0; k < MULTIPLICITY; k++)
+                    {
+                      size_t e1 = (i * dest->tda + j) * MULTIPLICITY + k ;
+                      size_t e2 = (j * src->tda + i) * MULTIPLICITY + k ;
+
+                      dest->data[e1] = src->data[e2] ;
+                    }
+                }
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Transpose a contiguous (tda == size2) rectangular matrix in place.
+   In row-major order the element at offset l, 0 < l < n - 1, of the
+   size1-by-size2 matrix moves to offset (l * size1) mod (n - 1),
+   where n = size1 * size2.  Each cycle of this permutation is followed
+   once, with a bit array recording the offsets already placed. */
+
+int
+FUNCTION (gsl_matrix, transpose_inplace) (TYPE (gsl_matrix) * m)
+{
+  const size_t size1 = m->size1;
+  const size_t size2 = m->size2;
+  const size_t n = size1 * size2;
+
+  if (m->tda != size2)
+    {
+      GSL_ERROR ("matrix must be contiguous to transpose in place",
+                 GSL_EINVAL);
+    }
+
+  if (size1 == size2)
     {
-      for (j = 0 ; j < dest_size2; j++) 
+      return FUNCTION (gsl_matrix, transpose) (m);
+    }
+
+  if (size1 > 1 && size2 > 1)
+    {
+      unsigned char *done = calloc ((n + 7) / 8, 1);
+      size_t start, l, k;
+
+      if (done == 0)
         {
+          GSL_ERROR ("failed to allocate space for cycle flags", GSL_ENOMEM);
+        }
+
+      for (start = 1; start < n - 1; start++)
+        {
+          ATOMIC tmp[MULTIPLICITY];
+
+          if (done[start / 8] & (1u << (start % 8)))
+            continue;
+
           for (k = 0; k < MULTIPLICITY; k++)
+            tmp[k] = m->data[start * MULTIPLICITY + k];
+
+          l = start;
+
+          do
             {
-              size_t e1 = (i *  dest->tda + j) * MULTIPLICITY + k ;
-              size_t e2 = (j *  src->tda + i) * MULTIPLICITY + k ;
+              l = (l * size1) % (n - 1);
+
+              for (k = 0; k < MULTIPLICITY; k++)
+                {
+                  ATOMIC t = m->data[l * MULTIPLICITY + k];
+                  m->data[l * MULTIPLICITY + k] = tmp[k];
+                  tmp[k] = t;
+                }
 
-              dest->data[e1] = src->data[e2] ;
+              done[l / 8] |= (unsigned char) (1u << (l % 8));
             }
+          while (l != start);
         }
+
+      free (done);
     }
 
+  m->size1 = size2;
+  m->size2 = size1;
+  m->tda = size1;
+
   return GSL_SUCCESS;
 }
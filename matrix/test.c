@@ -152,6 +152,21 @@ main (void)
   test_complex_float_func (M, N);
   test_complex_long_double_func (M, N);
 
+  test_transpose (M, N);
+  test_float_transpose (M, N);
+  test_long_double_transpose (M, N);
+  test_ulong_transpose (M, N);
+  test_long_transpose (M, N);
+  test_uint_transpose (M, N);
+  test_int_transpose (M, N);
+  test_ushort_transpose (M, N);
+  test_short_transpose (M, N);
+  test_uchar_transpose (M, N);
+  test_char_transpose (M, N);
+  test_complex_transpose (M, N);
+  test_complex_float_transpose (M, N);
+  test_complex_long_double_transpose (M, N);
+
   test_ops (M, N);
   test_float_ops (M, N);
   test_long_double_ops (M, N);
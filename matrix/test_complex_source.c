@@ -18,14 +18,25 @@
  */
 
 void FUNCTION (test, func) (const size_t M, const size_t N);
+void FUNCTION (test, transpose) (const size_t M, const size_t N);
 void FUNCTION (test, ops) (const size_t P, const size_t Q);
 void FUNCTION (test, trap) (const size_t M, const size_t N);
 void FUNCTION (test, text) (const size_t M, const size_t N);
 void FUNCTION (test, binary) (const size_t M, const size_t N);
 void FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N);
+BASE FUNCTION (test, map_func) (BASE z, void * params);
 
 #define TEST(expr,desc) gsl_test((expr), NAME(gsl_matrix) desc " M=%d, N=%d", M, N)
 
+BASE
+FUNCTION (test, map_func) (BASE z, void * params)
+{
+  BASE r;
+  GSL_REAL (r) = GSL_IMAG (z) + *(const ATOMIC *) params;
+  GSL_IMAG (r) = GSL_REAL (z);
+  return r;
+}
+
 void
 FUNCTION (test, func) (const size_t M, const size_t N)
 {
@@ -240,6 +251,102 @@ FUNCTION (test, func) (const size_t M, const size_t N)
   FUNCTION (gsl_matrix, free) (m);      /* free whatever is in m */
 }
 
+void
+FUNCTION (test, transpose) (const size_t M, const size_t N)
+{
+  TYPE (gsl_matrix) * a = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * b = FUNCTION (gsl_matrix, alloc) (N, M);
+  TYPE (gsl_matrix) * c = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * big = FUNCTION (gsl_matrix, calloc) (N + 3, M + 5);
+  size_t i, j, k;
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          for (k = 0; k < MULTIPLICITY; k++)
+            {
+              a->data[(i * a->tda + j) * MULTIPLICITY + k] =
+                (ATOMIC) ((i * N + j) * MULTIPLICITY + k);
+            }
+        }
+    }
+
+  FUNCTION (gsl_matrix, transpose_memcpy) (b, a);
+
+  {
+    int status = 0;
+
+    for (i = 0; i < M; i++)
+      for (j = 0; j < N; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (b->data[(j * b->tda + i) * MULTIPLICITY + k] !=
+              a->data[(i * a->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose_memcpy");
+  }
+
+  {
+    QUALIFIED_VIEW (gsl_matrix, view) d =
+      FUNCTION (gsl_matrix, submatrix) (big, 1, 2, N, M);
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose_memcpy) (&d.matrix, a);
+
+    for (i = 0; i < N; i++)
+      for (j = 0; j < M; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (d.matrix.data[(i * d.matrix.tda + j) * MULTIPLICITY + k] !=
+              b->data[(i * b->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose_memcpy noncontiguous");
+  }
+
+  {
+    int status = 0;
+
+    FUNCTION (gsl_matrix, memcpy) (c, a);
+    FUNCTION (gsl_matrix, transpose_inplace) (c);
+
+    if (c->size1 != N || c->size2 != M || c->tda != M)
+      status = 1;
+
+    for (i = 0; i < N; i++)
+      for (j = 0; j < M; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (c->data[(i * c->tda + j) * MULTIPLICITY + k] !=
+              b->data[(i * b->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose_inplace");
+  }
+
+  {
+    const size_t P = GSL_MIN (M, N);
+    QUALIFIED_VIEW (gsl_matrix, view) s =
+      FUNCTION (gsl_matrix, submatrix) (a, 0, 0, P, P);
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose) (&s.matrix);
+
+    for (i = 0; i < P; i++)
+      for (j = 0; j < P; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (s.matrix.data[(i * s.matrix.tda + j) * MULTIPLICITY + k] !=
+              b->data[(i * b->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose");
+  }
+
+  FUNCTION (gsl_matrix, free) (a);
+  FUNCTION (gsl_matrix, free) (b);
+  FUNCTION (gsl_matrix, free) (c);
+  FUNCTION (gsl_matrix, free) (big);
+}
+
 #if !(USES_LONGDOUBLE && !HAVE_PRINTF_LONGDOUBLE)
 void
 FUNCTION (test, text) (const size_t M, const size_t N)
@@ -734,6 +841,113 @@ FUNCTION (test, ops) (const size_t P, const size_t Q)
     gsl_test (status, NAME (gsl_matrix) "_add_diagonal");
   }
 
+  {
+    BASE alpha, beta, c;
+    GSL_SET_COMPLEX(&alpha, 1.0, 1.0);
+    GSL_SET_COMPLEX(&beta, 2.0, -1.0);
+    GSL_SET_COMPLEX(&c, 1.0, 2.0);
+
+    FUNCTION (gsl_matrix, memcpy) (m, a);
+    FUNCTION (gsl_matrix, axpbyc) (alpha, b, beta, c, m);
+
+    k = 0;
+    status = 0;
+
+    for (i = 0; i < P; i++)
+      {
+        for (j = 0; j < Q; j++)
+          {
+            /* alpha (k+5, k+20) + beta (k, k+10) + c */
+            ATOMIC real = (ATOMIC) (3 * (ATOMIC)k - 4);
+            ATOMIC imag = (ATOMIC) (3 * (ATOMIC)k + 47);
+            BASE z = FUNCTION (gsl_matrix, get) (m, i, j);
+            if (GSL_REAL (z) != real || GSL_IMAG (z) != imag)
+              {
+                status = 1;
+              }
+            k++;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_axpbyc");
+
+    FUNCTION (gsl_matrix, memcpy) (m, a);
+    FUNCTION (gsl_matrix, axpby) (alpha, b, beta, m);
+
+    k = 0;
+    status = 0;
+
+    for (i = 0; i < P; i++)
+      {
+        for (j = 0; j < Q; j++)
+          {
+            ATOMIC real = (ATOMIC) (3 * (ATOMIC)k - 5);
+            ATOMIC imag = (ATOMIC) (3 * (ATOMIC)k + 45);
+            BASE z = FUNCTION (gsl_matrix, get) (m, i, j);
+            if (GSL_REAL (z) != real || GSL_IMAG (z) != imag)
+              {
+                status = 1;
+              }
+            k++;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_axpby");
+  }
+
+  {
+    ATOMIC s = 3;
+
+    FUNCTION (gsl_matrix, memcpy) (m, a);
+    FUNCTION (gsl_matrix, map) (m, FUNCTION (test, map_func), &s);
+
+    k = 0;
+    status = 0;
+
+    for (i = 0; i < P; i++)
+      {
+        for (j = 0; j < Q; j++)
+          {
+            ATOMIC real = (ATOMIC) ((ATOMIC)k + 13);
+            ATOMIC imag = (ATOMIC) k;
+            BASE z = FUNCTION (gsl_matrix, get) (m, i, j);
+            if (GSL_REAL (z) != real || GSL_IMAG (z) != imag)
+              {
+                status = 1;
+              }
+            k++;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_map");
+  }
+
+  if (P > 2 && Q > 3)
+    {
+      QUALIFIED_VIEW (gsl_matrix, view) sa =
+        FUNCTION (gsl_matrix, submatrix) (a, 1, 2, P - 2, Q - 3);
+      QUALIFIED_VIEW (gsl_matrix, view) sm =
+        FUNCTION (gsl_matrix, submatrix) (m, 2, 1, P - 2, Q - 3);
+
+      FUNCTION (gsl_matrix, set_zero) (m);
+      FUNCTION (gsl_matrix, add) (&sm.matrix, &sa.matrix);
+
+      status = 0;
+
+      for (i = 0; i < P; i++)
+        {
+          for (j = 0; j < Q; j++)
+            {
+              BASE z = FUNCTION (gsl_matrix, get) (m, i, j);
+              BASE y = ZERO;
+              if (i >= 2 && j >= 1 && j < Q - 2)
+                y = FUNCTION (gsl_matrix, get) (a, i - 1, j + 1);
+              if (GSL_REAL (z) != GSL_REAL (y) || GSL_IMAG (z) != GSL_IMAG (y))
+                {
+                  status = 1;
+                }
+            }
+        }
+      gsl_test (status, NAME (gsl_matrix) "_add noncontiguous");
+    }
+
   {
     FUNCTION (gsl_matrix, swap) (a, b);
 
@@ -18,14 +18,22 @@
  */
 
 void FUNCTION (test, func) (const size_t M, const size_t N);
+void FUNCTION (test, transpose) (const size_t M, const size_t N);
 void FUNCTION (test, ops) (const size_t M, const size_t N);
 void FUNCTION (test, trap) (const size_t M, const size_t N);
 void FUNCTION (test, text) (const size_t M, const size_t N);
 void FUNCTION (test, binary) (const size_t M, const size_t N);
 void FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N);
+BASE FUNCTION (test, map_func) (BASE x, void * params);
 
 #define TEST(expr,desc) gsl_test((expr), NAME(gsl_matrix) desc " M=%d, N=%d", M, N)
 
+BASE
+FUNCTION (test, map_func) (BASE x, void * params)
+{
+  return x + *(const BASE *) params;
+}
+
 void
 FUNCTION (test, func) (const size_t M, const size_t N)
 {
@@ -413,6 +421,102 @@ FUNCTION (test, func) (const size_t M, const size_t N)
   FUNCTION (gsl_vector, free) (v);
 }
 
+void
+FUNCTION (test, transpose) (const size_t M, const size_t N)
+{
+  TYPE (gsl_matrix) * a = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * b = FUNCTION (gsl_matrix, alloc) (N, M);
+  TYPE (gsl_matrix) * c = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * big = FUNCTION (gsl_matrix, calloc) (N + 3, M + 5);
+  size_t i, j, k;
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          for (k = 0; k < MULTIPLICITY; k++)
+            {
+              a->data[(i * a->tda + j) * MULTIPLICITY + k] =
+                (ATOMIC) ((i * N + j) * MULTIPLICITY + k);
+            }
+        }
+    }
+
+  FUNCTION (gsl_matrix, transpose_memcpy) (b, a);
+
+  {
+    int status = 0;
+
+    for (i = 0; i < M; i++)
+      for (j = 0; j < N; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (b->data[(j * b->tda + i) * MULTIPLICITY + k] !=
+              a->data[(i * a->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose_memcpy");
+  }
+
+  {
+    QUALIFIED_VIEW (gsl_matrix, view) d =
+      FUNCTION (gsl_matrix, submatrix) (big, 1, 2, N, M);
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose_memcpy) (&d.matrix, a);
+
+    for (i = 0; i < N; i++)
+      for (j = 0; j < M; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (d.matrix.data[(i * d.matrix.tda + j) * MULTIPLICITY + k] !=
+              b->data[(i * b->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose_memcpy noncontiguous");
+  }
+
+  {
+    int status = 0;
+
+    FUNCTION (gsl_matrix, memcpy) (c, a);
+    FUNCTION (gsl_matrix, transpose_inplace) (c);
+
+    if (c->size1 != N || c->size2 != M || c->tda != M)
+      status = 1;
+
+    for (i = 0; i < N; i++)
+      for (j = 0; j < M; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (c->data[(i * c->tda + j) * MULTIPLICITY + k] !=
+              b->data[(i * b->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose_inplace");
+  }
+
+  {
+    const size_t P = GSL_MIN (M, N);
+    QUALIFIED_VIEW (gsl_matrix, view) s =
+      FUNCTION (gsl_matrix, submatrix) (a, 0, 0, P, P);
+    int status = 0;
+
+    FUNCTION (gsl_matrix, transpose) (&s.matrix);
+
+    for (i = 0; i < P; i++)
+      for (j = 0; j < P; j++)
+        for (k = 0; k < MULTIPLICITY; k++)
+          if (s.matrix.data[(i * s.matrix.tda + j) * MULTIPLICITY + k] !=
+              b->data[(i * b->tda + j) * MULTIPLICITY + k])
+            status = 1;
+
+    TEST (status, "_transpose");
+  }
+
+  FUNCTION (gsl_matrix, free) (a);
+  FUNCTION (gsl_matrix, free) (b);
+  FUNCTION (gsl_matrix, free) (c);
+  FUNCTION (gsl_matrix, free) (big);
+}
+
 
 void
 FUNCTION (test, ops) (const size_t M, const size_t N)
@@ -589,6 +693,115 @@ FUNCTION (test, ops) (const size_t M, const size_t N)
   }
 
 
+  {
+    TYPE (gsl_matrix) * x = FUNCTION (gsl_matrix, alloc) (M, N);
+    QUALIFIED_VIEW (gsl_matrix, view) sx =
+      FUNCTION (gsl_matrix, submatrix) (x, 1, 2, M - 2, N - 3);
+    QUALIFIED_VIEW (gsl_matrix, view) sm =
+      FUNCTION (gsl_matrix, submatrix) (m, 2, 1, M - 2, N - 3);
+    int status = 0;
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            FUNCTION (gsl_matrix, set) (x, i, j, (BASE)((i + j) % 10));
+            FUNCTION (gsl_matrix, set) (m, i, j, (BASE)((i + 2 * j) % 7));
+          }
+      }
+
+    FUNCTION(gsl_matrix, axpby) (2.0, x, 3.0, m);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            BASE r = FUNCTION(gsl_matrix,get) (m,i,j);
+            BASE z = (BASE)(2 * ((i + j) % 10) + 3 * ((i + 2 * j) % 7));
+            if (r != z)
+              status = 1;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_axpby");
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            FUNCTION (gsl_matrix, set) (m, i, j, (BASE)((i + 2 * j) % 7));
+          }
+      }
+
+    FUNCTION(gsl_matrix, axpbyc) (2.0, &sx.matrix, 3.0, 5.0, &sm.matrix);
+
+    status = 0;
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            BASE r = FUNCTION(gsl_matrix,get) (m,i,j);
+            BASE z = (BASE)((i + 2 * j) % 7);
+            if (i >= 2 && j >= 1 && j < N - 2)
+              z = (BASE)(2 * ((i + j) % 10) + 3 * z + 5);
+            if (r != z)
+              status = 1;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_axpbyc noncontiguous");
+
+    {
+      BASE k = (BASE) 3;
+
+      FUNCTION(gsl_matrix, map) (x, FUNCTION (test, map_func), &k);
+      FUNCTION(gsl_matrix, map) (&sx.matrix, FUNCTION (test, map_func), &k);
+    }
+
+    status = 0;
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            BASE r = FUNCTION(gsl_matrix,get) (x,i,j);
+            BASE z = (BASE)((i + j) % 10 + 3);
+            if (i >= 1 && i < M - 1 && j >= 2 && j < N - 1)
+              z += (BASE) 3;
+            if (r != z)
+              status = 1;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_map");
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            FUNCTION (gsl_matrix, set) (x, i, j, (BASE)((i + j) % 10));
+          }
+      }
+
+    status = 0;
+
+    FUNCTION (gsl_matrix, set_zero) (m);
+    FUNCTION (gsl_matrix, add) (&sm.matrix, &sx.matrix);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            BASE r = FUNCTION(gsl_matrix,get) (m,i,j);
+            BASE z = (i >= 2 && j >= 1 && j < N - 2)
+              ? FUNCTION(gsl_matrix,get) (x, i - 1, j + 1) : (BASE) 0;
+            if (r != z)
+              status = 1;
+          }
+      }
+    gsl_test (status, NAME (gsl_matrix) "_add noncontiguous");
+
+    FUNCTION (gsl_matrix, free) (x);
+  }
+
   FUNCTION(gsl_matrix, swap) (a, b);
 
   {
@@ -764,6 +977,40 @@ FUNCTION (test, binary_noncontiguous) (const size_t M, const size_t N)
     FUNCTION (gsl_matrix, free) (ll);
   }
 
+  {
+    FILE *f = fopen ("test.dat", "wb");
+    FUNCTION (gsl_matrix, fsave) (f, &m.matrix);
+    fclose (f);
+  }
+
+  {
+    FILE *f = fopen ("test.dat", "rb");
+    TYPE (gsl_matrix) * mm = FUNCTION (gsl_matrix, fload) (f);
+    const TYPE (gsl_matrix) * mp = FUNCTION (gsl_matrix, mmap) ("test.dat");
+
+    status = (mm == 0 || mm->size1 != M || mm->size2 != N
+              || mp == 0 || mp->size1 != M || mp->size2 != N);
+
+    k = 0;
+    for (i = 0; i < M && !status; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            k++;
+            if (FUNCTION (gsl_matrix, get) (mm, i, j) != (BASE) k)
+              status = 1;
+            if (FUNCTION (gsl_matrix, get) (mp, i, j) != (BASE) k)
+              status = 1;
+          }
+      }
+
+    gsl_test (status, NAME (gsl_matrix) "_save, load and mmap (noncontiguous)");
+
+    fclose (f);
+    FUNCTION (gsl_matrix, free) (mm);
+    FUNCTION (gsl_matrix, munmap) (mp);
+  }
+
   FUNCTION (gsl_matrix, free) (l);
 }
 
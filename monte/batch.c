@@ -0,0 +1,65 @@
+/* monte/batch.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Helpers shared by the integrators for evaluating blocks of sample
+   points.  The points are generated in order into a buffer of at
+   most batch_size(dim) points, stored row-wise as x[k*dim + i], and
+   the integrand is then called once for the whole block (or once per
+   point for an ordinary gsl_monte_function).  The results are
+   accumulated in the order the points were generated, so the
+   estimates do not depend on the type of integrand used. */
+
+#define BATCH_MAX_POINTS 512
+#define BATCH_MAX_DOUBLES 16384
+
+static size_t
+batch_size (size_t dim)
+{
+  size_t n = BATCH_MAX_DOUBLES / (dim > 0 ? dim : 1);
+
+  if (n > BATCH_MAX_POINTS)
+    {
+      n = BATCH_MAX_POINTS;
+    }
+  else if (n == 0)
+    {
+      n = 1;
+    }
+
+  return n;
+}
+
+static void
+batch_eval (const gsl_monte_function * f, const gsl_monte_function_vec * fv,
+            double x[], size_t n, size_t dim, double fx[])
+{
+  if (fv != 0)
+    {
+      GSL_MONTE_FN_VEC_EVAL (fv, x, n, fx);
+    }
+  else
+    {
+      size_t k;
+
+      for (k = 0; k < n; k++)
+        {
+          fx[k] = GSL_MONTE_FN_EVAL (f, x + k * dim);
+        }
+    }
+}
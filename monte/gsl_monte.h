@@ -49,6 +49,21 @@ typedef struct gsl_monte_function_struct gsl_monte_function;
 
 #define GSL_MONTE_FN_EVAL(F,x) (*((F)->f))(x,(F)->dim,(F)->params)
 
+/* Batched integrand: evaluate the n points stored row-wise in x_array
+   (point k is x_array[k*dim] ... x_array[k*dim + dim - 1]) and write
+   the function values to f_array[0] ... f_array[n-1] */
+
+struct gsl_monte_function_vec_struct {
+  void (*f)(const double * x_array, size_t n, size_t dim, void * params,
+            double * f_array);
+  size_t dim;
+  void * params;
+};
+
+typedef struct gsl_monte_function_vec_struct gsl_monte_function_vec;
+
+#define GSL_MONTE_FN_VEC_EVAL(F,x,n,y) (*((F)->f))(x,n,(F)->dim,(F)->params,y)
+
 
 __END_DECLS
 
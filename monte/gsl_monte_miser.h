@@ -50,6 +50,8 @@ typedef struct {
   int depth;
   int verbose;
   double * x;
+  double * fx;
+  size_t batch;
   double * xmid;
   double * sigma_l;
   double * sigma_r;
@@ -72,6 +74,13 @@ int gsl_monte_miser_integrate(gsl_monte_function * f,
                               gsl_monte_miser_state* state,
                               double *result, double *abserr);
 
+int gsl_monte_miser_integrate_vec(gsl_monte_function_vec * f, 
+                                  const double xl[], const double xh[], 
+                                  size_t dim, size_t calls, 
+                                  gsl_rng *r, 
+                                  gsl_monte_miser_state* state,
+                                  double *result, double *abserr);
+
 gsl_monte_miser_state* gsl_monte_miser_alloc(size_t dim);
 
 int gsl_monte_miser_init(gsl_monte_miser_state* state);
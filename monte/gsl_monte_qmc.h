@@ -0,0 +1,97 @@
+/* monte/gsl_monte_qmc.h
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Randomized quasi-Monte Carlo integration. */
+
+#ifndef __GSL_MONTE_QMC_H__
+#define __GSL_MONTE_QMC_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_qrng.h>
+#include <gsl/gsl_monte.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+enum {GSL_MONTE_QMC_LATTICE = 0,
+      GSL_MONTE_QMC_SEQUENCE = 1};
+
+typedef struct {
+  size_t dim;
+  int mode;
+  size_t shifts;               /* number of random shifts */
+  const gsl_qrng_type * qrng_type;
+  gsl_qrng * q;                /* low discrepancy sequence */
+  size_t lattice_n;            /* number of lattice points for z */
+  unsigned long * z;           /* lattice generating vector */
+  unsigned long * idx;         /* current lattice point, k z mod n */
+  double * shift;
+  double * u;
+  size_t batch;
+  double * x;
+  double * fx;
+} gsl_monte_qmc_state;
+
+int gsl_monte_qmc_integrate (gsl_monte_function * f,
+                             const double xl[], const double xu[],
+                             size_t dim, size_t calls,
+                             gsl_rng * r,
+                             gsl_monte_qmc_state * state,
+                             double *result, double *abserr);
+
+int gsl_monte_qmc_integrate_vec (gsl_monte_function_vec * f,
+                                 const double xl[], const double xu[],
+                                 size_t dim, size_t calls,
+                                 gsl_rng * r,
+                                 gsl_monte_qmc_state * state,
+                                 double *result, double *abserr);
+
+gsl_monte_qmc_state * gsl_monte_qmc_alloc (size_t dim);
+
+int gsl_monte_qmc_init (gsl_monte_qmc_state * state);
+
+void gsl_monte_qmc_free (gsl_monte_qmc_state * state);
+
+int gsl_monte_qmc_korobov (size_t n, size_t dim, unsigned long z[]);
+
+typedef struct {
+  int mode;
+  size_t shifts;
+  const gsl_qrng_type * qrng_type;
+} gsl_monte_qmc_params;
+
+void gsl_monte_qmc_params_get (const gsl_monte_qmc_state * state,
+                               gsl_monte_qmc_params * params);
+
+void gsl_monte_qmc_params_set (gsl_monte_qmc_state * state,
+                               const gsl_monte_qmc_params * params);
+
+__END_DECLS
+
+#endif /* __GSL_MONTE_QMC_H__ */
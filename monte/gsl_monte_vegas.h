@@ -58,6 +58,11 @@ typedef struct {
   double * x;
   int * bin;
   int * box;
+
+  /* block of sample points evaluated together */
+  size_t batch;
+  double * fx;
+  double * bin_vol;
   
   /* distribution */
   double * d;
@@ -95,6 +100,13 @@ int gsl_monte_vegas_integrate(gsl_monte_function * f,
                               gsl_monte_vegas_state *state,
                               double* result, double* abserr);
 
+int gsl_monte_vegas_integrate_vec(gsl_monte_function_vec * f, 
+                                  double xl[], double xu[], 
+                                  size_t dim, size_t calls,
+                                  gsl_rng * r,
+                                  gsl_monte_vegas_state *state,
+                                  double* result, double* abserr);
+
 gsl_monte_vegas_state* gsl_monte_vegas_alloc(size_t dim);
 
 int gsl_monte_vegas_init(gsl_monte_vegas_state* state);
@@ -39,8 +39,20 @@
 #include <gsl/gsl_monte.h>
 #include <gsl/gsl_monte_miser.h>
 
+#include "batch.c"
+
+static int
+miser_integrate (gsl_monte_function * f,
+                 gsl_monte_function_vec * fv,
+                 const double xl[], const double xu[],
+                 size_t dim, size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_miser_state * state,
+                 double *result, double *abserr);
+
 static int
 estimate_corrmc (gsl_monte_function * f,
+                 gsl_monte_function_vec * fv,
                  const double xl[], const double xu[],
                  size_t dim, size_t calls,
                  gsl_rng * r,
@@ -57,7 +69,32 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
                            gsl_monte_miser_state * state,
                            double *result, double *abserr)
 {
-  size_t n, estimate_calls, calls_l, calls_r;
+  return miser_integrate (f, 0, xl, xu, dim, calls, r, state,
+                          result, abserr);
+}
+
+int
+gsl_monte_miser_integrate_vec (gsl_monte_function_vec * f,
+                               const double xl[], const double xu[],
+                               size_t dim, size_t calls,
+                               gsl_rng * r,
+                               gsl_monte_miser_state * state,
+                               double *result, double *abserr)
+{
+  return miser_integrate (0, f, xl, xu, dim, calls, r, state,
+                          result, abserr);
+}
+
+static int
+miser_integrate (gsl_monte_function * f,
+                 gsl_monte_function_vec * fv,
+                 const double xl[], const double xu[],
+                 size_t dim, size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_miser_state * state,
+                 double *result, double *abserr)
+{
+  size_t n, k, estimate_calls, calls_l, calls_r;
   const size_t min_calls = state->min_calls;
   size_t i;
   size_t i_bisect;
@@ -71,6 +108,7 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
   double weight_l, weight_r;
 
   double *x = state->x;
+  double *fx = state->fx;
   double *xmid = state->xmid;
   double *sigma_l = state->sigma_l, *sigma_r = state->sigma_r;
 
@@ -116,24 +154,35 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
           GSL_ERROR ("insufficient calls for subvolume", GSL_EFAILED);
         }
 
-      for (n = 0; n < calls; n++)
+      n = 0;
+
+      while (n < calls)
         {
-          /* Choose a random point in the integration region */
+          const size_t nb = GSL_MIN (state->batch, calls - n);
 
-          for (i = 0; i < dim; i++)
+          /* Choose a block of random points in the integration region */
+
+          for (k = 0; k < nb; k++)
             {
-              x[i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+              for (i = 0; i < dim; i++)
+                {
+                  x[k * dim + i] = 
+                    xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+                }
             }
 
-          {
-            double fval = GSL_MONTE_FN_EVAL (f, x);
+          batch_eval (f, fv, x, nb, dim, fx);
 
-            /* recurrence for mean and variance */
+          for (k = 0; k < nb; k++)
+            {
+              /* recurrence for mean and variance */
 
-            double d = fval - m;
-            m += d / (n + 1.0);
-            q += d * d * (n / (n + 1.0));
-          }
+              double d = fx[k] - m;
+              m += d / (n + k + 1.0);
+              q += d * d * ((n + k) / (n + k + 1.0));
+            }
+
+          n += nb;
         }
 
       *result = vol * m;
@@ -164,7 +213,7 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
      the variances by finding the min and max function values 
      for each half-region for each bisection. */
 
-  estimate_corrmc (f, xl, xu, dim, estimate_calls,
+  estimate_corrmc (f, fv, xl, xu, dim, estimate_calls,
                    r, state, &res_est, &err_est, xmid, sigma_l, sigma_r);
 
   /* We have now used up some calls for the estimation */
@@ -263,9 +312,9 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
 
     xu_tmp[i_bisect] = xbi_m;
 
-    status = gsl_monte_miser_integrate (f, xl, xu_tmp,
-                                        dim, calls_l, r, state,
-                                        &res_l, &err_l);
+    status = miser_integrate (f, fv, xl, xu_tmp,
+                              dim, calls_l, r, state,
+                              &res_l, &err_l);
     free (xu_tmp);
 
     if (status != GSL_SUCCESS)
@@ -293,9 +342,9 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
 
     xl_tmp[i_bisect] = xbi_m;
 
-    status = gsl_monte_miser_integrate (f, xl_tmp, xu,
-                                        dim, calls_r, r, state,
-                                        &res_r, &err_r);
+    status = miser_integrate (f, fv, xl_tmp, xu,
+                              dim, calls_r, r, state,
+                              &res_r, &err_r);
     free (xl_tmp);
 
     if (status != GSL_SUCCESS)
@@ -322,7 +371,9 @@ gsl_monte_miser_alloc (size_t dim)
                      GSL_ENOMEM, 0);
     }
 
-  s->x = (double *) malloc (dim * sizeof (double));
+  s->batch = batch_size (dim);
+
+  s->x = (double *) malloc (s->batch * dim * sizeof (double));
 
   if (s->x == 0)
     {
@@ -330,10 +381,20 @@ gsl_monte_miser_alloc (size_t dim)
       GSL_ERROR_VAL ("failed to allocate space for x", GSL_ENOMEM, 0);
     }
 
+  s->fx = (double *) malloc (s->batch * sizeof (double));
+
+  if (s->fx == 0)
+    {
+      free (s->x);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for fx", GSL_ENOMEM, 0);
+    }
+
   s->xmid = (double *) malloc (dim * sizeof (double));
 
   if (s->xmid == 0)
     {
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for xmid", GSL_ENOMEM, 0);
@@ -344,6 +405,7 @@ gsl_monte_miser_alloc (size_t dim)
   if (s->sigma_l == 0)
     {
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for sigma_l", GSL_ENOMEM, 0);
@@ -355,6 +417,7 @@ gsl_monte_miser_alloc (size_t dim)
     {
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for sigma_r", GSL_ENOMEM, 0);
@@ -367,6 +430,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fmax_l", GSL_ENOMEM, 0);
@@ -380,6 +444,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fmax_r", GSL_ENOMEM, 0);
@@ -394,6 +459,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fmin_l", GSL_ENOMEM, 0);
@@ -409,6 +475,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fmin_r", GSL_ENOMEM, 0);
@@ -425,6 +492,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fsum_l", GSL_ENOMEM, 0);
@@ -442,6 +510,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fsum_r", GSL_ENOMEM, 0);
@@ -460,6 +529,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fsum2_l", GSL_ENOMEM, 0);
@@ -479,6 +549,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fsum2_r", GSL_ENOMEM, 0);
@@ -500,6 +571,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fsum2_r", GSL_ENOMEM, 0);
@@ -521,6 +593,7 @@ gsl_monte_miser_alloc (size_t dim)
       free (s->sigma_r);
       free (s->sigma_l);
       free (s->xmid);
+      free (s->fx);
       free (s->x);
       free (s);
       GSL_ERROR_VAL ("failed to allocate space for fsum2_r", GSL_ENOMEM, 0);
@@ -564,6 +637,7 @@ gsl_monte_miser_free (gsl_monte_miser_state * s)
   free (s->sigma_r);
   free (s->sigma_l);
   free (s->xmid);
+  free (s->fx);
   free (s->x);
   free (s);
 }
@@ -590,6 +664,7 @@ gsl_monte_miser_params_set (gsl_monte_miser_state * s, const gsl_monte_miser_par
 
 static int
 estimate_corrmc (gsl_monte_function * f,
+                 gsl_monte_function_vec * fv,
                  const double xl[], const double xu[],
                  size_t dim, size_t calls,
                  gsl_rng * r,
@@ -597,9 +672,10 @@ estimate_corrmc (gsl_monte_function * f,
                  double *result, double *abserr,
                  const double xmid[], double sigma_l[], double sigma_r[])
 {
-  size_t i, n;
+  size_t i, n, k;
   
   double *x = state->x;
+  double *fx = state->fx;
   double *fsum_l = state->fsum_l;
   double *fsum_r = state->fsum_r;
   double *fsum2_l = state->fsum2_l;
@@ -619,59 +695,73 @@ estimate_corrmc (gsl_monte_function * f,
       sigma_l[i] = sigma_r[i] = -1;
     }
 
-  for (n = 0; n < calls; n++)
+  n = 0;
+
+  while (n < calls)
     {
-      double fval;
-      
-      unsigned int j = (n/2) % dim;
-      unsigned int side = (n % 2);
+      const size_t nb = GSL_MIN (state->batch, calls - n);
 
-      for (i = 0; i < dim; i++)
+      for (k = 0; k < nb; k++)
         {
-          double z = gsl_rng_uniform_pos (r) ;
+          double *xk = x + k * dim;
+          unsigned int j = ((n + k) / 2) % dim;
+          unsigned int side = ((n + k) % 2);
 
-          if (i != j) 
-            {
-              x[i] = xl[i] + z * (xu[i] - xl[i]);
-            }
-          else
+          for (i = 0; i < dim; i++)
             {
-              if (side == 0) 
+              double z = gsl_rng_uniform_pos (r) ;
+
+              if (i != j) 
                 {
-                  x[i] = xmid[i] + z * (xu[i] - xmid[i]);
+                  xk[i] = xl[i] + z * (xu[i] - xl[i]);
                 }
               else
                 {
-                  x[i] = xl[i] + z * (xmid[i] - xl[i]);
+                  if (side == 0) 
+                    {
+                      xk[i] = xmid[i] + z * (xu[i] - xmid[i]);
+                    }
+                  else
+                    {
+                      xk[i] = xl[i] + z * (xmid[i] - xl[i]);
+                    }
                 }
             }
         }
 
-      fval = GSL_MONTE_FN_EVAL (f, x);
-
-      /* recurrence for mean and variance */
-      {
-        double d = fval - m;
-        m += d / (n + 1.0);
-        q += d * d * (n / (n + 1.0));
-      }
+      batch_eval (f, fv, x, nb, dim, fx);
 
-      /* compute the variances on each side of the bisection */
-      for (i = 0; i < dim; i++)
+      for (k = 0; k < nb; k++)
         {
-          if (x[i] <= xmid[i])
-            {
-              fsum_l[i] += fval;
-              fsum2_l[i] += fval * fval;
-              hits_l[i]++;
-            }
-          else
+          const double *xk = x + k * dim;
+          double fval = fx[k];
+
+          /* recurrence for mean and variance */
+          {
+            double d = fval - m;
+            m += d / (n + k + 1.0);
+            q += d * d * ((n + k) / (n + k + 1.0));
+          }
+
+          /* compute the variances on each side of the bisection */
+          for (i = 0; i < dim; i++)
             {
-              fsum_r[i] += fval;
-              fsum2_r[i] += fval * fval;
-              hits_r[i]++;
+              if (xk[i] <= xmid[i])
+                {
+                  fsum_l[i] += fval;
+                  fsum2_l[i] += fval * fval;
+                  hits_l[i]++;
+                }
+              else
+                {
+                  fsum_r[i] += fval;
+                  fsum2_r[i] += fval * fval;
+                  hits_r[i]++;
+                }
             }
         }
+
+      n += nb;
     }
 
   for (i = 0; i < dim; i++)
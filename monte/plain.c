@@ -27,6 +27,18 @@
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_monte_plain.h>
 
+#include "batch.c"
+
+static int
+plain_integrate (const gsl_monte_function * f,
+                 const gsl_monte_function_vec * fv,
+                 const double xl[], const double xu[],
+                 const size_t dim,
+                 const size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_plain_state * state,
+                 double *result, double *abserr);
+
 int
 gsl_monte_plain_integrate (const gsl_monte_function * f,
                            const double xl[], const double xu[],
@@ -35,10 +47,38 @@ gsl_monte_plain_integrate (const gsl_monte_function * f,
                            gsl_rng * r,
                            gsl_monte_plain_state * state,
                            double *result, double *abserr)
+{
+  return plain_integrate (f, 0, xl, xu, dim, calls, r, state,
+                          result, abserr);
+}
+
+int
+gsl_monte_plain_integrate_vec (const gsl_monte_function_vec * f,
+                               const double xl[], const double xu[],
+                               const size_t dim,
+                               const size_t calls,
+                               gsl_rng * r,
+                               gsl_monte_plain_state * state,
+                               double *result, double *abserr)
+{
+  return plain_integrate (0, f, xl, xu, dim, calls, r, state,
+                          result, abserr);
+}
+
+static int
+plain_integrate (const gsl_monte_function * f,
+                 const gsl_monte_function_vec * fv,
+                 const double xl[], const double xu[],
+                 const size_t dim,
+                 const size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_plain_state * state,
+                 double *result, double *abserr)
 {
   double vol, m = 0, q = 0;
   double *x = state->x;
-  size_t n, i;
+  double *fx = state->fx;
+  size_t n, i, k;
 
   if (dim != state->dim)
     {
@@ -68,24 +108,34 @@ gsl_monte_plain_integrate (const gsl_monte_function * f,
       vol *= xu[i] - xl[i];
     }
 
-  for (n = 0; n < calls; n++)
+  n = 0;
+
+  while (n < calls)
     {
-      /* Choose a random point in the integration region */
+      const size_t nb = GSL_MIN (state->batch, calls - n);
+
+      /* Choose a block of random points in the integration region */
 
-      for (i = 0; i < dim; i++)
+      for (k = 0; k < nb; k++)
         {
-          x[i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+          for (i = 0; i < dim; i++)
+            {
+              x[k * dim + i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+            }
         }
 
-      {
-        double fval = GSL_MONTE_FN_EVAL (f, x);
+      batch_eval (f, fv, x, nb, dim, fx);
 
-        /* recurrence for mean and variance */
+      for (k = 0; k < nb; k++)
+        {
+          /* recurrence for mean and variance */
+
+          double d = fx[k] - m;
+          m += d / (n + k + 1.0);
+          q += d * d * ((n + k) / (n + k + 1.0));
+        }
 
-        double d = fval - m;
-        m += d / (n + 1.0);
-        q += d * d * (n / (n + 1.0));
-      }
+      n += nb;
     }
 
   *result = vol * m;
@@ -114,7 +164,9 @@ gsl_monte_plain_alloc (size_t dim)
                      GSL_ENOMEM, 0);
     }
 
-  s->x = (double *) malloc (dim * sizeof (double));
+  s->batch = batch_size (dim);
+
+  s->x = (double *) malloc (s->batch * dim * sizeof (double));
 
   if (s->x == 0)
     {
@@ -123,6 +175,16 @@ gsl_monte_plain_alloc (size_t dim)
                      GSL_ENOMEM, 0);
     }
 
+  s->fx = (double *) malloc (s->batch * sizeof (double));
+
+  if (s->fx == 0)
+    {
+      free (s->x);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for function values",
+                     GSL_ENOMEM, 0);
+    }
+
   s->dim = dim;
 
   return s;
@@ -147,6 +209,7 @@ void
 gsl_monte_plain_free (gsl_monte_plain_state * s)
 {
   RETURN_IF_NULL (s);
+  free (s->fx);
   free (s->x);
   free (s);
 }
@@ -0,0 +1,643 @@
+/* monte/qmc.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Randomized quasi-Monte Carlo integration.
+
+   The calls are divided between a number of independent replications.
+   Each replication integrates over the same point set P -- either a
+   rank-1 lattice {k z / n} or the first n points of a low discrepancy
+   sequence from gsl_qrng -- shifted by a uniform random vector modulo 1
+   (Cranley-Patterson rotation), or for the base 2 sequences sobol,
+   sobol_jk and niederreiter_2 by a random digital shift (bitwise xor
+   of the coordinates).  Points which land exactly on the boundary of
+   the unit cube are moved half a 2^-32 step inside it, so that as for
+   the plain Monte Carlo routines the integrand is only evaluated in
+   the interior.  Each randomized rule is an unbiased
+   estimate of the integral, so the spread of the replication means
+   gives a statistical error estimate, while for smooth integrands the
+   error of each rule decreases at close to O(1/n).
+
+   The lattice generating vector is of Korobov form z = (1, a, a^2,
+   ...) mod n, where a is chosen to minimize the weighted worst case
+   error criterion P_2 (Sloan & Joe, "Lattice Methods for Multiple
+   Integration", 1994),
+
+     P_2 = -1 + (1/n) \sum_k \prod_j (1 + 2 \pi^2 g_j B_2({k z_j / n}))
+
+   with the Bernoulli polynomial B_2(x) = x^2 - x + 1/6 and product
+   weights g_j = 1/j^2, j = 1..dim.  Without weights the criterion is
+   dominated by the interactions of many coordinates once dim is
+   larger than about 6, and can pick rules which are poor in the low
+   order projections that matter for most integrands.  Lattice rules
+   are most effective for periodic integrands, so the shifted lattice
+   points are mapped through the tent transform y -> 1 - |2y - 1|,
+   which periodizes the integrand without changing the distribution
+   of the points (Hickernell, "Obtaining O(N^-2+e) convergence for
+   lattice quadrature rules", 2002). */
+
+#include <config.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_qrng.h>
+#include <gsl/gsl_monte.h>
+#include <gsl/gsl_monte_qmc.h>
+
+#include "batch.c"
+
+/* number of multipliers a tried in the Korobov search */
+#define KOROBOV_CANDIDATES 64
+
+#define TWO32 4294967296.0
+
+static int qmc_integrate (gsl_monte_function * f,
+                          gsl_monte_function_vec * fv,
+                          const double xl[], const double xu[],
+                          size_t dim, size_t calls,
+                          gsl_rng * r,
+                          gsl_monte_qmc_state * state,
+                          double *result, double *abserr);
+
+static unsigned long mulmod (unsigned long a, unsigned long b,
+                             unsigned long n);
+static unsigned long gcd (unsigned long a, unsigned long b);
+static void korobov_vector (unsigned long a, size_t n, size_t dim,
+                            unsigned long z[]);
+static double korobov_p2 (size_t n, size_t dim, const unsigned long z[],
+                          unsigned long idx[]);
+
+int
+gsl_monte_qmc_integrate (gsl_monte_function * f,
+                         const double xl[], const double xu[],
+                         size_t dim, size_t calls,
+                         gsl_rng * r,
+                         gsl_monte_qmc_state * state,
+                         double *result, double *abserr)
+{
+  return qmc_integrate (f, 0, xl, xu, dim, calls, r, state,
+                        result, abserr);
+}
+
+int
+gsl_monte_qmc_integrate_vec (gsl_monte_function_vec * f,
+                             const double xl[], const double xu[],
+                             size_t dim, size_t calls,
+                             gsl_rng * r,
+                             gsl_monte_qmc_state * state,
+                             double *result, double *abserr)
+{
+  return qmc_integrate (0, f, xl, xu, dim, calls, r, state,
+                        result, abserr);
+}
+
+static int
+qmc_integrate (gsl_monte_function * f,
+               gsl_monte_function_vec * fv,
+               const double xl[], const double xu[],
+               size_t dim, size_t calls,
+               gsl_rng * r,
+               gsl_monte_qmc_state * state,
+               double *result, double *abserr)
+{
+  const size_t shifts = state->shifts;
+  double *x = state->x;
+  double *fx = state->fx;
+  double *u = state->u;
+  double *shift = state->shift;
+  double vol, m = 0, q = 0;
+  size_t n, i, k, s;
+  int digital = 0;
+
+  if (dim != state->dim)
+    {
+      GSL_ERROR ("number of dimensions must match allocated size", GSL_EINVAL);
+    }
+
+  for (i = 0; i < dim; i++)
+    {
+      if (xu[i] <= xl[i])
+        {
+          GSL_ERROR ("xu must be greater than xl", GSL_EINVAL);
+        }
+
+      if (xu[i] - xl[i] > GSL_DBL_MAX)
+        {
+          GSL_ERROR ("Range of integration is too large, please rescale",
+                     GSL_EINVAL);
+        }
+    }
+
+  if (shifts == 0)
+    {
+      GSL_ERROR ("number of shifts must be positive", GSL_EINVAL);
+    }
+
+  /* points per replication */
+
+  n = calls / shifts;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("insufficient calls for the number of shifts", GSL_EINVAL);
+    }
+
+  if (state->mode == GSL_MONTE_QMC_LATTICE)
+    {
+      if (n != state->lattice_n)
+        {
+          int status = gsl_monte_qmc_korobov (n, dim, state->z);
+
+          if (status)
+            {
+              return status;
+            }
+
+          state->lattice_n = n;
+        }
+    }
+  else if (state->mode == GSL_MONTE_QMC_SEQUENCE)
+    {
+      if (state->q == 0 || state->q->type != state->qrng_type)
+        {
+          if (dim > state->qrng_type->max_dimension)
+            {
+              GSL_ERROR ("dimension exceeds maximum for sequence", GSL_EINVAL);
+            }
+
+          gsl_qrng_free (state->q);
+
+          state->q = gsl_qrng_alloc (state->qrng_type, dim);
+
+          if (state->q == 0)
+            {
+              GSL_ERROR ("failed to allocate sequence generator", GSL_ENOMEM);
+            }
+        }
+
+      /* the base 2 sequences are randomized by a digital shift,
+         which preserves their net structure */
+
+      digital = (state->qrng_type == gsl_qrng_sobol
+                 || state->qrng_type == gsl_qrng_sobol_jk
+                 || state->qrng_type == gsl_qrng_niederreiter_2);
+    }
+  else
+    {
+      GSL_ERROR ("unknown point set", GSL_EINVAL);
+    }
+
+  /* Compute the volume of the region */
+
+  vol = 1;
+
+  for (i = 0; i < dim; i++)
+    {
+      vol *= xu[i] - xl[i];
+    }
+
+  for (s = 0; s < shifts; s++)
+    {
+      double ms = 0;
+      size_t j = 0;
+
+      for (i = 0; i < dim; i++)
+        {
+          shift[i] = gsl_rng_uniform (r);
+        }
+
+      if (state->mode == GSL_MONTE_QMC_LATTICE)
+        {
+          for (i = 0; i < dim; i++)
+            {
+              state->idx[i] = 0;
+            }
+        }
+      else
+        {
+          gsl_qrng_init (state->q);
+        }
+
+      while (j < n)
+        {
+          const size_t nb = GSL_MIN (state->batch, n - j);
+
+          for (k = 0; k < nb; k++)
+            {
+              double *xk = x + k * dim;
+
+              if (state->mode == GSL_MONTE_QMC_LATTICE)
+                {
+                  for (i = 0; i < dim; i++)
+                    {
+                      unsigned long t = state->idx[i];
+
+                      u[i] = (double) t / (double) n;
+
+                      /* advance to (k+1) z mod n */
+                      t += state->z[i];
+                      state->idx[i] = (t >= n) ? t - n : t;
+                    }
+                }
+              else
+                {
+                  gsl_qrng_get (state->q, u);
+                }
+
+              for (i = 0; i < dim; i++)
+                {
+                  double y;
+
+                  if (digital)
+                    {
+                      unsigned long ui = (unsigned long) (u[i] * TWO32);
+                      unsigned long si = (unsigned long) (shift[i] * TWO32);
+                      y = (double) ((ui ^ si) & 0xffffffffUL) / TWO32;
+                    }
+                  else
+                    {
+                      y = u[i] + shift[i];
+
+                      if (y >= 1.0)
+                        {
+                          y -= 1.0;
+                        }
+
+                      if (state->mode == GSL_MONTE_QMC_LATTICE)
+                        {
+                          /* tent transform */
+                          y = 1.0 - fabs (2.0 * y - 1.0);
+                        }
+                    }
+
+                  if (y <= 0.0)
+                    {
+                      y = 0.5 / TWO32;
+                    }
+                  else if (y >= 1.0)
+                    {
+                      y = 1.0 - 0.5 / TWO32;
+                    }
+
+                  xk[i] = xl[i] + y * (xu[i] - xl[i]);
+                }
+            }
+
+          batch_eval (f, fv, x, nb, dim, fx);
+
+          for (k = 0; k < nb; k++)
+            {
+              ms += (fx[k] - ms) / (j + k + 1.0);
+            }
+
+          j += nb;
+        }
+
+      /* recurrence for mean and variance of the replications */
+
+      {
+        double d = vol * ms - m;
+        m += d / (s + 1.0);
+        q += d * d * (s / (s + 1.0));
+      }
+    }
+
+  *result = m;
+
+  if (shifts < 2)
+    {
+      *abserr = GSL_POSINF;
+    }
+  else
+    {
+      *abserr = sqrt (q / (shifts * (shifts - 1.0)));
+    }
+
+  return GSL_SUCCESS;
+}
+
+gsl_monte_qmc_state *
+gsl_monte_qmc_alloc (size_t dim)
+{
+  gsl_monte_qmc_state *s;
+
+  if (dim == 0)
+    {
+      GSL_ERROR_VAL ("dimension must be positive", GSL_EINVAL, 0);
+    }
+
+  s = (gsl_monte_qmc_state *) malloc (sizeof (gsl_monte_qmc_state));
+
+  if (s == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for qmc state struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  s->z = (unsigned long *) malloc (dim * sizeof (unsigned long));
+
+  if (s->z == 0)
+    {
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for z", GSL_ENOMEM, 0);
+    }
+
+  s->idx = (unsigned long *) malloc (dim * sizeof (unsigned long));
+
+  if (s->idx == 0)
+    {
+      free (s->z);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for idx", GSL_ENOMEM, 0);
+    }
+
+  s->shift = (double *) malloc (dim * sizeof (double));
+
+  if (s->shift == 0)
+    {
+      free (s->idx);
+      free (s->z);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for shift", GSL_ENOMEM, 0);
+    }
+
+  s->u = (double *) malloc (dim * sizeof (double));
+
+  if (s->u == 0)
+    {
+      free (s->shift);
+      free (s->idx);
+      free (s->z);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for u", GSL_ENOMEM, 0);
+    }
+
+  s->batch = batch_size (dim);
+
+  s->x = (double *) malloc (s->batch * dim * sizeof (double));
+
+  if (s->x == 0)
+    {
+      free (s->u);
+      free (s->shift);
+      free (s->idx);
+      free (s->z);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for x", GSL_ENOMEM, 0);
+    }
+
+  s->fx = (double *) malloc (s->batch * sizeof (double));
+
+  if (s->fx == 0)
+    {
+      free (s->x);
+      free (s->u);
+      free (s->shift);
+      free (s->idx);
+      free (s->z);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for fx", GSL_ENOMEM, 0);
+    }
+
+  s->dim = dim;
+  s->q = 0;
+
+  gsl_monte_qmc_init (s);
+
+  return s;
+}
+
+/* Set some default values and whatever */
+
+int
+gsl_monte_qmc_init (gsl_monte_qmc_state * s)
+{
+  s->mode = GSL_MONTE_QMC_LATTICE;
+  s->shifts = 16;
+  s->qrng_type = gsl_qrng_sobol;
+  s->lattice_n = 0;
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_monte_qmc_free (gsl_monte_qmc_state * s)
+{
+  RETURN_IF_NULL (s);
+
+  if (s->q)
+    {
+      gsl_qrng_free (s->q);
+    }
+
+  free (s->fx);
+  free (s->x);
+  free (s->u);
+  free (s->shift);
+  free (s->idx);
+  free (s->z);
+  free (s);
+}
+
+void
+gsl_monte_qmc_params_get (const gsl_monte_qmc_state * s,
+                          gsl_monte_qmc_params * p)
+{
+  p->mode = s->mode;
+  p->shifts = s->shifts;
+  p->qrng_type = s->qrng_type;
+}
+
+void
+gsl_monte_qmc_params_set (gsl_monte_qmc_state * s,
+                          const gsl_monte_qmc_params * p)
+{
+  s->mode = p->mode;
+  s->shifts = p->shifts;
+  s->qrng_type = p->qrng_type;
+}
+
+/* Find a Korobov generating vector z = (1, a, a^2, ...) mod n for an
+   n-point rank-1 lattice rule in dim dimensions, choosing a among
+   up to KOROBOV_CANDIDATES values in [1, n/2] coprime to n to
+   minimize P_2 */
+
+int
+gsl_monte_qmc_korobov (size_t n, size_t dim, unsigned long z[])
+{
+  unsigned long *zc, *idx;
+  unsigned long a, a_best = 1, a_last = 1, step;
+  double p_best = GSL_POSINF;
+  size_t c;
+
+  if (n == 0 || dim == 0)
+    {
+      GSL_ERROR ("number of points and dimension must be positive",
+                 GSL_EINVAL);
+    }
+
+  if (n <= 3 || dim == 1)
+    {
+      korobov_vector (1, n, dim, z);
+      return GSL_SUCCESS;
+    }
+
+  zc = (unsigned long *) malloc (dim * sizeof (unsigned long));
+
+  if (zc == 0)
+    {
+      GSL_ERROR ("failed to allocate space for candidate", GSL_ENOMEM);
+    }
+
+  idx = (unsigned long *) malloc (dim * sizeof (unsigned long));
+
+  if (idx == 0)
+    {
+      free (zc);
+      GSL_ERROR ("failed to allocate space for idx", GSL_ENOMEM);
+    }
+
+  step = (n / 2) / KOROBOV_CANDIDATES;
+
+  if (step == 0)
+    {
+      step = 1;
+    }
+
+  for (c = 0; c < KOROBOV_CANDIDATES; c++)
+    {
+      double p;
+
+      a = GSL_MAX (2 + c * step, a_last + 1);
+
+      while (a <= n / 2 && gcd (a, n) != 1)
+        {
+          a++;
+        }
+
+      if (a > n / 2)
+        {
+          break;
+        }
+
+      korobov_vector (a, n, dim, zc);
+      p = korobov_p2 (n, dim, zc, idx);
+
+      if (p < p_best)
+        {
+          p_best = p;
+          a_best = a;
+        }
+
+      a_last = a;
+    }
+
+  korobov_vector (a_best, n, dim, z);
+
+  free (idx);
+  free (zc);
+
+  return GSL_SUCCESS;
+}
+
+static void
+korobov_vector (unsigned long a, size_t n, size_t dim, unsigned long z[])
+{
+  size_t j;
+
+  z[0] = 1 % n;
+
+  for (j = 1; j < dim; j++)
+    {
+      z[j] = mulmod (z[j - 1], a, n);
+    }
+}
+
+static double
+korobov_p2 (size_t n, size_t dim, const unsigned long z[],
+            unsigned long idx[])
+{
+  const double c = 2.0 * M_PI * M_PI;
+  double sum = 0;
+  size_t j, k;
+
+  for (j = 0; j < dim; j++)
+    {
+      idx[j] = 0;
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      double prod = 1.0;
+
+      for (j = 0; j < dim; j++)
+        {
+          unsigned long t = idx[j];
+          double x = (double) t / (double) n;
+          double gj = 1.0 / ((j + 1.0) * (j + 1.0));
+
+          prod *= 1.0 + gj * c * (x * x - x + 1.0 / 6.0);
+
+          t += z[j];
+          idx[j] = (t >= n) ? t - n : t;
+        }
+
+      sum += prod;
+    }
+
+  return sum / n - 1.0;
+}
+
+/* a*b mod n without overflow */
+
+static unsigned long
+mulmod (unsigned long a, unsigned long b, unsigned long n)
+{
+  unsigned long r = 0;
+
+  a %= n;
+
+  while (b > 0)
+    {
+      if (b & 1)
+        {
+          r = (r >= n - a) ? r - (n - a) : r + a;
+        }
+
+      a = (a >= n - a) ? a - (n - a) : a + a;
+      b >>= 1;
+    }
+
+  return r;
+}
+
+static unsigned long
+gcd (unsigned long a, unsigned long b)
+{
+  while (b != 0)
+    {
+      unsigned long t = a % b;
+      a = b;
+      b = t;
+    }
+
+  return a;
+}
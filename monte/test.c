@@ -33,6 +33,7 @@
 #include <gsl/gsl_monte_plain.h>
 #include <gsl/gsl_monte_miser.h>
 #include <gsl/gsl_monte_vegas.h>
+#include <gsl/gsl_monte_qmc.h>
 
 #define CONSTANT
 #define STEP
@@ -56,10 +57,18 @@ double f0 (double x[], size_t d, void *params);
 double f1 (double x[], size_t d, void *params);
 double f2 (double x[], size_t d, void *params);
 double f3 (double x[], size_t d, void *params);
+double flog (double x[], size_t d, void *params);
 
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
+void fvec (const double x[], size_t n, size_t d, void *params, double y[]);
+void test_vec (gsl_monte_function * F, size_t dim, size_t calls,
+               const char * desc);
+void test_qmc (gsl_monte_function * F, size_t dim, size_t calls,
+               int mode, const gsl_qrng_type * T, double expected_error,
+               const char * desc);
+
 struct problem {
   gsl_monte_function * f;
   double * xl;
@@ -124,6 +133,7 @@ main (void)
   gsl_monte_function F1 = make_function(&f1, 0, &a);
   gsl_monte_function F2 = make_function(&f2, 0, &a);
   gsl_monte_function F3 = make_function(&f3, 0, &c);
+  gsl_monte_function Flog = make_function(&flog, 0, 0);
 
   /* The relationship between the variance of the function itself, the
      error on the integral and the number of calls is,
@@ -381,6 +391,69 @@ main (void)
 #undef MONTE_SPEEDUP
 #endif
 
+
+  /* The batched integrands must reproduce the scalar results exactly */
+
+  F0.dim = 2;
+  test_vec (&F0, 2, 20000, "product, 2d");
+  F1.dim = 3;
+  test_vec (&F1, 3, 100000, "gaussian, 3d");
+  F3.dim = 10;
+  test_vec (&F3, 10, 50000, "tsuda function, 10d");
+
+  /* Randomized QMC should beat the plain Monte Carlo error at the
+     same number of calls (given in the comments above) by a large
+     factor for smooth integrands in low dimensions, and be no worse
+     in any dimension tested */
+
+  {
+    size_t d;
+
+    for (d = 1; d <= 10; d++)
+      {
+        const double factor = (d <= 3) ? 0.2 : 1.0;
+        const double sd0 = sqrt ((pow (4.0 / 3.0, d) - 1) / 65536);
+        const double sd3 = sqrt ((pow ((c*c + c + 1.0/3.0)/(c*(c+1)), d) - 1) 
+                                 / 65536);
+        char desc[64];
+
+        sprintf (desc, "product, %dd", (int) d);
+        F0.dim = d;
+        test_qmc (&F0, d, 65536, GSL_MONTE_QMC_LATTICE, 0, 
+                  factor * sd0, desc);
+        test_qmc (&F0, d, 65536, GSL_MONTE_QMC_SEQUENCE, gsl_qrng_sobol,
+                  factor * sd0, desc);
+
+        test_qmc (&F0, d, 65536, GSL_MONTE_QMC_SEQUENCE, gsl_qrng_sobol_jk,
+                  factor * sd0, desc);
+
+        sprintf (desc, "tsuda function, %dd", (int) d);
+        F3.dim = d;
+        test_qmc (&F3, d, 65536, GSL_MONTE_QMC_LATTICE, 0,
+                  factor * sd3, desc);
+        test_qmc (&F3, d, 65536, GSL_MONTE_QMC_SEQUENCE, gsl_qrng_halton,
+                  factor * sd3, desc);
+      }
+  }
+
+  /* an integrand singular on the boundary, which must only be
+     evaluated inside the region */
+
+  {
+    size_t d;
+
+    for (d = 1; d <= 3; d++)
+      {
+        const double sd = sqrt ((pow (2.0, d) - 1) / 65536);
+        char desc[64];
+
+        sprintf (desc, "log product, %dd", (int) d);
+        Flog.dim = d;
+        test_qmc (&Flog, d, 65536, GSL_MONTE_QMC_LATTICE, 0, sd, desc);
+        test_qmc (&Flog, d, 65536, GSL_MONTE_QMC_SEQUENCE, gsl_qrng_sobol_jk,
+                  sd, desc);
+      }
+  }
       
   exit (gsl_test_summary ());
 }
@@ -400,6 +473,22 @@ fstep (double x[], size_t num_dim, void *params)
   return (x[0] > 0.1 && x[0] < 0.9) ? 1 : 0;
 }
 
+/* Product of -log(x_i), with integral 1 and singular on the
+   boundary x_i = 0 */
+double
+flog (double x[], size_t num_dim, void *params)
+{
+  double prod = 1.0;
+  size_t i;
+
+  for (i = 0; i < num_dim; ++i)
+    {
+      prod *= -log (x[i]);
+    }
+
+  return prod;
+}
+
 /* Simple product function */
 double
 f0 (double x[], size_t num_dim, void *params)
@@ -472,6 +561,134 @@ f3 (double x[], size_t num_dim, void *params)
 }
 
 
+/* Batched wrapper around a scalar gsl_monte_function */
+void
+fvec (const double x[], size_t n, size_t d, void *params, double y[])
+{
+  gsl_monte_function * F = (gsl_monte_function *) params;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      y[k] = GSL_MONTE_FN_EVAL (F, (double *) (x + k * d));
+    }
+}
+
+void
+test_vec (gsl_monte_function * F, size_t dim, size_t calls, const char * desc)
+{
+  gsl_monte_function_vec G;
+  gsl_rng * r = gsl_rng_alloc (gsl_rng_default);
+  double res, err, res_vec, err_vec;
+
+  G.f = &fvec;
+  G.dim = dim;
+  G.params = F;
+
+  {
+    gsl_monte_plain_state * s = gsl_monte_plain_alloc (dim);
+    gsl_rng_set (r, 1);
+    gsl_monte_plain_integrate (F, xl, xu, dim, calls, r, s, &res, &err);
+    gsl_rng_set (r, 1);
+    gsl_monte_plain_integrate_vec (&G, xl, xu, dim, calls, r, s, 
+                                   &res_vec, &err_vec);
+    gsl_test_rel (res_vec, res, 0.0, "plain_vec, %s, result", desc);
+    gsl_test_rel (err_vec, err, 0.0, "plain_vec, %s, abserr", desc);
+    gsl_monte_plain_free (s);
+  }
+
+  {
+    gsl_monte_miser_state * s = gsl_monte_miser_alloc (dim);
+    gsl_rng_set (r, 1);
+    gsl_monte_miser_integrate (F, xl, xu, dim, calls, r, s, &res, &err);
+    gsl_rng_set (r, 1);
+    gsl_monte_miser_integrate_vec (&G, xl, xu, dim, calls, r, s, 
+                                   &res_vec, &err_vec);
+    gsl_test_rel (res_vec, res, 0.0, "miser_vec, %s, result", desc);
+    gsl_test_rel (err_vec, err, 0.0, "miser_vec, %s, abserr", desc);
+    gsl_monte_miser_free (s);
+  }
+
+  {
+    gsl_monte_vegas_state * s1 = gsl_monte_vegas_alloc (dim);
+    gsl_monte_vegas_state * s2 = gsl_monte_vegas_alloc (dim);
+    gsl_rng_set (r, 1);
+    gsl_monte_vegas_integrate (F, xl, xu, dim, calls, r, s1, &res, &err);
+    gsl_monte_vegas_integrate (F, xl, xu, dim, calls, r, s1, &res, &err);
+    gsl_rng_set (r, 1);
+    gsl_monte_vegas_integrate_vec (&G, xl, xu, dim, calls, r, s2, 
+                                   &res_vec, &err_vec);
+    gsl_monte_vegas_integrate_vec (&G, xl, xu, dim, calls, r, s2, 
+                                   &res_vec, &err_vec);
+    gsl_test_rel (res_vec, res, 0.0, "vegas_vec, %s, result", desc);
+    gsl_test_rel (err_vec, err, 0.0, "vegas_vec, %s, abserr", desc);
+    gsl_test_rel (gsl_monte_vegas_chisq (s2), gsl_monte_vegas_chisq (s1), 
+                  0.0, "vegas_vec, %s, chisq", desc);
+    gsl_monte_vegas_free (s1);
+    gsl_monte_vegas_free (s2);
+  }
+
+  gsl_rng_free (r);
+}
+
+void
+test_qmc (gsl_monte_function * F, size_t dim, size_t calls, int mode,
+          const gsl_qrng_type * T, double expected_error, const char * desc)
+{
+  gsl_rng * r = gsl_rng_alloc (gsl_rng_default);
+  gsl_monte_qmc_state * s = gsl_monte_qmc_alloc (dim);
+  gsl_monte_qmc_params params;
+  const char * name = (mode == GSL_MONTE_QMC_LATTICE) ? "lattice" : "sequence";
+  double res, err, res_vec, err_vec, err2;
+  gsl_monte_function_vec G;
+  int k;
+
+  gsl_monte_qmc_params_get (s, &params);
+  params.mode = mode;
+  if (T) 
+    params.qrng_type = T;
+  gsl_monte_qmc_params_set (s, &params);
+
+  gsl_monte_qmc_integrate (F, xl, xu, dim, calls, r, s, &res, &err);
+
+  gsl_test_abs (res, 1.0, 5 * GSL_MAX (err, 1024 * GSL_DBL_EPSILON),
+                "qmc(%s), %s, result", name, desc);
+
+  /* a single error estimate from a few shifts is noisy, so compare
+     the rms of the estimates over independent randomizations */
+
+  err2 = err * err;
+
+  for (k = 1; k < 8; k++)
+    {
+      gsl_monte_qmc_integrate (F, xl, xu, dim, calls, r, s, &res, &err);
+      err2 += err * err;
+    }
+
+  err = sqrt (err2 / 8);
+
+  gsl_test (err > expected_error, 
+            "qmc(%s), %s, rms abserr (obs %g vs max %g)", name, desc,
+            err, expected_error);
+
+  /* batched integrand must give the same result */
+
+  G.f = &fvec;
+  G.dim = dim;
+  G.params = F;
+
+  gsl_rng_set (r, 0);
+  gsl_monte_qmc_integrate (F, xl, xu, dim, calls, r, s, &res, &err);
+  gsl_rng_set (r, 0);
+  gsl_monte_qmc_integrate_vec (&G, xl, xu, dim, calls, r, s, 
+                               &res_vec, &err_vec);
+  gsl_test_rel (res_vec, res, 0.0, "qmc_vec(%s), %s, result", name, desc);
+  gsl_test_rel (err_vec, err, 0.0, "qmc_vec(%s), %s, abserr", name, desc);
+
+  gsl_monte_qmc_free (s);
+  gsl_rng_free (r);
+}
+
 void
 my_error_handler (const char *reason, const char *file, int line, int err)
 {
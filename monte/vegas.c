@@ -64,6 +64,8 @@
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_monte_vegas.h>
 
+#include "batch.c"
+
 /* lib-specific headers */
 #define BINS_MAX 50             /* even integer, will be divided by two */
 
@@ -105,6 +107,14 @@ static void print_res (gsl_monte_vegas_state * state,
 static void print_dist (gsl_monte_vegas_state * state, unsigned long dim);
 static void print_grid (gsl_monte_vegas_state * state, unsigned long dim);
 
+static int vegas_integrate (gsl_monte_function * f,
+                            gsl_monte_function_vec * fv,
+                            double xl[], double xu[],
+                            size_t dim, size_t calls,
+                            gsl_rng * r,
+                            gsl_monte_vegas_state * state,
+                            double *result, double *abserr);
+
 int
 gsl_monte_vegas_integrate (gsl_monte_function * f,
                            double xl[], double xu[],
@@ -112,6 +122,31 @@ gsl_monte_vegas_integrate (gsl_monte_function * f,
                            gsl_rng * r,
                            gsl_monte_vegas_state * state,
                            double *result, double *abserr)
+{
+  return vegas_integrate (f, 0, xl, xu, dim, calls, r, state,
+                          result, abserr);
+}
+
+int
+gsl_monte_vegas_integrate_vec (gsl_monte_function_vec * f,
+                               double xl[], double xu[],
+                               size_t dim, size_t calls,
+                               gsl_rng * r,
+                               gsl_monte_vegas_state * state,
+                               double *result, double *abserr)
+{
+  return vegas_integrate (0, f, xl, xu, dim, calls, r, state,
+                          result, abserr);
+}
+
+static int
+vegas_integrate (gsl_monte_function * f,
+                 gsl_monte_function_vec * fv,
+                 double xl[], double xu[],
+                 size_t dim, size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_vegas_state * state,
+                 double *result, double *abserr)
 {
   double cum_int, cum_sig;
   size_t i, k, it;
@@ -225,53 +260,80 @@ gsl_monte_vegas_integrate (gsl_monte_function * f,
       double jacbin = state->jac;
       double *x = state->x;
       coord *bin = state->bin;
+      volatile double m = 0, q = 0;
+      int more_boxes = 1;
+      size_t k_gen = 0, k_acc = 0;
 
       state->it_num = state->it_start + it;
 
       reset_grid_values (state);
       init_box_coord (state, state->box);
+
+      /* The points of consecutive boxes are generated into a block of
+         at most state->batch points, which is evaluated in one go and
+         then accumulated box by box in the original order */
       
       do
         {
-          volatile double m = 0, q = 0;
-          double f_sq_sum = 0.0;
+          size_t nb = 0;
 
-          for (k = 0; k < calls_per_box; k++)
+          while (nb < state->batch && more_boxes)
             {
-              volatile double fval;
-              double bin_vol;
+              random_point (x + nb * dim, bin + nb * dim, 
+                            &(state->bin_vol[nb]), state->box, xl, xu, 
+                            state, r);
+              nb++;
 
-              random_point (x, bin, &bin_vol, state->box, xl, xu, state, r);
+              if (++k_gen == calls_per_box)
+                {
+                  k_gen = 0;
+                  more_boxes = change_box_coord (state, state->box);
+                }
+            }
+
+          batch_eval (f, fv, x, nb, dim, state->fx);
+
+          for (k = 0; k < nb; k++)
+            {
+              volatile double fval;
+              coord *bin_k = bin + k * dim;
 
-              fval = jacbin * bin_vol * GSL_MONTE_FN_EVAL (f, x);
+              fval = jacbin * state->bin_vol[k] * state->fx[k];
 
               /* recurrence for mean and variance (sum of squares) */
 
               {
                 double d = fval - m;
-                m += d / (k + 1.0);
-                q += d * d * (k / (k + 1.0));
+                m += d / (k_acc + 1.0);
+                q += d * d * (k_acc / (k_acc + 1.0));
               }
 
               if (state->mode != GSL_VEGAS_MODE_STRATIFIED)
                 {
                   double f_sq = fval * fval;
-                  accumulate_distribution (state, bin, f_sq);
+                  accumulate_distribution (state, bin_k, f_sq);
                 }
-            }
 
-          intgrl += m * calls_per_box;
+              if (++k_acc == calls_per_box)
+                {
+                  double f_sq_sum = q * calls_per_box;
 
-          f_sq_sum = q * calls_per_box;
+                  intgrl += m * calls_per_box;
 
-          tss += f_sq_sum;
+                  tss += f_sq_sum;
 
-          if (state->mode == GSL_VEGAS_MODE_STRATIFIED)
-            {
-              accumulate_distribution (state, bin, f_sq_sum);
+                  if (state->mode == GSL_VEGAS_MODE_STRATIFIED)
+                    {
+                      accumulate_distribution (state, bin_k, f_sq_sum);
+                    }
+
+                  m = 0;
+                  q = 0;
+                  k_acc = 0;
+                }
             }
         }
-      while (change_box_coord (state, state->box));
+      while (more_boxes);
 
       /* Compute final results for this iteration   */
 
@@ -453,7 +515,9 @@ gsl_monte_vegas_alloc (size_t dim)
       GSL_ERROR_VAL ("failed to allocate space for box", GSL_ENOMEM, 0);
     }
 
-  s->bin = (coord *) malloc (dim * sizeof (coord));
+  s->batch = batch_size (dim);
+
+  s->bin = (coord *) malloc (s->batch * dim * sizeof (coord));
 
   if (s->bin == 0)
     {
@@ -467,7 +531,7 @@ gsl_monte_vegas_alloc (size_t dim)
       GSL_ERROR_VAL ("failed to allocate space for bin", GSL_ENOMEM, 0);
     }
 
-  s->x = (double *) malloc (dim * sizeof (double));
+  s->x = (double *) malloc (s->batch * dim * sizeof (double));
 
   if (s->x == 0)
     {
@@ -482,6 +546,39 @@ gsl_monte_vegas_alloc (size_t dim)
       GSL_ERROR_VAL ("failed to allocate space for x", GSL_ENOMEM, 0);
     }
 
+  s->fx = (double *) malloc (s->batch * sizeof (double));
+
+  if (s->fx == 0)
+    {
+      free (s->x);
+      free (s->bin);
+      free (s->box);
+      free (s->weight);
+      free (s->xin);
+      free (s->xi);
+      free (s->d);
+      free (s->delx);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for fx", GSL_ENOMEM, 0);
+    }
+
+  s->bin_vol = (double *) malloc (s->batch * sizeof (double));
+
+  if (s->bin_vol == 0)
+    {
+      free (s->fx);
+      free (s->x);
+      free (s->bin);
+      free (s->box);
+      free (s->weight);
+      free (s->xin);
+      free (s->xi);
+      free (s->d);
+      free (s->delx);
+      free (s);
+      GSL_ERROR_VAL ("failed to allocate space for bin_vol", GSL_ENOMEM, 0);
+    }
+
   s->dim = dim;
   s->bins_max = BINS_MAX;
 
@@ -510,6 +607,8 @@ void
 gsl_monte_vegas_free (gsl_monte_vegas_state * s)
 {
   RETURN_IF_NULL (s);
+  free (s->bin_vol);
+  free (s->fx);
   free (s->x);
   free (s->delx);
   free (s->d);
@@ -87,6 +87,46 @@ gsl_multifit_fdfsolver_test (const gsl_multifit_fdfsolver * s,
   return GSL_CONTINUE;
 } /* gsl_multifit_fdfsolver_test() */
 
+/*
+gsl_multifit_largesolver_test()
+  Convergence tests for large nonlinear minimization, with the same
+criteria and info flags as gsl_multifit_fdfsolver_test(). The gradient
+g = J^T f is maintained by the solver.
+*/
+
+int
+gsl_multifit_largesolver_test (const gsl_multifit_largesolver * s,
+                               const double xtol, const double gtol,
+                               const double ftol, int *info)
+{
+  int status;
+  double gnorm, fnorm, phi;
+
+  *info = 0;
+
+  status = gsl_multifit_test_delta(s->dx, s->x, xtol*xtol, xtol);
+  if (status == GSL_SUCCESS)
+    {
+      *info = 1;
+      return GSL_SUCCESS;
+    }
+
+  /* compute gnorm = max_i( g_i * max(x_i, 1) ) */
+  gnorm = scaled_infnorm(s->x, s->g);
+
+  /* compute fnorm = ||f|| */
+  fnorm = gsl_blas_dnrm2(s->f);
+  phi = 0.5 * fnorm * fnorm;
+
+  if (gnorm <= gtol * GSL_MAX(phi, 1.0))
+    {
+      *info = 2;
+      return GSL_SUCCESS;
+    }
+
+  return GSL_CONTINUE;
+} /* gsl_multifit_largesolver_test() */
+
 int
 gsl_multifit_test_delta (const gsl_vector * dx, const gsl_vector * x, 
                          double epsabs, double epsrel)
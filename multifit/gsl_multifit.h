@@ -145,6 +145,39 @@ int
 gsl_multifit_linear_residuals (const gsl_matrix *X, const gsl_vector *y,
                                const gsl_vector *c, gsl_vector *r);
 
+typedef struct
+{
+  size_t p;            /* number of parameters */
+  size_t n;            /* number of observations accumulated */
+  gsl_matrix *T;       /* (p+1)-by-(p+1) triangular factor of [X y] */
+  gsl_vector *row;     /* row workspace, length p+1 */
+  gsl_multifit_linear_workspace *multifit_p;
+} gsl_multifit_linear_tsqr_workspace;
+
+gsl_multifit_linear_tsqr_workspace *
+gsl_multifit_linear_tsqr_alloc (size_t p);
+
+void
+gsl_multifit_linear_tsqr_free (gsl_multifit_linear_tsqr_workspace * w);
+
+int
+gsl_multifit_linear_tsqr_reset (gsl_multifit_linear_tsqr_workspace * w);
+
+int
+gsl_multifit_linear_tsqr_accumulate (const gsl_matrix * X,
+                                     const gsl_vector * y,
+                                     gsl_multifit_linear_tsqr_workspace * w);
+
+int
+gsl_multifit_linear_tsqr_merge (const gsl_multifit_linear_tsqr_workspace * src,
+                                gsl_multifit_linear_tsqr_workspace * dest);
+
+int
+gsl_multifit_linear_tsqr_solve (const double tol, size_t * rank,
+                                gsl_vector * c, gsl_matrix * cov,
+                                double * chisq,
+                                gsl_multifit_linear_tsqr_workspace * w);
+
 typedef struct
 {
   const char * name;     /* method name */
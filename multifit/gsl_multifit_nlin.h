@@ -26,6 +26,8 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_permutation.h>
+#include <gsl/gsl_blas_types.h>
+#include <gsl/gsl_spmatrix.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -263,11 +265,89 @@ int gsl_multifit_fdfridge_driver (gsl_multifit_fdfridge * w,
                                   const double ftol,
                                   int *info);
 
+/* Definition of vector-valued functions whose Jacobian is provided
+   as a sparse matrix (df), or only through the products J u and
+   J^T u (dfv), for problems too large to store J as a dense matrix.
+   jtj optionally computes J^T J (lower triangle) and J^T f directly,
+   for solvers working with the normal equations */
+
+struct gsl_multifit_function_large_struct
+{
+  int (* f) (const gsl_vector * x, void * params, gsl_vector * f);
+  int (* df) (const gsl_vector * x, void * params, gsl_spmatrix * J);
+  int (* dfv) (CBLAS_TRANSPOSE_t TransJ, const gsl_vector * x,
+               const gsl_vector * u, void * params, gsl_vector * v);
+  int (* jtj) (const gsl_vector * x, const gsl_vector * f, void * params,
+               gsl_matrix * JTJ, gsl_vector * JTf);
+  size_t n;       /* number of functions */
+  size_t p;       /* number of independent variables */
+  void * params;  /* user parameters */
+  size_t nevalf;  /* number of function evaluations */
+  size_t nevaldf; /* number of Jacobian evaluations or products */
+};
+
+typedef struct gsl_multifit_function_large_struct gsl_multifit_function_large ;
+
+typedef struct
+  {
+    const char *name;
+    size_t size;
+    int (*alloc) (void *state, size_t n, size_t p);
+    int (*set) (void *state, gsl_multifit_function_large * fdf,
+                gsl_spmatrix * J, gsl_vector * x,
+                gsl_vector * f, gsl_vector * g);
+    int (*iterate) (void *state, gsl_multifit_function_large * fdf,
+                    gsl_spmatrix * J, gsl_vector * x,
+                    gsl_vector * f, gsl_vector * g, gsl_vector * dx);
+    void (*free) (void *state);
+  }
+gsl_multifit_largesolver_type;
+
+typedef struct
+  {
+    const gsl_multifit_largesolver_type * type;
+    gsl_multifit_function_large * fdf ;
+    gsl_vector * x;        /* parameter values x */
+    gsl_vector * f;        /* residual vector f(x) */
+    gsl_vector * dx;       /* step dx */
+    gsl_vector * g;        /* gradient J^T f */
+    gsl_spmatrix * J;      /* sparse Jacobian, NULL if matrix-free */
+    size_t niter;          /* number of iterations performed */
+    void *state;
+  }
+gsl_multifit_largesolver;
+
+gsl_multifit_largesolver *
+gsl_multifit_largesolver_alloc (const gsl_multifit_largesolver_type * T, 
+                                size_t n, size_t p);
+void gsl_multifit_largesolver_free (gsl_multifit_largesolver * s);
+int gsl_multifit_largesolver_set (gsl_multifit_largesolver * s, 
+                                  gsl_multifit_function_large * fdf,
+                                  const gsl_vector * x);
+int gsl_multifit_largesolver_iterate (gsl_multifit_largesolver * s);
+int gsl_multifit_largesolver_driver (gsl_multifit_largesolver * s,
+                                     const size_t maxiter,
+                                     const double xtol,
+                                     const double gtol,
+                                     const double ftol,
+                                     int *info);
+int gsl_multifit_largesolver_test (const gsl_multifit_largesolver * s,
+                                   const double xtol,
+                                   const double gtol,
+                                   const double ftol, int *info);
+const char * gsl_multifit_largesolver_name (const gsl_multifit_largesolver * s);
+gsl_vector * gsl_multifit_largesolver_position (const gsl_multifit_largesolver * s);
+gsl_vector * gsl_multifit_largesolver_residual (const gsl_multifit_largesolver * s);
+size_t gsl_multifit_largesolver_niter (const gsl_multifit_largesolver * s);
+
 /* extern const gsl_multifit_fsolver_type * gsl_multifit_fsolver_gradient; */
 
 GSL_VAR const gsl_multifit_fdfsolver_type * gsl_multifit_fdfsolver_lmsder;
 GSL_VAR const gsl_multifit_fdfsolver_type * gsl_multifit_fdfsolver_lmder;
 GSL_VAR const gsl_multifit_fdfsolver_type * gsl_multifit_fdfsolver_lmniel;
+GSL_VAR const gsl_multifit_largesolver_type * gsl_multifit_largesolver_steihaug;
+GSL_VAR const gsl_multifit_largesolver_type * gsl_multifit_largesolver_lmlsqr;
+GSL_VAR const gsl_multifit_largesolver_type * gsl_multifit_largesolver_lmchol;
 
 __END_DECLS
 
@@ -0,0 +1,270 @@
+/* multifit/largesolver.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_multifit_nlin.h>
+
+gsl_multifit_largesolver *
+gsl_multifit_largesolver_alloc (const gsl_multifit_largesolver_type * T,
+                                size_t n, size_t p)
+{
+  int status;
+
+  gsl_multifit_largesolver * s;
+
+  if (n < p)
+    {
+      GSL_ERROR_VAL ("insufficient data points, n < p", GSL_EINVAL, 0);
+    }
+
+  s = (gsl_multifit_largesolver *) calloc (1, sizeof (gsl_multifit_largesolver));
+  if (s == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for multifit solver struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  s->x = gsl_vector_calloc (p);
+
+  if (s->x == 0)
+    {
+      gsl_multifit_largesolver_free (s);
+      GSL_ERROR_VAL ("failed to allocate space for x", GSL_ENOMEM, 0);
+    }
+
+  s->f = gsl_vector_calloc (n);
+
+  if (s->f == 0)
+    {
+      gsl_multifit_largesolver_free (s);
+      GSL_ERROR_VAL ("failed to allocate space for f", GSL_ENOMEM, 0);
+    }
+
+  s->dx = gsl_vector_calloc (p);
+
+  if (s->dx == 0)
+    {
+      gsl_multifit_largesolver_free (s);
+      GSL_ERROR_VAL ("failed to allocate space for dx", GSL_ENOMEM, 0);
+    }
+
+  s->g = gsl_vector_calloc (p);
+
+  if (s->g == 0)
+    {
+      gsl_multifit_largesolver_free (s);
+      GSL_ERROR_VAL ("failed to allocate space for g", GSL_ENOMEM, 0);
+    }
+
+  s->state = calloc (1, T->size);
+
+  if (s->state == 0)
+    {
+      gsl_multifit_largesolver_free (s);
+      GSL_ERROR_VAL ("failed to allocate space for multifit solver state",
+                     GSL_ENOMEM, 0);
+    }
+
+  s->type = T ;
+
+  status = (s->type->alloc)(s->state, n, p);
+
+  if (status != GSL_SUCCESS)
+    {
+      gsl_multifit_largesolver_free (s);
+      GSL_ERROR_VAL ("failed to set solver", status, 0);
+    }
+
+  /* the sparse Jacobian is allocated on the first call to _set, once
+     it is known whether the user supplies df or only dfv */
+  s->J = NULL;
+
+  s->fdf = NULL;
+
+  s->niter = 0;
+
+  return s;
+}
+
+int
+gsl_multifit_largesolver_set (gsl_multifit_largesolver * s,
+                              gsl_multifit_function_large * f,
+                              const gsl_vector * x)
+{
+  const size_t n = s->f->size;
+  const size_t p = s->x->size;
+
+  if (n != f->n || p != f->p)
+    {
+      GSL_ERROR ("function size does not match solver", GSL_EBADLEN);
+    }
+  else if (p != x->size)
+    {
+      GSL_ERROR ("vector length does not match solver", GSL_EBADLEN);
+    }
+  else if (f->df == NULL && f->dfv == NULL && f->jtj == NULL)
+    {
+      GSL_ERROR ("one of df, dfv or jtj must be provided", GSL_EINVAL);
+    }
+  else
+    {
+      if (f->df != NULL && s->J == NULL)
+        {
+          /* start with room for one element per row; gsl_spmatrix_set
+           * doubles the storage as needed and it is kept across
+           * subsequent Jacobian evaluations */
+          s->J = gsl_spmatrix_alloc_nzmax (n, p, n, GSL_SPMATRIX_TRIPLET);
+          if (s->J == NULL)
+            {
+              GSL_ERROR ("failed to allocate space for J", GSL_ENOMEM);
+            }
+        }
+      else if (f->df == NULL && s->J != NULL)
+        {
+          gsl_spmatrix_free (s->J);
+          s->J = NULL;
+        }
+
+      s->fdf = f;
+      gsl_vector_memcpy(s->x, x);
+      gsl_vector_set_zero(s->dx);
+      s->niter = 0;
+
+      return (s->type->set) (s->state, s->fdf, s->J, s->x, s->f, s->g);
+    }
+}
+
+int
+gsl_multifit_largesolver_iterate (gsl_multifit_largesolver * s)
+{
+  int status =
+    (s->type->iterate) (s->state, s->fdf, s->J, s->x, s->f, s->g, s->dx);
+
+  s->niter++;
+
+  return status;
+}
+
+/*
+gsl_multifit_largesolver_driver()
+  Iterate the large nonlinear least squares solver until completion
+
+Inputs: s - largesolver
+        maxiter - maximum iterations to allow
+        xtol    - tolerance in step x
+        gtol    - tolerance in gradient
+        ftol    - tolerance in ||f||
+        info    - (output) info flag on why iteration terminated,
+                  see gsl_multifit_fdfsolver_driver()
+
+Return: GSL_SUCCESS if converged, GSL_MAXITER if maxiter exceeded without
+converging
+*/
+int
+gsl_multifit_largesolver_driver (gsl_multifit_largesolver * s,
+                                 const size_t maxiter,
+                                 const double xtol,
+                                 const double gtol,
+                                 const double ftol,
+                                 int *info)
+{
+  int status;
+  size_t iter = 0;
+
+  do
+    {
+      status = gsl_multifit_largesolver_iterate (s);
+
+      if (status != GSL_SUCCESS && status != GSL_ENOPROG)
+        break;
+
+      /* test for convergence */
+      status = gsl_multifit_largesolver_test(s, xtol, gtol, ftol, info);
+    }
+  while (status == GSL_CONTINUE && ++iter < maxiter);
+
+  if (status == GSL_ETOLF || status == GSL_ETOLX || status == GSL_ETOLG)
+    {
+      *info = status;
+      status = GSL_SUCCESS;
+    }
+
+  /* check if max iterations reached */
+  if (iter >= maxiter && status != GSL_SUCCESS)
+    status = GSL_EMAXITER;
+
+  return status;
+} /* gsl_multifit_largesolver_driver() */
+
+void
+gsl_multifit_largesolver_free (gsl_multifit_largesolver * s)
+{
+  RETURN_IF_NULL (s);
+
+  if (s->state)
+    {
+      (s->type->free) (s->state);
+      free (s->state);
+    }
+
+  if (s->J)
+    gsl_spmatrix_free (s->J);
+
+  if (s->dx)
+    gsl_vector_free (s->dx);
+
+  if (s->x)
+    gsl_vector_free (s->x);
+
+  if (s->f)
+    gsl_vector_free (s->f);
+
+  if (s->g)
+    gsl_vector_free (s->g);
+
+  free (s);
+}
+
+const char *
+gsl_multifit_largesolver_name (const gsl_multifit_largesolver * s)
+{
+  return s->type->name;
+}
+
+gsl_vector *
+gsl_multifit_largesolver_position (const gsl_multifit_largesolver * s)
+{
+  return s->x;
+}
+
+gsl_vector *
+gsl_multifit_largesolver_residual (const gsl_multifit_largesolver * s)
+{
+  return s->f;
+}
+
+size_t
+gsl_multifit_largesolver_niter (const gsl_multifit_largesolver * s)
+{
+  return s->niter;
+}
@@ -0,0 +1,161 @@
+/* multifit/largeutil.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Helpers shared by the large scale solvers. The Jacobian is either
+ * stored in the sparse matrix J (user supplied df) or is only
+ * available through products with the user supplied dfv, in which
+ * case J is NULL.
+ */
+
+/* compute f = f(x) */
+static int
+large_eval_f(gsl_multifit_function_large *fdf, const gsl_vector *x,
+             gsl_vector *f)
+{
+  int s = ((*((fdf)->f)) (x, fdf->params, f));
+  ++(fdf->nevalf);
+  return s;
+}
+
+/* compute J = J(x); nothing to do in matrix-free mode */
+static int
+large_eval_df(gsl_multifit_function_large *fdf, const gsl_vector *x,
+              gsl_spmatrix *J)
+{
+  int s;
+
+  if (J == NULL)
+    return GSL_SUCCESS;
+
+  /* keep the storage of the previous Jacobian */
+  gsl_spmatrix_set_zero(J);
+
+  s = ((*((fdf)->df)) (x, fdf->params, J));
+  ++(fdf->nevaldf);
+
+  return s;
+}
+
+/* compute v = op(J(x)) u */
+static int
+large_jac_mult(CBLAS_TRANSPOSE_t TransJ, gsl_multifit_function_large *fdf,
+               const gsl_spmatrix *J, const gsl_vector *x,
+               const gsl_vector *u, gsl_vector *v)
+{
+  if (J != NULL)
+    {
+      return gsl_spblas_dgemv(TransJ, 1.0, J, u, 0.0, v);
+    }
+  else
+    {
+      int s = ((*((fdf)->dfv)) (TransJ, x, u, fdf->params, v));
+      ++(fdf->nevaldf);
+      return s;
+    }
+}
+
+/* compute J = J(x) and g = J^T f at a new point x */
+static int
+large_eval_jg(gsl_multifit_function_large *fdf, const gsl_vector *x,
+              const gsl_vector *f, gsl_spmatrix *J, gsl_vector *g)
+{
+  int status;
+
+  status = large_eval_df(fdf, x, J);
+  if (status)
+    return status;
+
+  return large_jac_mult(CblasTrans, fdf, J, x, f, g);
+}
+
+/* compute x_trial = x + dx */
+static void
+large_trial_step(const gsl_vector * x, const gsl_vector * dx,
+                 gsl_vector * x_trial)
+{
+  gsl_vector_memcpy(x_trial, x);
+  gsl_vector_add(x_trial, dx);
+}
+
+/* compute dF = F(x) - F(x + dx) = 1/2 (f - f_new)^T (f + f_new) */
+static double
+large_calc_dF(const gsl_vector *f, const gsl_vector *f_new)
+{
+  const size_t N = f->size;
+  size_t i;
+  double dF = 0.0;
+
+  for (i = 0; i < N; ++i)
+    {
+      double fi = gsl_vector_get(f, i);
+      double fnewi = gsl_vector_get(f_new, i);
+
+      dF += (fi - fnewi) * (fi + fnewi);
+    }
+
+  return 0.5 * dF;
+}
+
+#ifdef LARGEUTIL_INEXACT
+
+/*
+ * Helpers for the solvers whose inner iterations are truncated, which
+ * define LARGEUTIL_INEXACT before including this file.
+ */
+
+/*
+large_model_reduction()
+  Compute the reduction in the Gauss-Newton model of F = 1/2 ||f||^2
+for a step dx:
+
+m(0) - m(dx) = -g^T dx - 1/2 ||J dx||^2
+
+Inputs: Jdx - workspace, length n
+*/
+static int
+large_model_reduction(gsl_multifit_function_large *fdf,
+                      const gsl_spmatrix *J, const gsl_vector *x,
+                      const gsl_vector *g, const gsl_vector *dx,
+                      gsl_vector *Jdx, double *dL)
+{
+  int status;
+  double gdx, Jdx2;
+
+  status = large_jac_mult(CblasNoTrans, fdf, J, x, dx, Jdx);
+  if (status)
+    return status;
+
+  gsl_blas_ddot(g, dx, &gdx);
+  Jdx2 = gsl_blas_dnrm2(Jdx);
+  Jdx2 *= Jdx2;
+
+  *dL = -gdx - 0.5 * Jdx2;
+
+  return GSL_SUCCESS;
+}
+
+/* relative tolerance for the inner iterations, min(1/2, sqrt(||g||)) */
+static double
+large_forcing(const double gnorm)
+{
+  return GSL_MIN(0.5, sqrt(gnorm));
+}
+
+#endif /* LARGEUTIL_INEXACT */
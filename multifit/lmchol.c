@@ -0,0 +1,404 @@
+/* multifit/lmchol.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_multifit_nlin.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+
+/*
+ * This module contains a Levenberg-Marquardt method for nonlinear
+ * least squares problems with many more residuals than parameters
+ * (n >> p). The p-by-p matrix J^T J is formed once per Jacobian
+ * evaluation, either by the user supplied jtj function, which may
+ * accumulate it over blocks of rows without ever storing J, or from
+ * p products with J and J^T. Each trial step then only requires a
+ * Cholesky factorization of J^T J + mu I and one evaluation of f.
+ * The damping parameter is updated as in the lmniel solver.
+ *
+ * [1] H. B. Nielsen, K. Madsen, Introduction to Optimization and
+ *     Data Fitting, Informatics and Mathematical Modeling,
+ *     Technical University of Denmark (DTU), 2010.
+ */
+
+typedef struct
+{
+  gsl_matrix *A;             /* J^T J, lower triangle */
+  gsl_matrix *L;             /* Cholesky factor of J^T J + mu I */
+  gsl_vector *x_trial;       /* trial parameter vector */
+  gsl_vector *f_trial;       /* trial function vector */
+  gsl_vector *workp;         /* workspace length p */
+  gsl_vector *workn;         /* workspace length n */
+  long nu;                   /* nu */
+  double mu;                 /* LM damping parameter mu */
+  double tau;                /* initial scale factor for mu */
+} lmchol_state_t;
+
+#include "largeutil.c"
+
+#define LM_ONE_THIRD         (0.333333333333333)
+
+static int lmchol_alloc (void *vstate, const size_t n, const size_t p);
+static void lmchol_free(void *vstate);
+static int lmchol_set(void *vstate, gsl_multifit_function_large *fdf,
+                      gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                      gsl_vector *g);
+static int lmchol_iterate(void *vstate, gsl_multifit_function_large *fdf,
+                          gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                          gsl_vector *g, gsl_vector *dx);
+
+static int
+lmchol_alloc (void *vstate, const size_t n, const size_t p)
+{
+  lmchol_state_t *state = (lmchol_state_t *) vstate;
+
+  state->A = gsl_matrix_alloc(p, p);
+  if (state->A == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for A", GSL_ENOMEM);
+    }
+
+  state->L = gsl_matrix_alloc(p, p);
+  if (state->L == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for L", GSL_ENOMEM);
+    }
+
+  state->x_trial = gsl_vector_alloc(p);
+  if (state->x_trial == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for x_trial", GSL_ENOMEM);
+    }
+
+  state->f_trial = gsl_vector_alloc(n);
+  if (state->f_trial == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for f_trial", GSL_ENOMEM);
+    }
+
+  state->workp = gsl_vector_alloc(p);
+  if (state->workp == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for workp", GSL_ENOMEM);
+    }
+
+  state->workn = gsl_vector_alloc(n);
+  if (state->workn == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for workn", GSL_ENOMEM);
+    }
+
+  state->tau = 1.0e-3;
+
+  return GSL_SUCCESS;
+} /* lmchol_alloc() */
+
+static void
+lmchol_free(void *vstate)
+{
+  lmchol_state_t *state = (lmchol_state_t *) vstate;
+
+  if (state->A)
+    gsl_matrix_free(state->A);
+
+  if (state->L)
+    gsl_matrix_free(state->L);
+
+  if (state->x_trial)
+    gsl_vector_free(state->x_trial);
+
+  if (state->f_trial)
+    gsl_vector_free(state->f_trial);
+
+  if (state->workp)
+    gsl_vector_free(state->workp);
+
+  if (state->workn)
+    gsl_vector_free(state->workn);
+} /* lmchol_free() */
+
+/*
+lmchol_eval_normal()
+  Compute A = J(x)^T J(x) (lower triangle) and g = J(x)^T f. Without
+a user supplied jtj function, column j of A is computed as
+J^T (J e_j)
+*/
+static int
+lmchol_eval_normal(lmchol_state_t *state, gsl_multifit_function_large *fdf,
+                   gsl_spmatrix *J, const gsl_vector *x,
+                   const gsl_vector *f, gsl_vector *g)
+{
+  int status;
+  gsl_matrix *A = state->A;
+  const size_t p = x->size;
+  size_t j;
+
+  if (fdf->jtj)
+    {
+      gsl_matrix_set_zero(A);
+      gsl_vector_set_zero(g);
+
+      status = ((*((fdf)->jtj)) (x, f, fdf->params, A, g));
+      ++(fdf->nevaldf);
+
+      return status;
+    }
+
+  status = large_eval_jg(fdf, x, f, J, g);
+  if (status)
+    return status;
+
+  for (j = 0; j < p; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column(A, j);
+
+      gsl_vector_set_basis(state->workp, j);
+
+      status = large_jac_mult(CblasNoTrans, fdf, J, x, state->workp,
+                              state->workn);
+      if (status)
+        return status;
+
+      status = large_jac_mult(CblasTrans, fdf, J, x, state->workn,
+                              &c.vector);
+      if (status)
+        return status;
+    }
+
+  return GSL_SUCCESS;
+} /* lmchol_eval_normal() */
+
+/* set mu_0 = tau * max(diag(J^T J)) as in lmniel */
+static void
+lmchol_init_mu(lmchol_state_t *state)
+{
+  gsl_vector_view d = gsl_matrix_diagonal(state->A);
+  double dmax = gsl_vector_max(&d.vector);
+
+  state->nu = 2;
+  state->mu = state->tau * (dmax > 0.0 ? dmax : 1.0);
+}
+
+static int
+lmchol_set(void *vstate, gsl_multifit_function_large *fdf,
+           gsl_spmatrix *J, gsl_vector *x, gsl_vector *f, gsl_vector *g)
+{
+  int status;
+  lmchol_state_t *state = (lmchol_state_t *) vstate;
+
+  /* initialize counters for function and Jacobian evaluations */
+  fdf->nevalf = 0;
+  fdf->nevaldf = 0;
+
+  status = large_eval_f(fdf, x, f);
+  if (status)
+    return status;
+
+  status = lmchol_eval_normal(state, fdf, J, x, f, g);
+  if (status)
+    return status;
+
+  lmchol_init_mu(state);
+
+  return GSL_SUCCESS;
+} /* lmchol_set() */
+
+/*
+lmchol_decomp()
+  Cholesky factorization of the lower triangle of L in place. Unlike
+gsl_linalg_cholesky_decomp(), a matrix which is not numerically
+positive definite is reported through the return value only, since
+the caller recovers by increasing mu
+*/
+static int
+lmchol_decomp(gsl_matrix *L)
+{
+  const size_t N = L->size1;
+  size_t i, j, k;
+
+  for (j = 0; j < N; ++j)
+    {
+      double ljj = gsl_matrix_get(L, j, j);
+
+      for (k = 0; k < j; ++k)
+        {
+          double ljk = gsl_matrix_get(L, j, k);
+          ljj -= ljk * ljk;
+        }
+
+      if (!(ljj > 0.0))
+        return GSL_EDOM;
+
+      ljj = sqrt(ljj);
+      gsl_matrix_set(L, j, j, ljj);
+
+      for (i = j + 1; i < N; ++i)
+        {
+          double lij = gsl_matrix_get(L, i, j);
+
+          for (k = 0; k < j; ++k)
+            lij -= gsl_matrix_get(L, i, k) * gsl_matrix_get(L, j, k);
+
+          gsl_matrix_set(L, i, j, lij / ljj);
+        }
+    }
+
+  return GSL_SUCCESS;
+} /* lmchol_decomp() */
+
+/* solve (A + mu I) dx = -g */
+static int
+lmchol_calc_dx(lmchol_state_t *state, const gsl_vector *g, gsl_vector *dx)
+{
+  int status;
+  gsl_matrix *L = state->L;
+  gsl_vector_view d = gsl_matrix_diagonal(L);
+
+  gsl_matrix_memcpy(L, state->A);
+  gsl_vector_add_constant(&d.vector, state->mu);
+
+  status = lmchol_decomp(L);
+  if (status)
+    return status;
+
+  gsl_vector_memcpy(dx, g);
+  gsl_vector_scale(dx, -1.0);
+  gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, L, dx);
+  gsl_blas_dtrsv(CblasLower, CblasTrans, CblasNonUnit, L, dx);
+
+  return GSL_SUCCESS;
+} /* lmchol_calc_dx() */
+
+/*
+lmchol_iterate()
+  This function performs 1 iteration of the LM algorithm 6.18
+from [1], looping until an acceptable step dx is found. Rejected
+trial steps cost one Cholesky factorization and one function
+evaluation each; J^T J is only recomputed once a step is accepted
+
+Args: vstate - lmchol workspace
+      fdf    - function and Jacobian pointers
+      J      - on input, sparse J(x) (NULL in matrix-free mode)
+               on output, J(x + dx)
+      x      - on input, current parameter vector
+               on output, new parameter vector x + dx
+      f      - on input, f(x)
+               on output, f(x + dx)
+      g      - on input, J(x)^T f(x)
+               on output, J(x + dx)^T f(x + dx)
+      dx     - (output only) parameter step vector
+*/
+
+static int
+lmchol_iterate(void *vstate, gsl_multifit_function_large *fdf,
+               gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+               gsl_vector *g, gsl_vector *dx)
+{
+  int status;
+  lmchol_state_t *state = (lmchol_state_t *) vstate;
+  gsl_vector *x_trial = state->x_trial;       /* trial x + dx */
+  gsl_vector *f_trial = state->f_trial;       /* trial f(x + dx) */
+  double dF;                                  /* F(x) - F(x + dx) */
+  double dL;                                  /* m(0) - m(dx) */
+
+  /* loop until we find an acceptable step dx */
+  while (1)
+    {
+      long nu2;
+
+      status = lmchol_calc_dx(state, g, dx);
+
+      if (status == GSL_SUCCESS)
+        {
+          double gdx, dAdx;
+
+          /* dL = -g^T dx - 1/2 dx^T A dx */
+          gsl_blas_dsymv(CblasLower, 1.0, state->A, dx, 0.0, state->workp);
+          gsl_blas_ddot(g, dx, &gdx);
+          gsl_blas_ddot(dx, state->workp, &dAdx);
+          dL = -gdx - 0.5 * dAdx;
+
+          if (dL > 0.0)
+            {
+              large_trial_step(x, dx, x_trial);
+
+              status = large_eval_f(fdf, x_trial, f_trial);
+              if (status)
+                return status;
+
+              dF = large_calc_dF(f, f_trial);
+
+              if (dF >= 0.0)
+                {
+                  /* reduction in error, step acceptable */
+
+                  double tmp;
+
+                  /* update LM parameter mu */
+                  tmp = 2.0 * (dF / dL) - 1.0;
+                  tmp = 1.0 - tmp*tmp*tmp;
+                  state->mu *= GSL_MAX(LM_ONE_THIRD, tmp);
+                  state->nu = 2;
+
+                  gsl_vector_memcpy(x, x_trial);
+                  gsl_vector_memcpy(f, f_trial);
+
+                  return lmchol_eval_normal(state, fdf, J, x, f, g);
+                }
+            }
+          else if (gsl_blas_dnrm2(dx) == 0.0)
+            {
+              /* g = 0, nothing left to do */
+              return GSL_ENOPROG;
+            }
+        }
+
+      /* step did not reduce error or A + mu I is singular, reject step */
+      state->mu *= state->nu;
+      nu2 = state->nu << 1; /* 2*nu */
+      if (nu2 <= state->nu)
+        {
+          /*
+           * nu has wrapped around / overflown, reset mu and nu
+           * to original values and return to force another iteration
+           */
+          gsl_vector_set_zero(dx);
+          lmchol_init_mu(state);
+          return GSL_ENOPROG;
+        }
+      state->nu = nu2;
+    }
+} /* lmchol_iterate() */
+
+static const gsl_multifit_largesolver_type lmchol_type =
+{
+  "lmchol",
+  sizeof(lmchol_state_t),
+  &lmchol_alloc,
+  &lmchol_set,
+  &lmchol_iterate,
+  &lmchol_free
+};
+
+const gsl_multifit_largesolver_type *gsl_multifit_largesolver_lmchol = &lmchol_type;
@@ -0,0 +1,425 @@
+/* multifit/lmlsqr.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_multifit_nlin.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+
+/*
+ * This module contains a Levenberg-Marquardt method for large
+ * nonlinear least squares problems. The damped step
+ *
+ *   min_dx || [ J ; sqrt(mu) I ] dx + [ f ; 0 ] ||
+ *
+ * is computed inexactly with the LSQR algorithm, which only requires
+ * products with J and J^T. The damping parameter is updated as in
+ * the lmniel solver.
+ *
+ * [1] C. C. Paige, M. A. Saunders, LSQR: An algorithm for sparse
+ *     linear equations and sparse least squares, ACM Trans. Math.
+ *     Soft. 8 (1982) 43-71.
+ *
+ * [2] H. B. Nielsen, K. Madsen, Introduction to Optimization and
+ *     Data Fitting, Informatics and Mathematical Modeling,
+ *     Technical University of Denmark (DTU), 2010.
+ */
+
+typedef struct
+{
+  gsl_vector *x_trial;       /* trial parameter vector */
+  gsl_vector *f_trial;       /* trial function vector */
+  gsl_vector *u;             /* LSQR left vector, length n */
+  gsl_vector *v;             /* LSQR right vector, length p */
+  gsl_vector *w;             /* LSQR search direction, length p */
+  gsl_vector *workp;         /* workspace length p */
+  gsl_vector *workn;         /* workspace length n */
+  long nu;                   /* nu */
+  double mu;                 /* LM damping parameter mu */
+  double tau;                /* initial scale factor for mu */
+} lmlsqr_state_t;
+
+#define LARGEUTIL_INEXACT
+#include "largeutil.c"
+
+#define LM_ONE_THIRD         (0.333333333333333)
+
+static int lmlsqr_alloc (void *vstate, const size_t n, const size_t p);
+static void lmlsqr_free(void *vstate);
+static int lmlsqr_set(void *vstate, gsl_multifit_function_large *fdf,
+                      gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                      gsl_vector *g);
+static int lmlsqr_iterate(void *vstate, gsl_multifit_function_large *fdf,
+                          gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                          gsl_vector *g, gsl_vector *dx);
+
+static int
+lmlsqr_alloc (void *vstate, const size_t n, const size_t p)
+{
+  lmlsqr_state_t *state = (lmlsqr_state_t *) vstate;
+
+  state->x_trial = gsl_vector_alloc(p);
+  if (state->x_trial == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for x_trial", GSL_ENOMEM);
+    }
+
+  state->f_trial = gsl_vector_alloc(n);
+  if (state->f_trial == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for f_trial", GSL_ENOMEM);
+    }
+
+  state->u = gsl_vector_alloc(n);
+  if (state->u == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for u", GSL_ENOMEM);
+    }
+
+  state->v = gsl_vector_alloc(p);
+  if (state->v == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for v", GSL_ENOMEM);
+    }
+
+  state->w = gsl_vector_alloc(p);
+  if (state->w == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for w", GSL_ENOMEM);
+    }
+
+  state->workp = gsl_vector_alloc(p);
+  if (state->workp == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for workp", GSL_ENOMEM);
+    }
+
+  state->workn = gsl_vector_alloc(n);
+  if (state->workn == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for workn", GSL_ENOMEM);
+    }
+
+  state->tau = 1.0e-3;
+
+  return GSL_SUCCESS;
+} /* lmlsqr_alloc() */
+
+static void
+lmlsqr_free(void *vstate)
+{
+  lmlsqr_state_t *state = (lmlsqr_state_t *) vstate;
+
+  if (state->x_trial)
+    gsl_vector_free(state->x_trial);
+
+  if (state->f_trial)
+    gsl_vector_free(state->f_trial);
+
+  if (state->u)
+    gsl_vector_free(state->u);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->w)
+    gsl_vector_free(state->w);
+
+  if (state->workp)
+    gsl_vector_free(state->workp);
+
+  if (state->workn)
+    gsl_vector_free(state->workn);
+} /* lmlsqr_free() */
+
+/*
+lmlsqr_init_mu()
+  Compute mu_0 = tau * ||J g||^2 / ||g||^2. The Rayleigh quotient of
+J^T J replaces the max(diag(J^T J)) used by lmniel since the diagonal
+is not available in matrix-free mode
+*/
+static int
+lmlsqr_init_mu(lmlsqr_state_t *state, gsl_multifit_function_large *fdf,
+               const gsl_spmatrix *J, const gsl_vector *x,
+               const gsl_vector *g)
+{
+  int status;
+  double gnorm = gsl_blas_dnrm2(g);
+  double Jgnorm;
+
+  state->nu = 2;
+
+  if (gnorm == 0.0)
+    {
+      state->mu = state->tau;
+      return GSL_SUCCESS;
+    }
+
+  status = large_jac_mult(CblasNoTrans, fdf, J, x, g, state->workn);
+  if (status)
+    return status;
+
+  Jgnorm = gsl_blas_dnrm2(state->workn) / gnorm;
+  state->mu = state->tau * Jgnorm * Jgnorm;
+
+  if (state->mu == 0.0)
+    state->mu = state->tau;
+
+  return GSL_SUCCESS;
+}
+
+static int
+lmlsqr_set(void *vstate, gsl_multifit_function_large *fdf,
+           gsl_spmatrix *J, gsl_vector *x, gsl_vector *f, gsl_vector *g)
+{
+  int status;
+  lmlsqr_state_t *state = (lmlsqr_state_t *) vstate;
+
+  if (fdf->df == NULL && fdf->dfv == NULL)
+    {
+      GSL_ERROR ("lmlsqr solver requires df or dfv", GSL_EINVAL);
+    }
+
+  /* initialize counters for function and Jacobian evaluations */
+  fdf->nevalf = 0;
+  fdf->nevaldf = 0;
+
+  status = large_eval_f(fdf, x, f);
+  if (status)
+    return status;
+
+  status = large_eval_jg(fdf, x, f, J, g);
+  if (status)
+    return status;
+
+  return lmlsqr_init_mu(state, fdf, J, x, g);
+} /* lmlsqr_set() */
+
+/*
+lmlsqr_solve()
+  Compute dx ~ argmin || [ J ; sqrt(mu) I ] dx + [ f ; 0 ] || with
+damped LSQR. Iteration stops when the estimate of the normal equation
+residual || (J^T J + mu I) dx + g || drops below forcing * ||g||, or
+after 2p iterations
+*/
+static int
+lmlsqr_solve(lmlsqr_state_t *state, gsl_multifit_function_large *fdf,
+             const gsl_spmatrix *J, const gsl_vector *x,
+             const gsl_vector *f, const gsl_vector *g, gsl_vector *dx)
+{
+  int status;
+  const size_t p = x->size;
+  const double damp = sqrt(state->mu);
+  gsl_vector *u = state->u;
+  gsl_vector *v = state->v;
+  gsl_vector *w = state->w;
+  double gnorm = gsl_blas_dnrm2(g);
+  double tol = large_forcing(gnorm) * gnorm;
+  double alpha, beta, rhobar, phibar;
+  size_t k;
+
+  gsl_vector_set_zero(dx);
+
+  /* beta u = -f */
+  beta = gsl_blas_dnrm2(f);
+  if (beta == 0.0 || gnorm == 0.0)
+    return GSL_SUCCESS;
+
+  gsl_vector_memcpy(u, f);
+  gsl_vector_scale(u, -1.0 / beta);
+
+  /* alpha v = J^T u = -g / beta */
+  gsl_vector_memcpy(v, g);
+  gsl_vector_scale(v, -1.0 / beta);
+  alpha = gsl_blas_dnrm2(v);
+  gsl_vector_scale(v, 1.0 / alpha);
+
+  gsl_vector_memcpy(w, v);
+  phibar = beta;
+  rhobar = alpha;
+
+  for (k = 0; k < 2 * p; ++k)
+    {
+      double rhobar1, cs1, rho, cs, sn, theta, phi;
+
+      /* beta u = J v - alpha u */
+      status = large_jac_mult(CblasNoTrans, fdf, J, x, v, state->workn);
+      if (status)
+        return status;
+
+      gsl_vector_scale(u, -alpha);
+      gsl_vector_add(u, state->workn);
+      beta = gsl_blas_dnrm2(u);
+
+      if (beta > 0.0)
+        {
+          /* alpha v = J^T u - beta v */
+          gsl_vector_scale(u, 1.0 / beta);
+
+          status = large_jac_mult(CblasTrans, fdf, J, x, u, state->workp);
+          if (status)
+            return status;
+
+          gsl_vector_scale(v, -beta);
+          gsl_vector_add(v, state->workp);
+          alpha = gsl_blas_dnrm2(v);
+
+          if (alpha > 0.0)
+            gsl_vector_scale(v, 1.0 / alpha);
+        }
+
+      /* eliminate the damping term */
+      rhobar1 = gsl_hypot(rhobar, damp);
+      cs1 = rhobar / rhobar1;
+      phibar *= cs1;
+
+      /* plane rotation to eliminate beta */
+      rho = gsl_hypot(rhobar1, beta);
+      cs = rhobar1 / rho;
+      sn = beta / rho;
+      theta = sn * alpha;
+      rhobar = -cs * alpha;
+      phi = cs * phibar;
+      phibar *= sn;
+
+      /* dx <- dx + (phi / rho) w, w <- v - (theta / rho) w */
+      gsl_blas_daxpy(phi / rho, w, dx);
+      gsl_vector_scale(w, -theta / rho);
+      gsl_vector_add(w, v);
+
+      if (fabs(phibar * alpha * cs) <= tol || alpha == 0.0)
+        break;
+    }
+
+  return GSL_SUCCESS;
+} /* lmlsqr_solve() */
+
+/*
+lmlsqr_iterate()
+  This function performs 1 iteration of the LM algorithm 6.18
+from [2] with the step computed by LSQR, looping until an acceptable
+step dx is found
+
+Args: vstate - lmlsqr workspace
+      fdf    - function and Jacobian pointers
+      J      - on input, sparse J(x) (NULL in matrix-free mode)
+               on output, J(x + dx)
+      x      - on input, current parameter vector
+               on output, new parameter vector x + dx
+      f      - on input, f(x)
+               on output, f(x + dx)
+      g      - on input, J(x)^T f(x)
+               on output, J(x + dx)^T f(x + dx)
+      dx     - (output only) parameter step vector
+*/
+
+static int
+lmlsqr_iterate(void *vstate, gsl_multifit_function_large *fdf,
+               gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+               gsl_vector *g, gsl_vector *dx)
+{
+  int status;
+  lmlsqr_state_t *state = (lmlsqr_state_t *) vstate;
+  gsl_vector *x_trial = state->x_trial;       /* trial x + dx */
+  gsl_vector *f_trial = state->f_trial;       /* trial f(x + dx) */
+  double dF;                                  /* F(x) - F(x + dx) */
+  double dL;                                  /* m(0) - m(dx) */
+
+  /* loop until we find an acceptable step dx */
+  while (1)
+    {
+      long nu2;
+
+      status = lmlsqr_solve(state, fdf, J, x, f, g, dx);
+      if (status)
+        return status;
+
+      status = large_model_reduction(fdf, J, x, g, dx, state->workn, &dL);
+      if (status)
+        return status;
+
+      if (dL > 0.0)
+        {
+          large_trial_step(x, dx, x_trial);
+
+          status = large_eval_f(fdf, x_trial, f_trial);
+          if (status)
+            return status;
+
+          dF = large_calc_dF(f, f_trial);
+
+          if (dF >= 0.0)
+            {
+              /* reduction in error, step acceptable */
+
+              double tmp;
+
+              /* update LM parameter mu */
+              tmp = 2.0 * (dF / dL) - 1.0;
+              tmp = 1.0 - tmp*tmp*tmp;
+              state->mu *= GSL_MAX(LM_ONE_THIRD, tmp);
+              state->nu = 2;
+
+              gsl_vector_memcpy(x, x_trial);
+              gsl_vector_memcpy(f, f_trial);
+
+              return large_eval_jg(fdf, x, f, J, g);
+            }
+        }
+      else if (gsl_blas_dnrm2(dx) == 0.0)
+        {
+          /* g = 0 or f = 0, nothing left to do */
+          return GSL_ENOPROG;
+        }
+
+      /* step did not reduce error, reject step */
+      state->mu *= state->nu;
+      nu2 = state->nu << 1; /* 2*nu */
+      if (nu2 <= state->nu)
+        {
+          /*
+           * nu has wrapped around / overflown, reset mu and nu
+           * to original values and return to force another iteration
+           */
+          gsl_vector_set_zero(dx);
+          status = lmlsqr_init_mu(state, fdf, J, x, g);
+          if (status)
+            return status;
+
+          return GSL_ENOPROG;
+        }
+      state->nu = nu2;
+    }
+} /* lmlsqr_iterate() */
+
+static const gsl_multifit_largesolver_type lmlsqr_type =
+{
+  "lmlsqr",
+  sizeof(lmlsqr_state_t),
+  &lmlsqr_alloc,
+  &lmlsqr_set,
+  &lmlsqr_iterate,
+  &lmlsqr_free
+};
+
+const gsl_multifit_largesolver_type *gsl_multifit_largesolver_lmlsqr = &lmlsqr_type;
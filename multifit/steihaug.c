@@ -0,0 +1,380 @@
+/* multifit/steihaug.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_multifit_nlin.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+
+/*
+ * This module contains a trust region Gauss-Newton method for large
+ * nonlinear least squares problems. The trust region subproblem
+ *
+ *   min_dx g^T dx + 1/2 ||J dx||^2,  ||dx|| <= delta
+ *
+ * is solved approximately with the truncated conjugate gradient
+ * method of Steihaug, which only requires products with J and J^T,
+ * so the Jacobian may be sparse or given implicitly.
+ *
+ * [1] T. Steihaug, The conjugate gradient method and trust regions
+ *     in large scale optimization, SIAM J. Numer. Anal. 20 (1983)
+ *     626-637.
+ *
+ * [2] J. Nocedal, S. J. Wright, Numerical Optimization, 2nd ed.,
+ *     Springer, 2006, algorithm 7.2.
+ */
+
+typedef struct
+{
+  gsl_vector *x_trial;       /* trial parameter vector */
+  gsl_vector *f_trial;       /* trial function vector */
+  gsl_vector *r;             /* CG residual, length p */
+  gsl_vector *d;             /* CG search direction, length p */
+  gsl_vector *Bd;            /* J^T J d, length p */
+  gsl_vector *Jd;            /* J d, length n */
+  double delta;              /* trust region radius */
+} steihaug_state_t;
+
+#define LARGEUTIL_INEXACT
+#include "largeutil.c"
+
+#define STEIHAUG_FACTOR      (100.0)
+
+static int steihaug_alloc (void *vstate, const size_t n, const size_t p);
+static void steihaug_free(void *vstate);
+static int steihaug_set(void *vstate, gsl_multifit_function_large *fdf,
+                        gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                        gsl_vector *g);
+static int steihaug_iterate(void *vstate, gsl_multifit_function_large *fdf,
+                            gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                            gsl_vector *g, gsl_vector *dx);
+
+static int
+steihaug_alloc (void *vstate, const size_t n, const size_t p)
+{
+  steihaug_state_t *state = (steihaug_state_t *) vstate;
+
+  state->x_trial = gsl_vector_alloc(p);
+  if (state->x_trial == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for x_trial", GSL_ENOMEM);
+    }
+
+  state->f_trial = gsl_vector_alloc(n);
+  if (state->f_trial == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for f_trial", GSL_ENOMEM);
+    }
+
+  state->r = gsl_vector_alloc(p);
+  if (state->r == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for r", GSL_ENOMEM);
+    }
+
+  state->d = gsl_vector_alloc(p);
+  if (state->d == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for d", GSL_ENOMEM);
+    }
+
+  state->Bd = gsl_vector_alloc(p);
+  if (state->Bd == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for Bd", GSL_ENOMEM);
+    }
+
+  state->Jd = gsl_vector_alloc(n);
+  if (state->Jd == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for Jd", GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+} /* steihaug_alloc() */
+
+static void
+steihaug_free(void *vstate)
+{
+  steihaug_state_t *state = (steihaug_state_t *) vstate;
+
+  if (state->x_trial)
+    gsl_vector_free(state->x_trial);
+
+  if (state->f_trial)
+    gsl_vector_free(state->f_trial);
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->d)
+    gsl_vector_free(state->d);
+
+  if (state->Bd)
+    gsl_vector_free(state->Bd);
+
+  if (state->Jd)
+    gsl_vector_free(state->Jd);
+} /* steihaug_free() */
+
+static int
+steihaug_set(void *vstate, gsl_multifit_function_large *fdf,
+             gsl_spmatrix *J, gsl_vector *x, gsl_vector *f, gsl_vector *g)
+{
+  int status;
+  steihaug_state_t *state = (steihaug_state_t *) vstate;
+  double xnorm;
+
+  if (fdf->df == NULL && fdf->dfv == NULL)
+    {
+      GSL_ERROR ("steihaug solver requires df or dfv", GSL_EINVAL);
+    }
+
+  /* initialize counters for function and Jacobian evaluations */
+  fdf->nevalf = 0;
+  fdf->nevaldf = 0;
+
+  status = large_eval_f(fdf, x, f);
+  if (status)
+    return status;
+
+  status = large_eval_jg(fdf, x, f, J, g);
+  if (status)
+    return status;
+
+  /* initial radius as in MINPACK, delta = factor * ||x|| */
+  xnorm = gsl_blas_dnrm2(x);
+  state->delta = STEIHAUG_FACTOR * (xnorm > 0.0 ? xnorm : 1.0);
+
+  return GSL_SUCCESS;
+} /* steihaug_set() */
+
+/* return tau >= 0 such that ||s + tau d|| = delta */
+static double
+steihaug_boundary(const gsl_vector *s, const gsl_vector *d,
+                  const double delta)
+{
+  double ss, sd, dd, disc;
+
+  gsl_blas_ddot(s, s, &ss);
+  gsl_blas_ddot(s, d, &sd);
+  gsl_blas_ddot(d, d, &dd);
+
+  disc = sd * sd + dd * (delta * delta - ss);
+
+  return (-sd + sqrt(GSL_MAX(disc, 0.0))) / dd;
+}
+
+/*
+steihaug_cg()
+  Approximately solve the trust region subproblem with CG on the
+normal equations J^T J s = -g, stopping on the boundary of the trust
+region or along a direction of zero curvature
+
+Inputs: s        - (output) step
+        boundary - (output) 1 if s lies on the boundary
+*/
+static int
+steihaug_cg(steihaug_state_t *state, gsl_multifit_function_large *fdf,
+            const gsl_spmatrix *J, const gsl_vector *x,
+            const gsl_vector *g, gsl_vector *s, int *boundary)
+{
+  int status;
+  const size_t p = x->size;
+  gsl_vector *r = state->r;
+  gsl_vector *d = state->d;
+  gsl_vector *Bd = state->Bd;
+  gsl_vector *Jd = state->Jd;
+  const double delta = state->delta;
+  double gnorm = gsl_blas_dnrm2(g);
+  double tol = large_forcing(gnorm) * gnorm;
+  double rr;
+  size_t k;
+
+  *boundary = 0;
+
+  gsl_vector_set_zero(s);
+
+  /* r = -g, d = r */
+  gsl_vector_memcpy(r, g);
+  gsl_vector_scale(r, -1.0);
+  gsl_vector_memcpy(d, r);
+  gsl_blas_ddot(r, r, &rr);
+
+  if (gnorm == 0.0)
+    return GSL_SUCCESS;
+
+  for (k = 0; k < p; ++k)
+    {
+      double dBd, alpha, snorm, rr_new;
+
+      /* Bd = J^T J d */
+      status = large_jac_mult(CblasNoTrans, fdf, J, x, d, Jd);
+      if (status)
+        return status;
+
+      status = large_jac_mult(CblasTrans, fdf, J, x, Jd, Bd);
+      if (status)
+        return status;
+
+      dBd = gsl_blas_dnrm2(Jd);
+      dBd *= dBd;
+
+      if (dBd <= 0.0)
+        {
+          /* J d = 0, move to the boundary along d */
+          double tau = steihaug_boundary(s, d, delta);
+          gsl_blas_daxpy(tau, d, s);
+          *boundary = 1;
+          break;
+        }
+
+      alpha = rr / dBd;
+
+      /* s <- s + alpha d, unless this leaves the trust region */
+      gsl_blas_daxpy(alpha, d, s);
+      snorm = gsl_blas_dnrm2(s);
+
+      if (snorm >= delta)
+        {
+          double tau;
+
+          gsl_blas_daxpy(-alpha, d, s);
+          tau = steihaug_boundary(s, d, delta);
+          gsl_blas_daxpy(tau, d, s);
+          *boundary = 1;
+          break;
+        }
+
+      /* r <- r - alpha J^T J d */
+      gsl_blas_daxpy(-alpha, Bd, r);
+      gsl_blas_ddot(r, r, &rr_new);
+
+      if (sqrt(rr_new) <= tol)
+        break;
+
+      /* d <- r + beta d */
+      gsl_vector_scale(d, rr_new / rr);
+      gsl_vector_add(d, r);
+      rr = rr_new;
+    }
+
+  return GSL_SUCCESS;
+} /* steihaug_cg() */
+
+/*
+steihaug_iterate()
+  Compute a truncated CG step in the current trust region and
+shrink the region until the step reduces ||f||
+
+Args: vstate - steihaug workspace
+      fdf    - function and Jacobian pointers
+      J      - on input, sparse J(x) (NULL in matrix-free mode)
+               on output, J(x + dx)
+      x      - on input, current parameter vector
+               on output, new parameter vector x + dx
+      f      - on input, f(x)
+               on output, f(x + dx)
+      g      - on input, J(x)^T f(x)
+               on output, J(x + dx)^T f(x + dx)
+      dx     - (output only) parameter step vector
+*/
+
+static int
+steihaug_iterate(void *vstate, gsl_multifit_function_large *fdf,
+                 gsl_spmatrix *J, gsl_vector *x, gsl_vector *f,
+                 gsl_vector *g, gsl_vector *dx)
+{
+  int status;
+  steihaug_state_t *state = (steihaug_state_t *) vstate;
+  gsl_vector *x_trial = state->x_trial;       /* trial x + dx */
+  gsl_vector *f_trial = state->f_trial;       /* trial f(x + dx) */
+  double xnorm = gsl_blas_dnrm2(x);
+
+  while (1)
+    {
+      int boundary;
+      double dF;                              /* F(x) - F(x + dx) */
+      double dL;                              /* m(0) - m(dx) */
+      double rho;
+
+      status = steihaug_cg(state, fdf, J, x, g, dx, &boundary);
+      if (status)
+        return status;
+
+      status = large_model_reduction(fdf, J, x, g, dx, state->Jd, &dL);
+      if (status)
+        return status;
+
+      if (dL <= 0.0)
+        {
+          /* no decrease is possible in the model, x is stationary */
+          gsl_vector_set_zero(dx);
+          return GSL_ENOPROG;
+        }
+
+      large_trial_step(x, dx, x_trial);
+
+      status = large_eval_f(fdf, x_trial, f_trial);
+      if (status)
+        return status;
+
+      dF = large_calc_dF(f, f_trial);
+      rho = dF / dL;
+
+      /* update the trust region radius */
+      if (rho < 0.25)
+        state->delta = 0.25 * gsl_blas_dnrm2(dx);
+      else if (rho > 0.75 && boundary)
+        state->delta *= 2.0;
+
+      if (rho > 1.0e-4)
+        {
+          /* sufficient reduction, accept step */
+          gsl_vector_memcpy(x, x_trial);
+          gsl_vector_memcpy(f, f_trial);
+
+          return large_eval_jg(fdf, x, f, J, g);
+        }
+
+      if (state->delta <= GSL_DBL_EPSILON * GSL_MAX(xnorm, 1.0))
+        {
+          /* trust region has collapsed, reset for the next call */
+          state->delta = STEIHAUG_FACTOR * (xnorm > 0.0 ? xnorm : 1.0);
+          gsl_vector_set_zero(dx);
+          return GSL_ENOPROG;
+        }
+    }
+} /* steihaug_iterate() */
+
+static const gsl_multifit_largesolver_type steihaug_type =
+{
+  "steihaug",
+  sizeof(steihaug_state_t),
+  &steihaug_alloc,
+  &steihaug_set,
+  &steihaug_iterate,
+  &steihaug_free
+};
+
+const gsl_multifit_largesolver_type *gsl_multifit_largesolver_steihaug = &steihaug_type;
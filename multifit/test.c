@@ -31,11 +31,14 @@
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
 
 #include <gsl/gsl_ieee_utils.h>
 
 #include "test_linear.c"
 #include "test_nonlinear.c"
+#include "test_large.c"
 
 int
 main (void)
@@ -48,5 +51,8 @@ main (void)
   /* test nonlinear regression */
   test_nonlinear();
 
+  /* test sparse and matrix-free nonlinear least squares */
+  test_large();
+
   exit (gsl_test_summary ());
 }
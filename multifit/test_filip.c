@@ -128,6 +128,33 @@ test_filip ()
                      &diag.vector, &exp_sd.vector,
                      chisq, chisq_res, expected_chisq);
 
+  /* test streaming least squares, one row at a time */
+  {
+    gsl_multifit_linear_tsqr_workspace * wt =
+      gsl_multifit_linear_tsqr_alloc (filip_p);
+    size_t rank;
+
+    for (i = 0; i < filip_n; i++)
+      {
+        gsl_matrix_view Xi = gsl_matrix_submatrix (X, i, 0, 1, filip_p);
+        gsl_vector_view yi = gsl_vector_subvector (&y.vector, i, 1);
+
+        gsl_multifit_linear_tsqr_accumulate (&Xi.matrix, &yi.vector, wt);
+      }
+
+    gsl_multifit_linear_tsqr_solve (GSL_DBL_EPSILON, &rank, c, cov,
+                                    &chisq, wt);
+    gsl_multifit_linear_residuals(X, &y.vector, c, r);
+    gsl_blas_ddot(r, r, &chisq_res);
+
+    test_filip_results("filip gsl_multifit_linear_tsqr",
+                       c, &exp_c.vector,
+                       &diag.vector, &exp_sd.vector,
+                       chisq, chisq_res, expected_chisq);
+
+    gsl_multifit_linear_tsqr_free (wt);
+  }
+
   /* test robust least squares */
   gsl_multifit_robust (X, &y.vector, c, cov, work_rob);
 
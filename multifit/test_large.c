@@ -0,0 +1,453 @@
+/* multifit/test_large.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* tests for the sparse / matrix-free large scale solvers */
+
+/* wrap a dense test problem as a gsl_multifit_function_large */
+typedef struct
+{
+  gsl_multifit_function_fdf *fdf;
+  gsl_matrix *J;
+} large_wrap_params;
+
+static int
+large_wrap_f (const gsl_vector * x, void *params, gsl_vector * f)
+{
+  large_wrap_params *w = (large_wrap_params *) params;
+  return w->fdf->f(x, w->fdf->params, f);
+}
+
+static int
+large_wrap_df (const gsl_vector * x, void *params, gsl_spmatrix * J)
+{
+  large_wrap_params *w = (large_wrap_params *) params;
+  int status = w->fdf->df(x, w->fdf->params, w->J);
+
+  if (status)
+    return status;
+
+  return gsl_spmatrix_d2sp(J, w->J);
+}
+
+static int
+large_wrap_dfv (CBLAS_TRANSPOSE_t TransJ, const gsl_vector * x,
+                const gsl_vector * u, void *params, gsl_vector * v)
+{
+  large_wrap_params *w = (large_wrap_params *) params;
+  int status = w->fdf->df(x, w->fdf->params, w->J);
+
+  if (status)
+    return status;
+
+  return gsl_blas_dgemv(TransJ, 1.0, w->J, u, 0.0, v);
+}
+
+static int
+large_wrap_jtj (const gsl_vector * x, const gsl_vector * f, void *params,
+                gsl_matrix * JTJ, gsl_vector * JTf)
+{
+  large_wrap_params *w = (large_wrap_params *) params;
+  int status = w->fdf->df(x, w->fdf->params, w->J);
+
+  if (status)
+    return status;
+
+  gsl_blas_dsyrk(CblasLower, CblasTrans, 1.0, w->J, 0.0, JTJ);
+
+  return gsl_blas_dgemv(CblasTrans, 1.0, w->J, f, 0.0, JTf);
+}
+
+/* Jacobian modes of the test problems */
+#define LARGE_SPARSE         0
+#define LARGE_DFV            1
+#define LARGE_JTJ            2
+
+static void
+test_large_problem(const gsl_multifit_largesolver_type * T,
+                   const int mode, const double epsrel,
+                   test_fdf_problem *problem)
+{
+  gsl_multifit_function_fdf *fdf = problem->fdf;
+  const size_t n = fdf->n;
+  const size_t p = fdf->p;
+  const double xtol = pow(GSL_DBL_EPSILON, 0.9);
+  const double gtol = pow(GSL_DBL_EPSILON, 0.9);
+  const double ftol = 0.0;
+  gsl_vector_view x0 = gsl_vector_view_array(problem->x0, p);
+  gsl_multifit_largesolver *s = gsl_multifit_largesolver_alloc (T, n, p);
+  large_wrap_params params;
+  gsl_multifit_function_large f;
+  const char *pname = problem->name;
+  char sname[2048];
+  double sumsq;
+  int status, info;
+
+  params.fdf = fdf;
+  params.J = gsl_matrix_alloc(n, p);
+
+  f.f = &large_wrap_f;
+  f.df = (mode == LARGE_SPARSE) ? &large_wrap_df : NULL;
+  f.dfv = (mode == LARGE_JTJ) ? NULL : &large_wrap_dfv;
+  f.jtj = (mode == LARGE_JTJ) ? &large_wrap_jtj : NULL;
+  f.n = n;
+  f.p = p;
+  f.params = &params;
+
+  sprintf(sname, "%s%s", gsl_multifit_largesolver_name(s),
+          (mode == LARGE_SPARSE) ? "/sparse" :
+          (mode == LARGE_DFV) ? "/dfv" : "/jtj");
+
+  gsl_multifit_largesolver_set(s, &f, &x0.vector);
+
+  status = gsl_multifit_largesolver_driver(s, 1500, xtol, gtol, ftol, &info);
+  gsl_test(status, "%s/%s did not converge, status=%s",
+           sname, pname, gsl_strerror(status));
+
+  gsl_test((mode == LARGE_SPARSE) != (s->J != NULL),
+           "%s/%s Jacobian storage", sname, pname);
+
+  gsl_blas_ddot(s->f, s->f, &sumsq);
+  (problem->checksol)(s->x->data, sumsq, epsrel, sname, pname);
+
+  gsl_multifit_largesolver_free(s);
+  gsl_matrix_free(params.J);
+}
+
+/*
+ * Extended Rosenbrock function with p variables, which has a
+ * Jacobian with 3 nonzero elements per pair of rows
+ *
+ * f_{2i}   = 10 (x_{2i+1} - x_{2i}^2)
+ * f_{2i+1} = 1 - x_{2i}
+ */
+
+#define xrosen_P             2000
+
+static int
+xrosen_f (const gsl_vector * x, void *params, gsl_vector * f)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; i += 2)
+    {
+      double x1 = gsl_vector_get(x, i);
+      double x2 = gsl_vector_get(x, i + 1);
+
+      gsl_vector_set(f, i, 10.0 * (x2 - x1*x1));
+      gsl_vector_set(f, i + 1, 1.0 - x1);
+    }
+
+  (void)params; /* avoid unused parameter warning */
+
+  return GSL_SUCCESS;
+}
+
+static int
+xrosen_df (const gsl_vector * x, void *params, gsl_spmatrix * J)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; i += 2)
+    {
+      double x1 = gsl_vector_get(x, i);
+
+      gsl_spmatrix_set(J, i, i, -20.0*x1);
+      gsl_spmatrix_set(J, i, i + 1, 10.0);
+      gsl_spmatrix_set(J, i + 1, i, -1.0);
+    }
+
+  (void)params; /* avoid unused parameter warning */
+
+  return GSL_SUCCESS;
+}
+
+static int
+xrosen_dfv (CBLAS_TRANSPOSE_t TransJ, const gsl_vector * x,
+            const gsl_vector * u, void *params, gsl_vector * v)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; i += 2)
+    {
+      double x1 = gsl_vector_get(x, i);
+      double u1 = gsl_vector_get(u, i);
+      double u2 = gsl_vector_get(u, i + 1);
+
+      if (TransJ == CblasNoTrans)
+        {
+          gsl_vector_set(v, i, -20.0*x1*u1 + 10.0*u2);
+          gsl_vector_set(v, i + 1, -u1);
+        }
+      else
+        {
+          gsl_vector_set(v, i, -20.0*x1*u1 - u2);
+          gsl_vector_set(v, i + 1, 10.0*u1);
+        }
+    }
+
+  (void)params; /* avoid unused parameter warning */
+
+  return GSL_SUCCESS;
+}
+
+static void
+test_large_xrosen(const gsl_multifit_largesolver_type * T,
+                  const int matrix_free)
+{
+  const size_t p = xrosen_P;
+  const double tol = pow(GSL_DBL_EPSILON, 0.9);
+  gsl_multifit_largesolver *s = gsl_multifit_largesolver_alloc (T, p, p);
+  gsl_multifit_function_large f;
+  gsl_vector *x0 = gsl_vector_alloc(p);
+  char sname[2048];
+  size_t i;
+  int status, info;
+
+  f.f = &xrosen_f;
+  f.df = matrix_free ? NULL : &xrosen_df;
+  f.dfv = &xrosen_dfv;
+  f.jtj = NULL;
+  f.n = p;
+  f.p = p;
+  f.params = NULL;
+
+  sprintf(sname, "%s%s", gsl_multifit_largesolver_name(s),
+          matrix_free ? "/dfv" : "/sparse");
+
+  for (i = 0; i < p; i += 2)
+    {
+      gsl_vector_set(x0, i, -1.2);
+      gsl_vector_set(x0, i + 1, 1.0);
+    }
+
+  gsl_multifit_largesolver_set(s, &f, x0);
+
+  status = gsl_multifit_largesolver_driver(s, 1500, tol, tol, 0.0, &info);
+  gsl_test(status, "%s/xrosen did not converge, status=%s",
+           sname, gsl_strerror(status));
+
+  for (i = 0; i < p; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(s->x, i), 1.0, 1.0e-8,
+                   "%s/xrosen i=%zu", sname, i);
+    }
+
+  if (!matrix_free)
+    {
+      /* storage is proportional to the 3p/2 nonzero elements of J */
+      gsl_test_int(gsl_spmatrix_nnz(s->J), 3 * p / 2,
+                   "%s/xrosen nnz", sname);
+      gsl_test(s->J->nzmax > 2 * p, "%s/xrosen nzmax=%zu",
+               sname, s->J->nzmax);
+    }
+
+  gsl_multifit_largesolver_free(s);
+  gsl_vector_free(x0);
+}
+
+/*
+ * Exponential model with a large number of residuals,
+ *
+ * f_i = A exp(-lambda t_i) + b - y_i,  t_i = i / n
+ *
+ * J^T J and J^T f are accumulated over blocks of rows in the jtj
+ * function, so that J is never stored
+ */
+
+#define tall_N               100000
+#define tall_P               3
+#define tall_BLOCK           256
+
+static double tall_x[tall_P] = { 5.0, 1.5, 1.0 }; /* A, lambda, b */
+
+static int
+tall_f (const gsl_vector * x, void *params, gsl_vector * f)
+{
+  const size_t n = f->size;
+  double A = gsl_vector_get(x, 0);
+  double lambda = gsl_vector_get(x, 1);
+  double b = gsl_vector_get(x, 2);
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      double t = (double) i / (double) n;
+      double yi = tall_x[0] * exp(-tall_x[1] * t) + tall_x[2];
+
+      gsl_vector_set(f, i, A * exp(-lambda * t) + b - yi);
+    }
+
+  (void)params; /* avoid unused parameter warning */
+
+  return GSL_SUCCESS;
+}
+
+static int
+tall_jtj (const gsl_vector * x, const gsl_vector * f, void *params,
+          gsl_matrix * JTJ, gsl_vector * JTf)
+{
+  const size_t n = f->size;
+  gsl_matrix *J = (gsl_matrix *) params;  /* tall_BLOCK-by-p row block */
+  double A = gsl_vector_get(x, 0);
+  double lambda = gsl_vector_get(x, 1);
+  size_t i0;
+
+  for (i0 = 0; i0 < n; i0 += tall_BLOCK)
+    {
+      size_t nb = GSL_MIN(tall_BLOCK, n - i0);
+      gsl_matrix_view Jb = gsl_matrix_submatrix(J, 0, 0, nb, tall_P);
+      gsl_vector_const_view fb = gsl_vector_const_subvector(f, i0, nb);
+      size_t i;
+
+      for (i = 0; i < nb; ++i)
+        {
+          double t = (double) (i0 + i) / (double) n;
+          double e = exp(-lambda * t);
+
+          gsl_matrix_set(&Jb.matrix, i, 0, e);
+          gsl_matrix_set(&Jb.matrix, i, 1, -t * A * e);
+          gsl_matrix_set(&Jb.matrix, i, 2, 1.0);
+        }
+
+      gsl_blas_dsyrk(CblasLower, CblasTrans, 1.0, &Jb.matrix, 1.0, JTJ);
+      gsl_blas_dgemv(CblasTrans, 1.0, &Jb.matrix, &fb.vector, 1.0, JTf);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+test_large_tall(void)
+{
+  const double tol = pow(GSL_DBL_EPSILON, 0.9);
+  gsl_multifit_largesolver *s =
+    gsl_multifit_largesolver_alloc (gsl_multifit_largesolver_lmchol,
+                                    tall_N, tall_P);
+  gsl_matrix *J = gsl_matrix_alloc(tall_BLOCK, tall_P);
+  gsl_multifit_function_large f;
+  double x0[tall_P] = { 1.0, 0.0, 0.0 };
+  gsl_vector_view x0v = gsl_vector_view_array(x0, tall_P);
+  size_t i;
+  int status, info;
+
+  f.f = &tall_f;
+  f.df = NULL;
+  f.dfv = NULL;
+  f.jtj = &tall_jtj;
+  f.n = tall_N;
+  f.p = tall_P;
+  f.params = J;
+
+  gsl_multifit_largesolver_set(s, &f, &x0v.vector);
+
+  status = gsl_multifit_largesolver_driver(s, 100, tol, tol, 0.0, &info);
+  gsl_test(status, "lmchol/jtj/tall did not converge, status=%s",
+           gsl_strerror(status));
+
+  for (i = 0; i < tall_P; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(s->x, i), tall_x[i], 1.0e-10,
+                   "lmchol/jtj/tall i=%zu", i);
+    }
+
+  /* each accepted step costs a single pass over the rows */
+  gsl_test(f.nevaldf != gsl_multifit_largesolver_niter(s) + 1,
+           "lmchol/jtj/tall nevaldf=%zu niter=%zu", f.nevaldf,
+           gsl_multifit_largesolver_niter(s));
+
+  gsl_multifit_largesolver_free(s);
+  gsl_matrix_free(J);
+}
+
+static test_fdf_problem *test_fdf_large[] = {
+  &lin1_problem,
+  &rosenbrock_problem,
+  &helical_problem,
+  &wood_problem,
+  &beale_problem,
+  &box_problem,
+
+  NULL
+};
+
+static void
+test_large(void)
+{
+  const gsl_multifit_largesolver_type *types[3];
+  size_t i, j;
+
+  types[0] = gsl_multifit_largesolver_steihaug;
+  types[1] = gsl_multifit_largesolver_lmlsqr;
+  types[2] = NULL;
+
+  for (j = 0; types[j] != NULL; ++j)
+    {
+      for (i = 0; test_fdf_large[i] != NULL; ++i)
+        {
+          test_fdf_problem *problem = test_fdf_large[i];
+          double epsrel = 1.0e3 * *(problem->epsrel);
+
+          test_large_problem(types[j], LARGE_SPARSE, epsrel, problem);
+          test_large_problem(types[j], LARGE_DFV, epsrel, problem);
+        }
+
+      test_large_xrosen(types[j], 0);
+      test_large_xrosen(types[j], 1);
+    }
+
+  for (i = 0; test_fdf_large[i] != NULL; ++i)
+    {
+      test_fdf_problem *problem = test_fdf_large[i];
+      double epsrel = 1.0e3 * *(problem->epsrel);
+
+      test_large_problem(gsl_multifit_largesolver_lmchol, LARGE_SPARSE,
+                         epsrel, problem);
+      test_large_problem(gsl_multifit_largesolver_lmchol, LARGE_DFV,
+                         epsrel, problem);
+      test_large_problem(gsl_multifit_largesolver_lmchol, LARGE_JTJ,
+                         epsrel, problem);
+    }
+
+  test_large_tall();
+
+  /* a function without any Jacobian information is rejected */
+  {
+    gsl_multifit_largesolver *s =
+      gsl_multifit_largesolver_alloc (gsl_multifit_largesolver_lmlsqr, 2, 2);
+    gsl_multifit_function_large f;
+    gsl_vector *x0 = gsl_vector_calloc(2);
+    int status;
+
+    f.f = &xrosen_f;
+    f.df = NULL;
+    f.dfv = NULL;
+    f.jtj = NULL;
+    f.n = 2;
+    f.p = 2;
+    f.params = NULL;
+
+    gsl_set_error_handler_off();
+    status = gsl_multifit_largesolver_set(s, &f, x0);
+    gsl_test_int(status, GSL_EINVAL, "largesolver no Jacobian");
+    gsl_set_error_handler(NULL);
+
+    gsl_multifit_largesolver_free(s);
+    gsl_vector_free(x0);
+  }
+}
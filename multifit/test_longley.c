@@ -111,6 +111,45 @@ test_longley ()
                        &diag.vector, &exp_sd.vector,
                        1.0, 1.0, 1.0);
 
+  /* test streaming least squares, accumulating the rows in blocks
+   * of 5 split across two workspaces which are then merged */
+  {
+    gsl_multifit_linear_tsqr_workspace * w1 =
+      gsl_multifit_linear_tsqr_alloc (longley_p);
+    gsl_multifit_linear_tsqr_workspace * w2 =
+      gsl_multifit_linear_tsqr_alloc (longley_p);
+    const size_t nblock = 5;
+    size_t i, rank;
+
+    for (i = 0; i < longley_n; i += nblock)
+      {
+        size_t nrows = GSL_MIN (nblock, longley_n - i);
+        gsl_matrix_view Xb = gsl_matrix_submatrix (&X.matrix, i, 0,
+                                                   nrows, longley_p);
+        gsl_vector_view yb = gsl_vector_subvector (&y.vector, i, nrows);
+
+        gsl_multifit_linear_tsqr_accumulate (&Xb.matrix, &yb.vector,
+                                             (i < longley_n / 2) ? w1 : w2);
+      }
+
+    gsl_multifit_linear_tsqr_merge (w2, w1);
+    gsl_multifit_linear_tsqr_solve (GSL_DBL_EPSILON, &rank, c, cov,
+                                    &chisq, w1);
+    gsl_multifit_linear_residuals(&X.matrix, &y.vector, c, r);
+    gsl_blas_ddot(r, r, &chisq_res);
+
+    gsl_test_int (w1->n, longley_n, "longley gsl_multifit_linear_tsqr n");
+    gsl_test_int (rank, longley_p, "longley gsl_multifit_linear_tsqr rank");
+
+    test_longley_results("longley gsl_multifit_linear_tsqr",
+                         c, &exp_c.vector,
+                         &diag.vector, &exp_sd.vector,
+                         chisq, chisq_res, expected_chisq);
+
+    gsl_multifit_linear_tsqr_free (w1);
+    gsl_multifit_linear_tsqr_free (w2);
+  }
+
   /* test weighted least squares */
   {
     size_t i, j;
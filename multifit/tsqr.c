@@ -0,0 +1,363 @@
+/* multifit/tsqr.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_multifit.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+
+/*
+ * Streaming linear least squares
+ *
+ * The rows of the augmented matrix [X y] are folded into the
+ * (p+1)-by-(p+1) upper triangular factor
+ *
+ *   T = [ R  z   ]
+ *       [ 0  rho ]
+ *
+ * of its QR decomposition with Givens rotations, one row at a time,
+ * so that only O(p^2) memory is needed regardless of the number of
+ * observations. The least squares problem min ||y - X c|| is then
+ * equivalent to min ||z - R c|| with residual rho^2 added to chi^2,
+ * and is solved with the same balanced SVD as gsl_multifit_linear().
+ * Factors of disjoint sets of rows can be merged by folding the rows
+ * of one factor into the other.
+ */
+
+gsl_multifit_linear_tsqr_workspace *
+gsl_multifit_linear_tsqr_alloc (size_t p)
+{
+  gsl_multifit_linear_tsqr_workspace *w;
+
+  if (p == 0)
+    {
+      GSL_ERROR_VAL ("number of parameters must be positive", GSL_EINVAL, 0);
+    }
+
+  w = calloc (1, sizeof (gsl_multifit_linear_tsqr_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for tsqr struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  w->p = p;
+  w->n = 0;
+
+  w->T = gsl_matrix_calloc (p + 1, p + 1);
+
+  if (w->T == 0)
+    {
+      gsl_multifit_linear_tsqr_free (w);
+      GSL_ERROR_VAL ("failed to allocate space for T", GSL_ENOMEM, 0);
+    }
+
+  w->row = gsl_vector_alloc (p + 1);
+
+  if (w->row == 0)
+    {
+      gsl_multifit_linear_tsqr_free (w);
+      GSL_ERROR_VAL ("failed to allocate space for row", GSL_ENOMEM, 0);
+    }
+
+  w->multifit_p = gsl_multifit_linear_alloc (p, p);
+
+  if (w->multifit_p == 0)
+    {
+      gsl_multifit_linear_tsqr_free (w);
+      GSL_ERROR_VAL ("failed to allocate space for multifit workspace",
+                     GSL_ENOMEM, 0);
+    }
+
+  return w;
+}
+
+void
+gsl_multifit_linear_tsqr_free (gsl_multifit_linear_tsqr_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->T)
+    gsl_matrix_free (w->T);
+
+  if (w->row)
+    gsl_vector_free (w->row);
+
+  if (w->multifit_p)
+    gsl_multifit_linear_free (w->multifit_p);
+
+  free (w);
+}
+
+int
+gsl_multifit_linear_tsqr_reset (gsl_multifit_linear_tsqr_workspace * w)
+{
+  gsl_matrix_set_zero (w->T);
+  w->n = 0;
+
+  return GSL_SUCCESS;
+}
+
+/* fold the row v of length p+1 into the triangular factor T */
+static void
+tsqr_fold_row (gsl_matrix * T, gsl_vector * v)
+{
+  const size_t m = T->size1;
+  size_t j, k;
+
+  for (k = 0; k < m; ++k)
+    {
+      double vk = gsl_vector_get (v, k);
+      double c, s;
+
+      if (vk == 0.0)
+        continue;
+
+      gsl_linalg_givens (gsl_matrix_get (T, k, k), vk, &c, &s);
+
+      for (j = k; j < m; ++j)
+        {
+          double tkj = gsl_matrix_get (T, k, j);
+          double vj = gsl_vector_get (v, j);
+
+          gsl_matrix_set (T, k, j, c * tkj - s * vj);
+          gsl_vector_set (v, j, s * tkj + c * vj);
+        }
+    }
+}
+
+int
+gsl_multifit_linear_tsqr_accumulate (const gsl_matrix * X,
+                                     const gsl_vector * y,
+                                     gsl_multifit_linear_tsqr_workspace * w)
+{
+  const size_t p = w->p;
+
+  if (X->size2 != p)
+    {
+      GSL_ERROR ("columns of matrix X do not match workspace", GSL_EBADLEN);
+    }
+  else if (X->size1 != y->size)
+    {
+      GSL_ERROR
+        ("number of observations in y does not match rows of matrix X",
+         GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_vector_view vx = gsl_vector_subvector (w->row, 0, p);
+      size_t i;
+
+      for (i = 0; i < X->size1; ++i)
+        {
+          gsl_vector_const_view xi = gsl_matrix_const_row (X, i);
+
+          gsl_vector_memcpy (&vx.vector, &xi.vector);
+          gsl_vector_set (w->row, p, gsl_vector_get (y, i));
+
+          tsqr_fold_row (w->T, w->row);
+        }
+
+      w->n += X->size1;
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_multifit_linear_tsqr_merge (const gsl_multifit_linear_tsqr_workspace * src,
+                                gsl_multifit_linear_tsqr_workspace * dest)
+{
+  if (src->p != dest->p)
+    {
+      GSL_ERROR ("workspaces have different number of parameters",
+                 GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i <= src->p; ++i)
+        {
+          gsl_vector_const_view ti = gsl_matrix_const_row (src->T, i);
+
+          gsl_vector_memcpy (dest->row, &ti.vector);
+          tsqr_fold_row (dest->T, dest->row);
+        }
+
+      dest->n += src->n;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_multifit_linear_tsqr_solve()
+  Compute the least squares solution from the accumulated factor,
+following the steps of multifit_linear_svd() in multilinear.c with X
+replaced by R and y by z
+
+Inputs: tol   - singular value tolerance, as for gsl_multifit_linear_svd
+        rank  - (output) effective rank
+        c     - (output) model coefficient vector
+        cov   - (output) covariance matrix
+        chisq - (output) residual chi^2
+        w     - workspace
+*/
+
+int
+gsl_multifit_linear_tsqr_solve (const double tol, size_t * rank,
+                                gsl_vector * c, gsl_matrix * cov,
+                                double *chisq,
+                                gsl_multifit_linear_tsqr_workspace * w)
+{
+  const size_t p = w->p;
+
+  if (c->size != p)
+    {
+      GSL_ERROR ("number of parameters c does not match workspace",
+                 GSL_EBADLEN);
+    }
+  else if (cov->size1 != cov->size2)
+    {
+      GSL_ERROR ("covariance matrix is not square", GSL_ENOTSQR);
+    }
+  else if (c->size != cov->size1)
+    {
+      GSL_ERROR
+        ("number of parameters does not match size of covariance matrix",
+         GSL_EBADLEN);
+    }
+  else if (w->n < p)
+    {
+      GSL_ERROR ("insufficient data points, n < p", GSL_EINVAL);
+    }
+  else if (tol <= 0)
+    {
+      GSL_ERROR ("tolerance must be positive", GSL_EINVAL);
+    }
+  else
+    {
+      gsl_multifit_linear_workspace *work = w->multifit_p;
+      gsl_matrix *A = work->A;
+      gsl_matrix *Q = work->Q;
+      gsl_matrix *QSI = work->QSI;
+      gsl_vector *S = work->S;
+      gsl_vector *xt = work->xt;
+      gsl_vector *D = work->D;
+      gsl_matrix_const_view R = gsl_matrix_const_submatrix (w->T, 0, 0, p, p);
+      gsl_vector_const_view z = gsl_matrix_const_subcolumn (w->T, p, 0, p);
+      const double rho = gsl_matrix_get (w->T, p, p);
+      size_t i, j, p_eff;
+
+      /* A <= R, which is balanced and decomposed as X would be */
+
+      gsl_matrix_memcpy (A, &R.matrix);
+
+      gsl_linalg_balance_columns (A, D);
+
+      gsl_linalg_SV_decomp_mod (A, QSI, Q, S, xt);
+
+      /* compute xt = U^T z */
+      gsl_blas_dgemv (CblasTrans, 1.0, A, &z.vector, 0.0, xt);
+
+      /* QSI = Q S^{-1}, with small singular values truncated */
+      gsl_matrix_memcpy (QSI, Q);
+
+      {
+        double s0 = gsl_vector_get (S, 0);
+        p_eff = 0;
+
+        for (j = 0; j < p; j++)
+          {
+            gsl_vector_view column = gsl_matrix_column (QSI, j);
+            double sj = gsl_vector_get (S, j);
+            double alpha;
+
+            if (sj <= tol * s0)
+              {
+                alpha = 0.0;
+              }
+            else
+              {
+                alpha = 1.0 / sj;
+                p_eff++;
+              }
+
+            gsl_vector_scale (&column.vector, alpha);
+          }
+
+        *rank = p_eff;
+      }
+
+      gsl_blas_dgemv (CblasNoTrans, 1.0, QSI, xt, 0.0, c);
+
+      /* Unscale the balancing factors */
+
+      gsl_vector_div (c, D);
+
+      /* chisq = ||z - R c||^2 + rho^2 */
+
+      {
+        double r2 = rho * rho, s2;
+
+        for (i = 0; i < p; i++)
+          {
+            gsl_vector_const_view row = gsl_matrix_const_row (&R.matrix, i);
+            double ri;
+
+            gsl_blas_ddot (&row.vector, c, &ri);
+            ri = gsl_vector_get (&z.vector, i) - ri;
+            r2 += ri * ri;
+          }
+
+        s2 = r2 / (w->n - p_eff);   /* p_eff == rank */
+
+        *chisq = r2;
+
+        /* Form variance-covariance matrix cov = s2 * (Q S^-1) (Q S^-1)^T */
+
+        for (i = 0; i < p; i++)
+          {
+            gsl_vector_view row_i = gsl_matrix_row (QSI, i);
+            double d_i = gsl_vector_get (D, i);
+
+            for (j = i; j < p; j++)
+              {
+                gsl_vector_view row_j = gsl_matrix_row (QSI, j);
+                double d_j = gsl_vector_get (D, j);
+                double s;
+
+                gsl_blas_ddot (&row_i.vector, &row_j.vector, &s);
+
+                gsl_matrix_set (cov, i, j, s * s2 / (d_i * d_j));
+                gsl_matrix_set (cov, j, i, s * s2 / (d_i * d_j));
+              }
+          }
+      }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -37,6 +37,8 @@ gsl_multimin_fminimizer_alloc (const gsl_multimin_fminimizer_type * T,
     }
 
   s->type = T;
+  s->f = 0;
+  s->fb = 0;
 
   s->x = gsl_vector_calloc (n);
 
@@ -87,12 +89,42 @@ gsl_multimin_fminimizer_set (gsl_multimin_fminimizer * s,
     }  
     
   s->f = f;
+  s->fb = 0;
 
   gsl_vector_memcpy (s->x,x);
 
   return (s->type->set) (s->state, s->f, s->x, &(s->size), step_size);
 }
 
+int
+gsl_multimin_fminimizer_set_batch (gsl_multimin_fminimizer * s,
+                                   gsl_multimin_function_batch * f,
+                                   const gsl_vector * x,
+                                   const gsl_vector * step_size)
+{
+  if (s->type->set_batch == 0 || s->type->iterate_batch == 0)
+    {
+      GSL_ERROR ("minimizer does not support batched functions", GSL_EINVAL);
+    }
+
+  if (s->x->size != f->n)
+    {
+      GSL_ERROR ("function incompatible with solver size", GSL_EBADLEN);
+    }
+  
+  if (x->size != f->n || step_size->size != f->n) 
+    {
+      GSL_ERROR ("vector length not compatible with function", GSL_EBADLEN);
+    }  
+    
+  s->f = 0;
+  s->fb = f;
+
+  gsl_vector_memcpy (s->x,x);
+
+  return (s->type->set_batch) (s->state, s->fb, s->x, &(s->size), step_size);
+}
+
 void
 gsl_multimin_fminimizer_free (gsl_multimin_fminimizer * s)
 {
@@ -106,6 +138,12 @@ gsl_multimin_fminimizer_free (gsl_multimin_fminimizer * s)
 int
 gsl_multimin_fminimizer_iterate (gsl_multimin_fminimizer * s)
 {
+  if (s->fb != 0)
+    {
+      return (s->type->iterate_batch) (s->state, s->fb, s->x, &(s->size),
+                                       &(s->fval));
+    }
+
   return (s->type->iterate) (s->state, s->f, s->x, &(s->size), &(s->fval));
 }
 
@@ -55,6 +55,19 @@ typedef struct gsl_multimin_function_struct gsl_multimin_function;
 
 #define GSL_MULTIMIN_FN_EVAL(F,x) (*((F)->f))(x,(F)->params)
 
+/* Batched function: evaluate f at each row of X, storing the values
+   in y, so that several trial points can be computed concurrently */
+struct gsl_multimin_function_batch_struct 
+{
+  void (* f) (const gsl_matrix * X, void * params, gsl_vector * y);
+  size_t n;
+  void * params;
+};
+
+typedef struct gsl_multimin_function_batch_struct gsl_multimin_function_batch;
+
+#define GSL_MULTIMIN_FN_BATCH_EVAL(F,X,y) (*((F)->f))(X,(F)->params,(y))
+
 /* Definition of an arbitrary differentiable real-valued function */
 /* with gsl_vector input and parameters */
 struct gsl_multimin_function_fdf_struct 
@@ -91,6 +104,15 @@ typedef struct
                   double * size,
                   double * fval);
   void (*free) (void *state);
+  /* optional, for minimizers supporting batched functions */
+  int (*set_batch) (void *state, gsl_multimin_function_batch * f,
+                    const gsl_vector * x, 
+                    double * size,
+                    const gsl_vector * step_size);
+  int (*iterate_batch) (void *state, gsl_multimin_function_batch * f, 
+                        gsl_vector * x, 
+                        double * size,
+                        double * fval);
 }
 gsl_multimin_fminimizer_type;
 
@@ -99,6 +121,7 @@ typedef struct
   /* multi dimensional part */
   const gsl_multimin_fminimizer_type *type;
   gsl_multimin_function *f;
+  gsl_multimin_function_batch *fb;
 
   double fval;
   gsl_vector * x;
@@ -119,6 +142,12 @@ gsl_multimin_fminimizer_set (gsl_multimin_fminimizer * s,
                              const gsl_vector * x,
                              const gsl_vector * step_size);
 
+int 
+gsl_multimin_fminimizer_set_batch (gsl_multimin_fminimizer * s,
+                                   gsl_multimin_function_batch * f,
+                                   const gsl_vector * x,
+                                   const gsl_vector * step_size);
+
 void
 gsl_multimin_fminimizer_free(gsl_multimin_fminimizer *s);
 
@@ -212,11 +241,19 @@ gsl_multimin_fdfminimizer_gradient (const gsl_multimin_fdfminimizer * s);
 double 
 gsl_multimin_fdfminimizer_minimum (const gsl_multimin_fdfminimizer * s);
 
+int
+gsl_multimin_fdfminimizer_lbfgs_set_history (gsl_multimin_fdfminimizer * s,
+                                             size_t m);
+
+size_t
+gsl_multimin_fdfminimizer_lbfgs_history (const gsl_multimin_fdfminimizer * s);
+
 GSL_VAR const gsl_multimin_fdfminimizer_type *gsl_multimin_fdfminimizer_steepest_descent;
 GSL_VAR const gsl_multimin_fdfminimizer_type *gsl_multimin_fdfminimizer_conjugate_pr;
 GSL_VAR const gsl_multimin_fdfminimizer_type *gsl_multimin_fdfminimizer_conjugate_fr;
 GSL_VAR const gsl_multimin_fdfminimizer_type *gsl_multimin_fdfminimizer_vector_bfgs;
 GSL_VAR const gsl_multimin_fdfminimizer_type *gsl_multimin_fdfminimizer_vector_bfgs2;
+GSL_VAR const gsl_multimin_fdfminimizer_type *gsl_multimin_fdfminimizer_lbfgs;
 GSL_VAR const gsl_multimin_fminimizer_type *gsl_multimin_fminimizer_nmsimplex;
 GSL_VAR const gsl_multimin_fminimizer_type *gsl_multimin_fminimizer_nmsimplex2;
 GSL_VAR const gsl_multimin_fminimizer_type *gsl_multimin_fminimizer_nmsimplex2rand;
@@ -0,0 +1,528 @@
+/* multimin/lbfgs.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/* lbfgs.c -- limited memory BFGS method, J. Nocedal, "Updating
+   Quasi-Newton Matrices with Limited Storage", Math. Comp. 35 (1980)
+   773-782, and D.C. Liu and J. Nocedal, Math. Prog. 45 (1989)
+   503-528.
+
+   The inverse Hessian approximation is represented implicitly by the
+   last m pairs s_k = x_{k+1} - x_k, y_k = g_{k+1} - g_k, which are
+   kept as the rows of two m-by-n matrices used as a ring buffer.  The
+   search direction is computed with the two-loop recursion in O(mn)
+   operations, and the line search is the one used by vector_bfgs2
+   (Fletcher, Algorithms 2.6.2 and 2.6.4). */
+
+#include <config.h>
+#include <gsl/gsl_multimin.h>
+#include <gsl/gsl_blas.h>
+
+#include "linear_minimize.c"
+#include "linear_wrapper.c"
+
+#define LBFGS_DEFAULT_HISTORY 10
+
+typedef struct
+{
+  int iter;
+  double step;
+  double g0norm;
+  double pnorm;
+  double dnorm;                 /* norm of the quasi-Newton step */
+  double fp0;                   /* f'(0) for f(x-alpha*p) */
+  gsl_vector *x0;
+  gsl_vector *g0;
+  gsl_vector *p;
+  /* correction pairs, stored as rows of S and Y */
+  size_t m;                     /* maximum number of pairs */
+  size_t k;                     /* number of pairs stored */
+  size_t head;                  /* row of the next pair */
+  gsl_matrix *S;
+  gsl_matrix *Y;
+  double *rho;                  /* 1 / (s_i . y_i) */
+  double *alpha;                /* work space for the two-loop recursion */
+  /* work space */
+  gsl_vector *x_alpha;
+  gsl_vector *g_alpha;
+  gsl_vector *dg;               /* candidate y = g - g0 */
+  /* wrapper function */
+  wrapper_t wrap;
+  /* minimization parameters */
+  double rho_ls;
+  double sigma;
+  double tau1;
+  double tau2;
+  double tau3;
+  int order;
+}
+lbfgs_state_t;
+
+static void
+lbfgs_free_history (lbfgs_state_t * state)
+{
+  if (state->alpha)
+    free (state->alpha);
+  if (state->rho)
+    free (state->rho);
+  if (state->Y)
+    gsl_matrix_free (state->Y);
+  if (state->S)
+    gsl_matrix_free (state->S);
+}
+
+static int
+lbfgs_alloc_history (lbfgs_state_t * state, size_t m, size_t n)
+{
+  state->S = 0;
+  state->Y = 0;
+  state->rho = 0;
+  state->alpha = 0;
+
+  state->S = gsl_matrix_alloc (m, n);
+
+  if (state->S == 0)
+    {
+      GSL_ERROR ("failed to allocate space for S", GSL_ENOMEM);
+    }
+
+  state->Y = gsl_matrix_alloc (m, n);
+
+  if (state->Y == 0)
+    {
+      lbfgs_free_history (state);
+      GSL_ERROR ("failed to allocate space for Y", GSL_ENOMEM);
+    }
+
+  state->rho = (double *) malloc (m * sizeof (double));
+
+  if (state->rho == 0)
+    {
+      lbfgs_free_history (state);
+      GSL_ERROR ("failed to allocate space for rho", GSL_ENOMEM);
+    }
+
+  state->alpha = (double *) malloc (m * sizeof (double));
+
+  if (state->alpha == 0)
+    {
+      lbfgs_free_history (state);
+      GSL_ERROR ("failed to allocate space for alpha", GSL_ENOMEM);
+    }
+
+  state->m = m;
+  state->k = 0;
+  state->head = 0;
+
+  return GSL_SUCCESS;
+}
+
+static int
+lbfgs_alloc (void *vstate, size_t n)
+{
+  lbfgs_state_t *state = (lbfgs_state_t *) vstate;
+  int status;
+
+  state->p = gsl_vector_calloc (n);
+
+  if (state->p == 0)
+    {
+      GSL_ERROR ("failed to allocate space for p", GSL_ENOMEM);
+    }
+
+  state->x0 = gsl_vector_calloc (n);
+
+  if (state->x0 == 0)
+    {
+      gsl_vector_free (state->p);
+      GSL_ERROR ("failed to allocate space for x0", GSL_ENOMEM);
+    }
+
+  state->g0 = gsl_vector_calloc (n);
+
+  if (state->g0 == 0)
+    {
+      gsl_vector_free (state->x0);
+      gsl_vector_free (state->p);
+      GSL_ERROR ("failed to allocate space for g0", GSL_ENOMEM);
+    }
+
+  state->x_alpha = gsl_vector_calloc (n);
+
+  if (state->x_alpha == 0)
+    {
+      gsl_vector_free (state->g0);
+      gsl_vector_free (state->x0);
+      gsl_vector_free (state->p);
+      GSL_ERROR ("failed to allocate space for x_alpha", GSL_ENOMEM);
+    }
+
+  state->g_alpha = gsl_vector_calloc (n);
+
+  if (state->g_alpha == 0)
+    {
+      gsl_vector_free (state->x_alpha);
+      gsl_vector_free (state->g0);
+      gsl_vector_free (state->x0);
+      gsl_vector_free (state->p);
+      GSL_ERROR ("failed to allocate space for g_alpha", GSL_ENOMEM);
+    }
+
+  state->dg = gsl_vector_calloc (n);
+
+  if (state->dg == 0)
+    {
+      gsl_vector_free (state->g_alpha);
+      gsl_vector_free (state->x_alpha);
+      gsl_vector_free (state->g0);
+      gsl_vector_free (state->x0);
+      gsl_vector_free (state->p);
+      GSL_ERROR ("failed to allocate space for dg", GSL_ENOMEM);
+    }
+
+  status = lbfgs_alloc_history (state, LBFGS_DEFAULT_HISTORY, n);
+
+  if (status)
+    {
+      gsl_vector_free (state->dg);
+      gsl_vector_free (state->g_alpha);
+      gsl_vector_free (state->x_alpha);
+      gsl_vector_free (state->g0);
+      gsl_vector_free (state->x0);
+      gsl_vector_free (state->p);
+      return status;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+lbfgs_set (void *vstate, gsl_multimin_function_fdf * fdf,
+           const gsl_vector * x, double *f, gsl_vector * gradient,
+           double step_size, double tol)
+{
+  lbfgs_state_t *state = (lbfgs_state_t *) vstate;
+
+  state->iter = 0;
+  state->step = step_size;
+  state->k = 0;
+  state->head = 0;
+
+  GSL_MULTIMIN_FN_EVAL_F_DF (fdf, x, f, gradient);
+
+  /* Use the gradient as the initial direction */
+
+  gsl_vector_memcpy (state->x0, x);
+  gsl_vector_memcpy (state->g0, gradient);
+  state->g0norm = gsl_blas_dnrm2 (state->g0);
+
+  gsl_vector_memcpy (state->p, gradient);
+  gsl_blas_dscal (-1 / state->g0norm, state->p);
+  state->pnorm = gsl_blas_dnrm2 (state->p);     /* should be 1 */
+  state->fp0 = -state->g0norm;
+  state->dnorm = 0;
+
+  /* Prepare the wrapper */
+
+  prepare_wrapper (&state->wrap, fdf,
+                   state->x0, *f, state->g0,
+                   state->p, state->x_alpha, state->g_alpha);
+
+  /* Prepare 1d minimisation parameters */
+
+  state->rho_ls = 0.01;
+  state->sigma = tol;
+  state->tau1 = 9;
+  state->tau2 = 0.05;
+  state->tau3 = 0.5;
+  state->order = 3;  /* use cubic interpolation where possible */
+
+  return GSL_SUCCESS;
+}
+
+static void
+lbfgs_free (void *vstate)
+{
+  lbfgs_state_t *state = (lbfgs_state_t *) vstate;
+
+  lbfgs_free_history (state);
+  gsl_vector_free (state->dg);
+  gsl_vector_free (state->x_alpha);
+  gsl_vector_free (state->g_alpha);
+  gsl_vector_free (state->g0);
+  gsl_vector_free (state->x0);
+  gsl_vector_free (state->p);
+}
+
+static int
+lbfgs_restart (void *vstate)
+{
+  lbfgs_state_t *state = (lbfgs_state_t *) vstate;
+
+  state->iter = 0;
+  state->k = 0;
+  state->head = 0;
+  return GSL_SUCCESS;
+}
+
+/* Compute d = -H g by the two-loop recursion, where H is the inverse
+   Hessian approximation defined by the stored pairs and the initial
+   scaling gamma = s.y / y.y of the most recent pair */
+
+static void
+lbfgs_direction (lbfgs_state_t * state, const gsl_vector * g, gsl_vector * d)
+{
+  const size_t m = state->m;
+  size_t j;
+
+  gsl_vector_memcpy (d, g);
+
+  if (state->k > 0)
+    {
+      size_t newest = (state->head + m - 1) % m;
+      double yy, gamma;
+
+      for (j = 0; j < state->k; j++)
+        {
+          size_t i = (newest + m - j) % m;
+          gsl_vector_const_view s = gsl_matrix_const_row (state->S, i);
+          gsl_vector_const_view y = gsl_matrix_const_row (state->Y, i);
+          double a;
+
+          gsl_blas_ddot (&s.vector, d, &a);
+          a *= state->rho[i];
+          state->alpha[i] = a;
+          gsl_blas_daxpy (-a, &y.vector, d);
+        }
+
+      {
+        gsl_vector_const_view y = gsl_matrix_const_row (state->Y, newest);
+        yy = gsl_blas_dnrm2 (&y.vector);
+        gamma = 1.0 / (state->rho[newest] * yy * yy);
+        gsl_blas_dscal (gamma, d);
+      }
+
+      for (j = state->k; j-- > 0;)
+        {
+          size_t i = (newest + m - j) % m;
+          gsl_vector_const_view s = gsl_matrix_const_row (state->S, i);
+          gsl_vector_const_view y = gsl_matrix_const_row (state->Y, i);
+          double b;
+
+          gsl_blas_ddot (&y.vector, d, &b);
+          b *= state->rho[i];
+          gsl_blas_daxpy (state->alpha[i] - b, &s.vector, d);
+        }
+    }
+
+  gsl_blas_dscal (-1.0, d);
+}
+
+static int
+lbfgs_iterate (void *vstate, gsl_multimin_function_fdf * fdf,
+               gsl_vector * x, double *f,
+               gsl_vector * gradient, gsl_vector * dx)
+{
+  lbfgs_state_t *state = (lbfgs_state_t *) vstate;
+  double alpha = 0.0, alpha1;
+  gsl_vector *x0 = state->x0;
+  gsl_vector *g0 = state->g0;
+  gsl_vector *p = state->p;
+
+  double g0norm = state->g0norm;
+  double pnorm = state->pnorm;
+  double pg;
+  int status;
+
+  if (pnorm == 0.0 || g0norm == 0.0 || state->fp0 == 0)
+    {
+      gsl_vector_set_zero (dx);
+      return GSL_ENOPROG;
+    }
+
+  /* Try the full quasi-Newton step first, once there is curvature
+     information to scale it */
+
+  if (state->k > 0)
+    {
+      alpha1 = state->dnorm;
+    }
+  else
+    {
+      alpha1 = fabs (state->step);
+    }
+
+  /* line minimisation, with cubic interpolation (order = 3) */
+
+  status = minimize (&state->wrap.fdf_linear, state->rho_ls, state->sigma,
+                     state->tau1, state->tau2, state->tau3, state->order,
+                     alpha1, &alpha);
+
+  if (status != GSL_SUCCESS)
+    {
+      return status;
+    }
+
+  update_position (&(state->wrap), alpha, x, f, gradient);
+
+  state->iter++;
+
+  /* Store the new correction pair, skipping it if the curvature
+     condition s.y > 0 does not hold.  The pair is formed outside the
+     ring buffer so that a rejected pair does not overwrite the oldest
+     stored one. */
+
+  {
+    double sy;
+
+    /* s = x - x0 */
+    gsl_vector_memcpy (dx, x);
+    gsl_blas_daxpy (-1.0, x0, dx);
+
+    /* y = g - g0 */
+    gsl_vector_memcpy (state->dg, gradient);
+    gsl_blas_daxpy (-1.0, g0, state->dg);
+
+    gsl_blas_ddot (dx, state->dg, &sy);
+
+    if (sy > 0)
+      {
+        gsl_vector_view s = gsl_matrix_row (state->S, state->head);
+        gsl_vector_view y = gsl_matrix_row (state->Y, state->head);
+
+        gsl_vector_memcpy (&s.vector, dx);
+        gsl_vector_memcpy (&y.vector, state->dg);
+        state->rho[state->head] = 1.0 / sy;
+        state->head = (state->head + 1) % state->m;
+
+        if (state->k < state->m)
+          state->k++;
+      }
+  }
+
+  gsl_vector_memcpy (g0, gradient);
+  gsl_vector_memcpy (x0, x);
+  state->g0norm = gsl_blas_dnrm2 (g0);
+
+  /* Choose a new direction for the next step */
+
+  lbfgs_direction (state, gradient, p);
+
+  gsl_blas_ddot (p, gradient, &pg);
+
+  if (!(pg < 0.0))
+    {
+      /* not a descent direction, discard the history and use the
+         steepest descent direction */
+
+      state->k = 0;
+      state->head = 0;
+      gsl_vector_memcpy (p, gradient);
+      gsl_blas_dscal (-1.0, p);
+    }
+
+  state->dnorm = gsl_blas_dnrm2 (p);
+
+  if (state->dnorm > 0)
+    gsl_blas_dscal (1.0 / state->dnorm, p);
+
+  state->pnorm = gsl_blas_dnrm2 (p);
+  gsl_blas_ddot (p, g0, &state->fp0);
+
+  change_direction (&state->wrap);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_multimin_fdfminimizer_type lbfgs_type = {
+  "lbfgs",                      /* name */
+  sizeof (lbfgs_state_t),
+  &lbfgs_alloc,
+  &lbfgs_set,
+  &lbfgs_iterate,
+  &lbfgs_restart,
+  &lbfgs_free
+};
+
+const gsl_multimin_fdfminimizer_type
+  * gsl_multimin_fdfminimizer_lbfgs = &lbfgs_type;
+
+int
+gsl_multimin_fdfminimizer_lbfgs_set_history (gsl_multimin_fdfminimizer * s,
+                                             size_t m)
+{
+  lbfgs_state_t *state;
+  size_t n;
+  gsl_matrix *S, *Y;
+  double *rho, *alpha;
+  int status;
+
+  if (s->type != &lbfgs_type)
+    {
+      GSL_ERROR ("minimizer is not of type lbfgs", GSL_EINVAL);
+    }
+
+  if (m == 0)
+    {
+      GSL_ERROR ("history length must be positive", GSL_EINVAL);
+    }
+
+  state = (lbfgs_state_t *) s->state;
+  n = s->x->size;
+
+  /* keep the old history until the new one is allocated */
+
+  S = state->S;
+  Y = state->Y;
+  rho = state->rho;
+  alpha = state->alpha;
+
+  status = lbfgs_alloc_history (state, m, n);
+
+  if (status)
+    {
+      state->S = S;
+      state->Y = Y;
+      state->rho = rho;
+      state->alpha = alpha;
+      return status;
+    }
+
+  gsl_matrix_free (S);
+  gsl_matrix_free (Y);
+  free (rho);
+  free (alpha);
+
+  return GSL_SUCCESS;
+}
+
+size_t
+gsl_multimin_fdfminimizer_lbfgs_history (const gsl_multimin_fdfminimizer * s)
+{
+  const lbfgs_state_t *state;
+
+  if (s->type != &lbfgs_type)
+    {
+      GSL_ERROR_VAL ("minimizer is not of type lbfgs", GSL_EINVAL, 0);
+    }
+
+  state = (const lbfgs_state_t *) s->state;
+
+  return state->m;
+}
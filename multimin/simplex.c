@@ -460,7 +460,9 @@ static const gsl_multimin_fminimizer_type nmsimplex_type =
   &nmsimplex_alloc,
   &nmsimplex_set,
   &nmsimplex_iterate,
-  &nmsimplex_free
+  &nmsimplex_free,
+  0,                            /* no batched version */
+  0
 };
 
 const gsl_multimin_fminimizer_type
@@ -28,6 +28,11 @@
          + keep track of the center to avoid unnecessary computation
          + compute size as RMS value, allowing linear update on each step
            instead of recomputing from all N+1 vectors.
+   - Batched functions: the initial simplex and the shrink step are
+     evaluated in a single call, and each iteration evaluates the
+     reflection, expansion and both contraction candidates together,
+     so the sequence of simplices is the same as for an ordinary
+     function.
 */
 
 /* The Simplex method of Nelder and Mead, also known as the polytope
@@ -52,6 +57,8 @@ typedef struct
   gsl_vector *center;		/* center of all points */
   gsl_vector *delta;		/* current step */
   gsl_vector *xmc;		/* x - center (workspace) */
+  gsl_matrix *xb;		/* trial points for batched evaluation */
+  gsl_vector *yb;		/* function values at trial points */
   double S2;
   unsigned long count;
 }
@@ -62,6 +69,21 @@ compute_center (const nmsimplex_state_t * state, gsl_vector * center);
 static double
 compute_size (nmsimplex_state_t * state, const gsl_vector * center);
 
+static void
+move_corner (const double coeff, const size_t P,
+	     const gsl_vector * center, const gsl_vector * corner,
+	     gsl_vector * xc)
+{
+  /* xc = (1-coeff)*(P/(P-1)) * center(all) + ((P*coeff-1)/(P-1))*x_corner */
+
+  double alpha = (1 - coeff) * P / (P - 1.0);
+  double beta = (P * coeff - 1.0) / (P - 1.0);
+
+  gsl_vector_memcpy (xc, center);
+  gsl_blas_dscal (alpha, xc);
+  gsl_blas_daxpy (beta, corner, xc);
+}
+
 static double
 try_corner_move (const double coeff,
 		 const nmsimplex_state_t * state,
@@ -78,15 +100,9 @@ try_corner_move (const double coeff,
   const size_t P = x1->size1;
   double newval;
 
-  /* xc = (1-coeff)*(P/(P-1)) * center(all) + ((P*coeff-1)/(P-1))*x_corner */
   {
-    double alpha = (1 - coeff) * P / (P - 1.0);
-    double beta = (P * coeff - 1.0) / (P - 1.0);
     gsl_vector_const_view row = gsl_matrix_const_row (x1, corner);
-
-    gsl_vector_memcpy (xc, state->center);
-    gsl_blas_dscal (alpha, xc);
-    gsl_blas_daxpy (beta, &row.vector, xc);
+    move_corner (coeff, P, state->center, &row.vector, xc);
   }
 
   newval = GSL_MULTIMIN_FN_EVAL (f, xc);
@@ -94,6 +110,69 @@ try_corner_move (const double coeff,
   return newval;
 }
 
+static void
+try_corner_moves (nmsimplex_state_t * state, size_t corner,
+		  gsl_multimin_function_batch * fb)
+{
+  /* computes the reflection, expansion and contraction of a corner
+     in rows 0, 1, 2 of xb, and in row 3 the contraction that would
+     follow replacing the corner by its reflection, and evaluates
+     them in a single call */
+
+  gsl_matrix *x1 = state->x1;
+  const size_t P = x1->size1;
+  const size_t n = x1->size2;
+  gsl_vector *c = state->ws2;
+
+  gsl_vector_const_view row = gsl_matrix_const_row (x1, corner);
+  gsl_vector_view r0 = gsl_matrix_row (state->xb, 0);
+  gsl_vector_view r1 = gsl_matrix_row (state->xb, 1);
+  gsl_vector_view r2 = gsl_matrix_row (state->xb, 2);
+  gsl_vector_view r3 = gsl_matrix_row (state->xb, 3);
+
+  move_corner (-1.0, P, state->center, &row.vector, &r0.vector);
+  move_corner (-2.0, P, state->center, &row.vector, &r1.vector);
+  move_corner (0.5, P, state->center, &row.vector, &r2.vector);
+
+  /* center after replacing the corner, computed as in update_point */
+  {
+    double alpha = 1.0 / P;
+    gsl_vector_memcpy (c, state->center);
+    gsl_blas_daxpy (-alpha, &row.vector, c);
+    gsl_blas_daxpy (alpha, &r0.vector, c);
+  }
+
+  move_corner (0.5, P, c, &r0.vector, &r3.vector);
+
+  {
+    gsl_matrix_view X = gsl_matrix_submatrix (state->xb, 0, 0, 4, n);
+    gsl_vector_view y = gsl_vector_subvector (state->yb, 0, 4);
+    GSL_MULTIMIN_FN_BATCH_EVAL (fb, &X.matrix, &y.vector);
+  }
+}
+
+static void
+eval_rows (gsl_multimin_function * f, gsl_multimin_function_batch * fb,
+	   gsl_matrix * X, gsl_vector * y)
+{
+  /* evaluates the function at each row of X */
+
+  if (fb != 0)
+    {
+      GSL_MULTIMIN_FN_BATCH_EVAL (fb, X, y);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < X->size1; i++)
+	{
+	  gsl_vector_const_view row = gsl_matrix_const_row (X, i);
+	  gsl_vector_set (y, i, GSL_MULTIMIN_FN_EVAL (f, &row.vector));
+	}
+    }
+}
+
 
 static void
 update_point (nmsimplex_state_t * state, size_t i,
@@ -132,7 +211,8 @@ update_point (nmsimplex_state_t * state, size_t i,
 
 static int
 contract_by_best (nmsimplex_state_t * state, size_t best,
-		  gsl_vector * xc, gsl_multimin_function * f)
+		  gsl_vector * xc, gsl_multimin_function * f,
+		  gsl_multimin_function_batch * fb)
 {
 
   /* Function contracts the simplex in respect to best valued
@@ -161,6 +241,11 @@ contract_by_best (nmsimplex_state_t * state, size_t best,
 	      gsl_matrix_set (x1, i, j, newval);
 	    }
 
+	  if (fb != 0)
+	    {
+	      continue;
+	    }
+
 	  /* evaluate function in the new point */
 
 	  gsl_matrix_get_row (xc, x1, i);
@@ -178,6 +263,41 @@ contract_by_best (nmsimplex_state_t * state, size_t best,
 	}
     }
 
+  if (fb != 0)
+    {
+      /* evaluate the function in all the new points at once */
+
+      const size_t P = x1->size1;
+      gsl_matrix_view X = gsl_matrix_submatrix (state->xb, 0, 0, P - 1,
+						x1->size2);
+      gsl_vector_view y = gsl_vector_subvector (state->yb, 0, P - 1);
+
+      for (i = 0, j = 0; i < P; i++)
+	{
+	  if (i != best)
+	    {
+	      gsl_vector_const_view row = gsl_matrix_const_row (x1, i);
+	      gsl_matrix_set_row (&X.matrix, j++, &row.vector);
+	    }
+	}
+
+      GSL_MULTIMIN_FN_BATCH_EVAL (fb, &X.matrix, &y.vector);
+
+      for (i = 0, j = 0; i < P; i++)
+	{
+	  if (i != best)
+	    {
+	      newval = gsl_vector_get (&y.vector, j++);
+	      gsl_vector_set (y1, i, newval);
+
+	      if (!gsl_finite (newval))
+		{
+		  status = GSL_EBADFUNC;
+		}
+	    }
+	}
+    }
+
   /* We need to update the centre and size as well */
   compute_center (state, state->center);
   compute_size (state, state->center);
@@ -321,6 +441,38 @@ nmsimplex_alloc (void *vstate, size_t n)
       GSL_ERROR ("failed to allocate space for xmc", GSL_ENOMEM);
     }
 
+  /* at least four trial points are evaluated together in each
+     iteration, and n+1 in a contraction */
+
+  state->xb = gsl_matrix_alloc (GSL_MAX (n + 1, 4), n);
+
+  if (state->xb == NULL)
+    {
+      gsl_matrix_free (state->x1);
+      gsl_vector_free (state->y1);
+      gsl_vector_free (state->ws1);
+      gsl_vector_free (state->ws2);
+      gsl_vector_free (state->center);
+      gsl_vector_free (state->delta);
+      gsl_vector_free (state->xmc);
+      GSL_ERROR ("failed to allocate space for xb", GSL_ENOMEM);
+    }
+
+  state->yb = gsl_vector_alloc (GSL_MAX (n + 1, 4));
+
+  if (state->yb == NULL)
+    {
+      gsl_matrix_free (state->x1);
+      gsl_vector_free (state->y1);
+      gsl_vector_free (state->ws1);
+      gsl_vector_free (state->ws2);
+      gsl_vector_free (state->center);
+      gsl_vector_free (state->delta);
+      gsl_vector_free (state->xmc);
+      gsl_matrix_free (state->xb);
+      GSL_ERROR ("failed to allocate space for yb", GSL_ENOMEM);
+    }
+
   state->count = 0;
 
   return GSL_SUCCESS;
@@ -338,16 +490,18 @@ nmsimplex_free (void *vstate)
   gsl_vector_free (state->center);
   gsl_vector_free (state->delta);
   gsl_vector_free (state->xmc);
+  gsl_matrix_free (state->xb);
+  gsl_vector_free (state->yb);
 }
 
 static int
-nmsimplex_set (void *vstate, gsl_multimin_function * f,
-	       const gsl_vector * x,
-	       double *size, const gsl_vector * step_size)
+set_simplex (void *vstate, gsl_multimin_function * f,
+	     gsl_multimin_function_batch * fb,
+	     const gsl_vector * x,
+	     double *size, const gsl_vector * step_size)
 {
   int status;
   size_t i;
-  double val;
 
   nmsimplex_state_t *state = (nmsimplex_state_t *) vstate;
 
@@ -365,15 +519,7 @@ nmsimplex_set (void *vstate, gsl_multimin_function * f,
 
   /* first point is the original x0 */
 
-  val = GSL_MULTIMIN_FN_EVAL (f, x);
-
-  if (!gsl_finite (val))
-    {
-      GSL_ERROR ("non-finite function value encountered", GSL_EBADFUNC);
-    }
-
   gsl_matrix_set_row (state->x1, 0, x);
-  gsl_vector_set (state->y1, 0, val);
 
   /* following points are initialized to x0 + step_size */
 
@@ -391,16 +537,19 @@ nmsimplex_set (void *vstate, gsl_multimin_function * f,
 	double si = gsl_vector_get (step_size, i);
 
 	gsl_vector_set (xtemp, i, xi + si);
-	val = GSL_MULTIMIN_FN_EVAL (f, xtemp);
       }
 
-      if (!gsl_finite (val))
+      gsl_matrix_set_row (state->x1, i + 1, xtemp);
+    }
+
+  eval_rows (f, fb, state->x1, state->y1);
+
+  for (i = 0; i < state->y1->size; i++)
+    {
+      if (!gsl_finite (gsl_vector_get (state->y1, i)))
 	{
 	  GSL_ERROR ("non-finite function value encountered", GSL_EBADFUNC);
 	}
-
-      gsl_matrix_set_row (state->x1, i + 1, xtemp);
-      gsl_vector_set (state->y1, i + 1, val);
     }
 
   compute_center (state, state->center);
@@ -414,8 +563,25 @@ nmsimplex_set (void *vstate, gsl_multimin_function * f,
 }
 
 static int
-nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
-		   gsl_vector * x, double *size, double *fval)
+nmsimplex_set (void *vstate, gsl_multimin_function * f,
+	       const gsl_vector * x,
+	       double *size, const gsl_vector * step_size)
+{
+  return set_simplex (vstate, f, 0, x, size, step_size);
+}
+
+static int
+nmsimplex_set_batch (void *vstate, gsl_multimin_function_batch * fb,
+		     const gsl_vector * x,
+		     double *size, const gsl_vector * step_size)
+{
+  return set_simplex (vstate, 0, fb, x, size, step_size);
+}
+
+static int
+iterate_simplex (void *vstate, gsl_multimin_function * f,
+		 gsl_multimin_function_batch * fb,
+		 gsl_vector * x, double *size, double *fval)
 {
 
   /* Simplex iteration tries to minimize function f value */
@@ -430,6 +596,15 @@ nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
   gsl_vector *y1 = state->y1;
   gsl_matrix *x1 = state->x1;
 
+  /* trial points, in xc and xc2 or in the rows of xb for a batched
+     function */
+
+  gsl_vector_view t0 = gsl_matrix_row (state->xb, 0);
+  gsl_vector_view t1 = gsl_matrix_row (state->xb, 1);
+  gsl_vector_view t2 = gsl_matrix_row (state->xb, 2);
+  gsl_vector_view t3 = gsl_matrix_row (state->xb, 3);
+  gsl_vector *xr, *xt;
+
   const size_t n = y1->size;
   size_t i;
   size_t hi, s_hi, lo;
@@ -475,21 +650,40 @@ nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
 
   /* try reflecting the highest value point */
 
-  val = try_corner_move (-1.0, state, hi, xc, f);
+  if (fb != 0)
+    {
+      try_corner_moves (state, hi, fb);
+      xr = &t0.vector;
+      val = gsl_vector_get (state->yb, 0);
+    }
+  else
+    {
+      xr = xc;
+      val = try_corner_move (-1.0, state, hi, xc, f);
+    }
 
   if (gsl_finite (val) && val < gsl_vector_get (y1, lo))
     {
       /* reflected point is lowest, try expansion */
 
-      val2 = try_corner_move (-2.0, state, hi, xc2, f);
+      if (fb != 0)
+	{
+	  xt = &t1.vector;
+	  val2 = gsl_vector_get (state->yb, 1);
+	}
+      else
+	{
+	  xt = xc2;
+	  val2 = try_corner_move (-2.0, state, hi, xc2, f);
+	}
 
       if (gsl_finite (val2) && val2 < gsl_vector_get (y1, lo))
 	{
-	  update_point (state, hi, xc2, val2);
+	  update_point (state, hi, xt, val2);
 	}
       else
 	{
-	  update_point (state, hi, xc, val);
+	  update_point (state, hi, xr, val);
 	}
     }
   else if (!gsl_finite (val) || val > gsl_vector_get (y1, s_hi))
@@ -497,27 +691,39 @@ nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
       /* reflection does not improve things enough, or we got a
          non-finite function value */
 
+      int replaced = 0;
+
       if (gsl_finite (val) && val <= gsl_vector_get (y1, hi))
 	{
 	  /* if trial point is better than highest point, replace
 	     highest point */
 
-	  update_point (state, hi, xc, val);
+	  update_point (state, hi, xr, val);
+	  replaced = 1;
 	}
 
       /* try one-dimensional contraction */
 
-      val2 = try_corner_move (0.5, state, hi, xc2, f);
+      if (fb != 0)
+	{
+	  xt = replaced ? &t3.vector : &t2.vector;
+	  val2 = gsl_vector_get (state->yb, replaced ? 3 : 2);
+	}
+      else
+	{
+	  xt = xc2;
+	  val2 = try_corner_move (0.5, state, hi, xc2, f);
+	}
 
       if (gsl_finite (val2) && val2 <= gsl_vector_get (y1, hi))
 	{
-	  update_point (state, hi, xc2, val2);
+	  update_point (state, hi, xt, val2);
 	}
       else
 	{
 	  /* contract the whole simplex about the best point */
 
-	  status = contract_by_best (state, lo, xc, f);
+	  status = contract_by_best (state, lo, xc, f, fb);
 
 	  if (status != GSL_SUCCESS)
 	    {
@@ -530,7 +736,7 @@ nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
       /* trial point is better than second highest point.  Replace
          highest point by it */
 
-      update_point (state, hi, xc, val);
+      update_point (state, hi, xr, val);
     }
 
   /* return lowest point of simplex as x */
@@ -558,13 +764,29 @@ nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
   return GSL_SUCCESS;
 }
 
+static int
+nmsimplex_iterate (void *vstate, gsl_multimin_function * f,
+		   gsl_vector * x, double *size, double *fval)
+{
+  return iterate_simplex (vstate, f, 0, x, size, fval);
+}
+
+static int
+nmsimplex_iterate_batch (void *vstate, gsl_multimin_function_batch * fb,
+			 gsl_vector * x, double *size, double *fval)
+{
+  return iterate_simplex (vstate, 0, fb, x, size, fval);
+}
+
 static const gsl_multimin_fminimizer_type nmsimplex_type = 
 { "nmsimplex2",	/* name */
   sizeof (nmsimplex_state_t),
   &nmsimplex_alloc,
   &nmsimplex_set,
   &nmsimplex_iterate,
-  &nmsimplex_free
+  &nmsimplex_free,
+  &nmsimplex_set_batch,
+  &nmsimplex_iterate_batch
 };
 
 const gsl_multimin_fminimizer_type
@@ -580,12 +802,12 @@ ran_unif (unsigned long *seed)
 }
 
 static int
-nmsimplex_set_rand (void *vstate, gsl_multimin_function * f,
-		    const gsl_vector * x,
-		    double *size, const gsl_vector * step_size)
+set_simplex_rand (void *vstate, gsl_multimin_function * f,
+		  gsl_multimin_function_batch * fb,
+		  const gsl_vector * x,
+		  double *size, const gsl_vector * step_size)
 {
   size_t i, j;
-  double val;
 
   nmsimplex_state_t *state = (nmsimplex_state_t *) vstate;
 
@@ -603,15 +825,7 @@ nmsimplex_set_rand (void *vstate, gsl_multimin_function * f,
 
   /* first point is the original x0 */
 
-  val = GSL_MULTIMIN_FN_EVAL (f, x);
-
-  if (!gsl_finite (val))
-    {
-      GSL_ERROR ("non-finite function value encountered", GSL_EBADFUNC);
-    }
-
   gsl_matrix_set_row (state->x1, 0, x);
-  gsl_vector_set (state->y1, 0, val);
 
   {
     gsl_matrix_view m =
@@ -660,23 +874,19 @@ nmsimplex_set_rand (void *vstate, gsl_multimin_function * f,
 	    gsl_vector_set (&c_i.vector, j, x_i + s_i * x_ij);
 	  }
       }
+  }
 
-    /* compute the function values at each offset point */
+  /* compute the function values at x0 and each offset point */
 
-    for (i = 0; i < x->size; i++)
-      {
-	gsl_vector_view r_i = gsl_matrix_row (&m.matrix, i);
+  eval_rows (f, fb, state->x1, state->y1);
 
-	val = GSL_MULTIMIN_FN_EVAL (f, &r_i.vector);
-
-	if (!gsl_finite (val))
-	  {
-	    GSL_ERROR ("non-finite function value encountered", GSL_EBADFUNC);
-	  }
-
-	gsl_vector_set (state->y1, i + 1, val);
-      }
-  }
+  for (i = 0; i < state->y1->size; i++)
+    {
+      if (!gsl_finite (gsl_vector_get (state->y1, i)))
+	{
+	  GSL_ERROR ("non-finite function value encountered", GSL_EBADFUNC);
+	}
+    }
 
   compute_center (state, state->center);
 
@@ -688,13 +898,31 @@ nmsimplex_set_rand (void *vstate, gsl_multimin_function * f,
   return GSL_SUCCESS;
 }
 
+static int
+nmsimplex_set_rand (void *vstate, gsl_multimin_function * f,
+		    const gsl_vector * x,
+		    double *size, const gsl_vector * step_size)
+{
+  return set_simplex_rand (vstate, f, 0, x, size, step_size);
+}
+
+static int
+nmsimplex_set_rand_batch (void *vstate, gsl_multimin_function_batch * fb,
+			  const gsl_vector * x,
+			  double *size, const gsl_vector * step_size)
+{
+  return set_simplex_rand (vstate, 0, fb, x, size, step_size);
+}
+
 static const gsl_multimin_fminimizer_type nmsimplex2rand_type = 
 { "nmsimplex2rand",	/* name */
   sizeof (nmsimplex_state_t),
   &nmsimplex_alloc,
   &nmsimplex_set_rand,
   &nmsimplex_iterate,
-  &nmsimplex_free
+  &nmsimplex_free,
+  &nmsimplex_set_rand_batch,
+  &nmsimplex_iterate_batch
 };
 
 const gsl_multimin_fminimizer_type
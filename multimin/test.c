@@ -38,13 +38,23 @@ int
 test_f(const char * desc, gsl_multimin_function *f, initpt_function initpt,
        const gsl_multimin_fminimizer_type *T);
 
+void
+test_lbfgs (void);
+
+void
+test_lbfgs_rejected_pair (void);
+
+int
+test_f_batch(const char * desc, gsl_multimin_function *f,
+             initpt_function initpt, const gsl_multimin_fminimizer_type *T);
+
 int
 main (void)
 {
   gsl_ieee_env_setup ();
 
   {
-    const gsl_multimin_fdfminimizer_type *fdfminimizers[6];
+    const gsl_multimin_fdfminimizer_type *fdfminimizers[7];
     const gsl_multimin_fdfminimizer_type ** T;
 
     fdfminimizers[0] = gsl_multimin_fdfminimizer_steepest_descent;
@@ -52,7 +62,8 @@ main (void)
     fdfminimizers[2] = gsl_multimin_fdfminimizer_conjugate_fr;
     fdfminimizers[3] = gsl_multimin_fdfminimizer_vector_bfgs;
     fdfminimizers[4] = gsl_multimin_fdfminimizer_vector_bfgs2;
-    fdfminimizers[5] = 0;
+    fdfminimizers[5] = gsl_multimin_fdfminimizer_lbfgs;
+    fdfminimizers[6] = 0;
 
     T = fdfminimizers;
     
@@ -77,6 +88,9 @@ main (void)
       }
   }
 
+  test_lbfgs ();
+  test_lbfgs_rejected_pair ();
+
 
   {
     const gsl_multimin_fminimizer_type *fminimizers[4];
@@ -97,6 +111,41 @@ main (void)
         test_f("Spring", &spring_fmin, spring_initpt,*T);
         T++;
       }
+
+    /* batched evaluation must follow the same sequence of simplices */
+
+    T = fminimizers + 1;
+    
+    while (*T != 0) 
+      {
+        test_f_batch("Roth", &roth_fmin, roth_initpt,*T);
+        test_f_batch("Wood", &wood_fmin, wood_initpt,*T);
+        test_f_batch("Rosenbrock", &rosenbrock_fmin, rosenbrock_initpt,*T);
+        test_f_batch("Spring", &spring_fmin, spring_initpt,*T);
+        T++;
+      }
+
+    /* the original simplex minimizer has no batched version */
+
+    {
+      gsl_multimin_function_batch fb;
+      gsl_vector *x = gsl_vector_calloc (2);
+      gsl_multimin_fminimizer *s =
+        gsl_multimin_fminimizer_alloc (gsl_multimin_fminimizer_nmsimplex, 2);
+      gsl_error_handler_t *h = gsl_set_error_handler_off ();
+      int status;
+
+      fb.f = 0;
+      fb.n = 2;
+      fb.params = 0;
+
+      status = gsl_multimin_fminimizer_set_batch (s, &fb, x, x);
+      gsl_test_int (status, GSL_EINVAL, "nmsimplex set_batch not supported");
+
+      gsl_set_error_handler (h);
+      gsl_multimin_fminimizer_free (s);
+      gsl_vector_free (x);
+    }
   }
 
 
@@ -165,6 +214,377 @@ test_fdf(const char * desc,
   return status;
 }
 
+static int
+run_fdf (gsl_multimin_fdfminimizer * s, gsl_multimin_function_fdf *f,
+         initpt_function initpt, double tol, size_t * iter)
+{
+  int status;
+  gsl_vector *x = gsl_vector_alloc (f->n);
+
+  fcount = 0; gcount = 0;
+
+  (*initpt) (x);
+
+  gsl_multimin_fdfminimizer_set (s, f, x, 0.1 * gsl_blas_dnrm2 (x), tol);
+
+  *iter = 0;
+
+  do 
+    {
+      (*iter)++;
+      status = gsl_multimin_fdfminimizer_iterate(s);
+
+      if (status == GSL_ENOPROG)
+        break;
+
+      status = gsl_multimin_test_gradient(s->gradient,1e-3);
+    }
+  while (*iter < 5000 && status == GSL_CONTINUE);
+
+  if (status == GSL_CONTINUE || status == GSL_ENOPROG) 
+    status = (fabs(s->f) > 1e-5);
+
+  gsl_vector_free (x);
+
+  return status;
+}
+
+void
+test_lbfgs (void)
+{
+  const size_t history[] = { 1, 3, 20 };
+  size_t k;
+  size_t iter;
+  int status;
+  unsigned int gcount_bfgs2;
+
+  /* the history length can be changed after allocation */
+
+  for (k = 0; k < sizeof (history) / sizeof (history[0]); k++)
+    {
+      gsl_multimin_fdfminimizer *s =
+        gsl_multimin_fdfminimizer_alloc (gsl_multimin_fdfminimizer_lbfgs,
+                                         xrosenbrock.n);
+
+      gsl_test_int (gsl_multimin_fdfminimizer_lbfgs_history (s), 10,
+                    "lbfgs default history length");
+
+      status = gsl_multimin_fdfminimizer_lbfgs_set_history (s, history[k]);
+      gsl_test_int (status, GSL_SUCCESS, "lbfgs set_history m=%d",
+                    (int) history[k]);
+      gsl_test_int (gsl_multimin_fdfminimizer_lbfgs_history (s),
+                    history[k], "lbfgs history length m=%d",
+                    (int) history[k]);
+
+      status = run_fdf (s, &xrosenbrock, xrosenbrock_initpt, 0.9, &iter);
+
+      gsl_test (status, "lbfgs m=%d, on XRosenbrock: %i iters (fn+g=%d+%d), f(x)=%g",
+                (int) history[k], iter, fcount, gcount, s->f);
+
+      gsl_multimin_fdfminimizer_free (s);
+    }
+
+  /* with the recommended line search tolerances the limited memory
+     method should need fewer gradients than vector_bfgs2 */
+
+  {
+    gsl_multimin_fdfminimizer *s =
+      gsl_multimin_fdfminimizer_alloc (gsl_multimin_fdfminimizer_vector_bfgs2,
+                                       xrosenbrock.n);
+    run_fdf (s, &xrosenbrock, xrosenbrock_initpt, 0.1, &iter);
+    gcount_bfgs2 = gcount;
+
+    {
+      gsl_error_handler_t *h = gsl_set_error_handler_off ();
+      status = gsl_multimin_fdfminimizer_lbfgs_set_history (s, 5);
+      gsl_test_int (status, GSL_EINVAL, "lbfgs set_history on wrong type");
+      gsl_set_error_handler (h);
+    }
+
+    gsl_multimin_fdfminimizer_free (s);
+  }
+
+  {
+    gsl_multimin_fdfminimizer *s =
+      gsl_multimin_fdfminimizer_alloc (gsl_multimin_fdfminimizer_lbfgs,
+                                       xrosenbrock.n);
+    run_fdf (s, &xrosenbrock, xrosenbrock_initpt, 0.9, &iter);
+
+    gsl_test (gcount >= gcount_bfgs2,
+              "lbfgs gradient evaluations on XRosenbrock (%d vs %d for vector_bfgs2)",
+              gcount, gcount_bfgs2);
+
+    gsl_multimin_fdfminimizer_free (s);
+  }
+}
+
+/* A function with concave regions, f = sum_i w_i (1 - cos x_i) + x_0 x_1,
+   on which a loose line search (sigma > 1) accepts steps with s.y <= 0 */
+
+static double
+wavy_f (const gsl_vector * x, void *params)
+{
+  size_t i;
+  double f = gsl_vector_get (x, 0) * gsl_vector_get (x, 1);
+
+  for (i = 0; i < x->size; i++)
+    f += (1.0 + i) * (1.0 - cos (gsl_vector_get (x, i)));
+
+  return f;
+}
+
+static void
+wavy_df (const gsl_vector * x, void *params, gsl_vector * df)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; i++)
+    gsl_vector_set (df, i, (1.0 + i) * sin (gsl_vector_get (x, i)));
+
+  *gsl_vector_ptr (df, 0) += gsl_vector_get (x, 1);
+  *gsl_vector_ptr (df, 1) += gsl_vector_get (x, 0);
+}
+
+static void
+wavy_fdf (const gsl_vector * x, void *params, double *f, gsl_vector * df)
+{
+  *f = wavy_f (x, params);
+  wavy_df (x, params, df);
+}
+
+/* Check each lbfgs step against a separate two-loop recursion over
+   the accepted pairs, on a run where pairs are rejected after the
+   history has wrapped around */
+
+void
+test_lbfgs_rejected_pair (void)
+{
+  enum { N = 4, M = 2 };
+  gsl_multimin_function_fdf wavy = { &wavy_f, &wavy_df, &wavy_fdf, N, 0 };
+  gsl_multimin_fdfminimizer *s =
+    gsl_multimin_fdfminimizer_alloc (gsl_multimin_fdfminimizer_lbfgs, N);
+  gsl_vector *x = gsl_vector_alloc (N);
+  double S[M][N], Y[M][N], rho[M], alpha[M];
+  double g0[N], d[N], sn[N], yn[N];
+  size_t i, j, k = 0, head = 0, iter;
+  int nrejected = 0;
+  double maxerr = 0.0;
+
+  for (i = 0; i < N; i++)
+    gsl_vector_set (x, i, 2.5 - 0.7 * i);
+
+  gsl_multimin_fdfminimizer_lbfgs_set_history (s, M);
+  gsl_multimin_fdfminimizer_set (s, &wavy, x, 0.1, 2.0);
+
+  for (i = 0; i < N; i++)
+    {
+      g0[i] = gsl_vector_get (s->gradient, i);
+      d[i] = -g0[i];
+    }
+
+  for (iter = 0; iter < 50; iter++)
+    {
+      double sy = 0.0, dd = 0.0, xx = 0.0, dg = 0.0, gg = 0.0;
+
+      if (gsl_multimin_fdfminimizer_iterate (s))
+        break;
+
+      /* the step must be along the predicted direction */
+
+      for (i = 0; i < N; i++)
+        {
+          dd += d[i] * d[i];
+          xx += gsl_vector_get (s->dx, i) * gsl_vector_get (s->dx, i);
+        }
+
+      if (xx == 0.0)
+        break;
+
+      for (i = 0; i < N; i++)
+        {
+          double e = gsl_vector_get (s->dx, i) / sqrt (xx) - d[i] / sqrt (dd);
+          maxerr = GSL_MAX_DBL (maxerr, fabs (e));
+        }
+
+      /* update the reference history */
+
+      for (i = 0; i < N; i++)
+        {
+          sn[i] = gsl_vector_get (s->dx, i);
+          yn[i] = gsl_vector_get (s->gradient, i) - g0[i];
+          sy += sn[i] * yn[i];
+          g0[i] = gsl_vector_get (s->gradient, i);
+        }
+
+      if (sy > 0)
+        {
+          for (i = 0; i < N; i++)
+            {
+              S[head][i] = sn[i];
+              Y[head][i] = yn[i];
+            }
+          rho[head] = 1.0 / sy;
+          head = (head + 1) % M;
+          if (k < M)
+            k++;
+        }
+      else if (k == M)
+        {
+          nrejected++;
+        }
+
+      /* two-loop recursion, d = -H g */
+
+      for (i = 0; i < N; i++)
+        d[i] = g0[i];
+
+      if (k > 0)
+        {
+          size_t newest = (head + M - 1) % M;
+          double yy = 0.0;
+
+          for (j = 0; j < k; j++)
+            {
+              size_t r = (newest + M - j) % M;
+              double a = 0.0;
+              for (i = 0; i < N; i++)
+                a += S[r][i] * d[i];
+              alpha[r] = a * rho[r];
+              for (i = 0; i < N; i++)
+                d[i] -= alpha[r] * Y[r][i];
+            }
+
+          for (i = 0; i < N; i++)
+            yy += Y[newest][i] * Y[newest][i];
+
+          for (i = 0; i < N; i++)
+            d[i] /= rho[newest] * yy;
+
+          for (j = k; j-- > 0;)
+            {
+              size_t r = (newest + M - j) % M;
+              double b = 0.0;
+              for (i = 0; i < N; i++)
+                b += Y[r][i] * d[i];
+              b *= rho[r];
+              for (i = 0; i < N; i++)
+                d[i] += (alpha[r] - b) * S[r][i];
+            }
+        }
+
+      for (i = 0; i < N; i++)
+        {
+          d[i] = -d[i];
+          dg += d[i] * g0[i];
+          gg += g0[i] * g0[i];
+        }
+
+      if (!(dg < 0.0))
+        {
+          k = 0;
+          head = 0;
+          for (i = 0; i < N; i++)
+            d[i] = -g0[i];
+        }
+
+      if (gg < 1e-20)
+        break;
+    }
+
+  gsl_test (nrejected == 0,
+            "lbfgs m=%d, pairs rejected after the history wrapped (%d)",
+            M, nrejected);
+  gsl_test_abs (maxerr, 0.0, 1e-8,
+                "lbfgs m=%d, steps follow the two-loop recursion", M);
+
+  gsl_vector_free (x);
+  gsl_multimin_fdfminimizer_free (s);
+}
+
+static unsigned int bcount;
+
+static void
+batch_f (const gsl_matrix * X, void * params, gsl_vector * y)
+{
+  gsl_multimin_function * f = (gsl_multimin_function *) params;
+  size_t i;
+
+  bcount++;
+
+  for (i = 0; i < X->size1; i++)
+    {
+      gsl_vector_const_view row = gsl_matrix_const_row (X, i);
+      gsl_vector_set (y, i, GSL_MULTIMIN_FN_EVAL (f, &row.vector));
+    }
+}
+
+int
+test_f_batch(const char * desc, gsl_multimin_function *f,
+             initpt_function initpt, const gsl_multimin_fminimizer_type *T)
+{
+  int status = 0;
+  size_t i, iter = 0;
+  unsigned int count;
+
+  gsl_vector *x = gsl_vector_alloc (f->n);
+  gsl_vector *step_size = gsl_vector_alloc (f->n);
+  gsl_multimin_function_batch fb;
+  gsl_multimin_fminimizer *s, *sb;
+
+  fb.f = &batch_f;
+  fb.n = f->n;
+  fb.params = f;
+
+  (*initpt) (x);
+
+  for (i = 0; i < f->n; i++) 
+    gsl_vector_set (step_size, i, 1);
+
+  s = gsl_multimin_fminimizer_alloc(T, f->n);
+  sb = gsl_multimin_fminimizer_alloc(T, f->n);
+
+  fcount = 0;
+  gsl_multimin_fminimizer_set (s, f, x, step_size);
+  count = fcount;
+
+  fcount = 0; bcount = 0;
+  gsl_multimin_fminimizer_set_batch (sb, &fb, x, step_size);
+
+  gsl_test_int (fcount, count, "%s batch, on %s: initial evaluations",
+                gsl_multimin_fminimizer_name(s), desc);
+  gsl_test_int (bcount, 1, "%s batch, on %s: initial batches",
+                gsl_multimin_fminimizer_name(s), desc);
+
+  fcount = 0; bcount = 0;
+
+  do 
+    {
+      iter++;
+      gsl_multimin_fminimizer_iterate(s);
+      gsl_multimin_fminimizer_iterate(sb);
+
+      for (i = 0; i < f->n; i++)
+        {
+          status |= (gsl_vector_get (s->x, i) != gsl_vector_get (sb->x, i));
+        }
+
+      status |= (s->fval != sb->fval);
+      status |= (s->size != sb->size);
+    }
+  while (iter < 5000 && status == 0
+         && gsl_multimin_test_size (s->size, 1e-3) == GSL_CONTINUE);
+
+  gsl_test(status, "%s batch, on %s: %d iter (batches=%d), f(x)=%g",
+           gsl_multimin_fminimizer_name(sb), desc, iter, bcount, sb->fval);
+
+  gsl_multimin_fminimizer_free(s);
+  gsl_multimin_fminimizer_free(sb);
+  gsl_vector_free(x);
+  gsl_vector_free(step_size);
+
+  return status;
+}
+
 int
 test_f(const char * desc, gsl_multimin_function *f, initpt_function initpt,
        const gsl_multimin_fminimizer_type *T)
@@ -340,3 +340,66 @@ spring_f (const gsl_vector * x, void *params)
 }
 
 
+
+/* chained Rosenbrock function in 100 dimensions, where each term
+   couples neighbouring variables */
+
+gsl_multimin_function_fdf xrosenbrock =
+{&xrosenbrock_f,
+ &xrosenbrock_df,
+ &xrosenbrock_fdf,
+ 100, 0};
+
+void xrosenbrock_initpt (gsl_vector * x)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; i++)
+    {
+      gsl_vector_set (x, i, (i % 2) ? 1.0 : -1.2);
+    }
+}
+
+double xrosenbrock_f (const gsl_vector * x, void *params)
+{
+  size_t i;
+  double f = 0;
+
+  fcount++;
+
+  for (i = 0; i + 1 < x->size; i++)
+    {
+      double u = gsl_vector_get(x,i);
+      double v = gsl_vector_get(x,i+1);
+      double a = u - 1;
+      double b = u * u - v;
+      f += a * a + 100 * b * b;
+    }
+
+  return f;
+}
+
+void xrosenbrock_df (const gsl_vector * x, void *params, gsl_vector * df)
+{
+  size_t i;
+
+  gcount++;
+
+  gsl_vector_set_zero (df);
+
+  for (i = 0; i + 1 < x->size; i++)
+    {
+      double u = gsl_vector_get(x,i);
+      double v = gsl_vector_get(x,i+1);
+      double b = u * u - v;
+      *gsl_vector_ptr(df,i) += 2 * (u - 1) + 400 * u * b;
+      *gsl_vector_ptr(df,i+1) += -200 * b;
+    }
+}
+
+void xrosenbrock_fdf (const gsl_vector * x, void *params, double * f,
+                      gsl_vector * df) 
+{
+  *f = xrosenbrock_f (x, params);
+  xrosenbrock_df (x, params, df);
+}
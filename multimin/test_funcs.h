@@ -66,3 +66,9 @@ void Nwood_fdf (const gsl_vector * x, void *params, double * f, gsl_vector * df)
 extern gsl_multimin_function spring_fmin;
 void spring_initpt (gsl_vector * x);
 double spring_f (const gsl_vector *x, void *params);
+
+extern gsl_multimin_function_fdf xrosenbrock;
+void xrosenbrock_initpt (gsl_vector * x);
+double xrosenbrock_f (const gsl_vector * x, void *params);
+void xrosenbrock_df (const gsl_vector * x, void *params, gsl_vector * df);
+void xrosenbrock_fdf (const gsl_vector * x, void *params, double * f, gsl_vector * df);
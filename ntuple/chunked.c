@@ -0,0 +1,684 @@
+/* ntuple/chunked.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Chunked ntuple files.  Rows are collected in memory and written a
+   chunk at a time, optionally transposed into columns.  When reading,
+   the file is mapped into memory if mmap is available, otherwise each
+   chunk is read with a single fread.  The offsets of all the chunks are
+   found when the file is opened, so that ranges of chunks can be
+   projected independently, e.g. by several threads. */
+
+#include <config.h>
+#include <string.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_ntuple.h>
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/types.h>
+#include <sys/mman.h>
+#define NTUPLE_USE_MMAP 1
+#endif
+
+#include "chunked.h"
+
+#define EVAL(f,x) ((*((f)->function))(x,(f)->params))
+
+static void
+chunked_free (struct gsl_ntuple_chunked_struct *c)
+{
+#ifdef NTUPLE_USE_MMAP
+  if (c->map)
+    munmap ((void *) c->map, c->map_size);
+#endif
+
+  free (c->offset);
+  free (c->width);
+  free (c->buf);
+  free (c->chunk_offset);
+  free (c->chunk_nrows);
+  free (c->filename);
+  free (c);
+}
+
+static char *
+copy_filename (const char *filename)
+{
+  char *s = (char *) malloc (strlen (filename) + 1);
+
+  if (s)
+    strcpy (s, filename);
+
+  return s;
+}
+
+/* copy row r of a chunk of nrows rows at data into row */
+
+static void
+chunk_get_row (const struct gsl_ntuple_chunked_struct *c, const char *data,
+               size_t nrows, size_t r, char *row, size_t size)
+{
+  if (c->columns)
+    {
+      size_t j;
+
+      for (j = 0; j < c->ncols; j++)
+        {
+          memcpy (row + c->offset[j], data + r * c->width[j], c->width[j]);
+          data += nrows * c->width[j];
+        }
+    }
+  else
+    {
+      memcpy (row, data + r * size, size);
+    }
+}
+
+/*
+ * gsl_ntuple_create_chunked:
+ * Initialize an ntuple structure and create a chunked file for it
+ */
+
+gsl_ntuple *
+gsl_ntuple_create_chunked (char *filename, void *ntuple_data, size_t size,
+                           size_t chunk_rows, size_t ncols,
+                           const size_t offset[], const size_t width[])
+{
+  gsl_ntuple *ntuple;
+  struct gsl_ntuple_chunked_struct *c;
+  size_t j, hdr[5];
+
+  if (size == 0)
+    {
+      GSL_ERROR_VAL ("ntuple row size must be positive", GSL_EINVAL, 0);
+    }
+
+  for (j = 0; j < ncols; j++)
+    {
+      if (width[j] == 0 || offset[j] > size || width[j] > size - offset[j])
+        {
+          GSL_ERROR_VAL ("ntuple column outside the row", GSL_EINVAL, 0);
+        }
+    }
+
+  if (chunk_rows == 0)
+    {
+      chunk_rows = (size < NTUPLE_BUFFER_SIZE) ? NTUPLE_BUFFER_SIZE / size : 1;
+    }
+
+  ntuple = (gsl_ntuple *) malloc (sizeof (gsl_ntuple));
+
+  if (ntuple == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  c = (struct gsl_ntuple_chunked_struct *)
+    calloc (1, sizeof (struct gsl_ntuple_chunked_struct));
+
+  if (c == 0)
+    {
+      free (ntuple);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple chunk struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->ntuple_data = ntuple_data;
+  ntuple->size = size;
+  ntuple->chunked = c;
+
+  c->writing = 1;
+  c->columns = (ncols > 0);
+  c->chunk_rows = chunk_rows;
+  c->ncols = ncols;
+  c->payload = size;
+
+  if (ncols > 0)
+    {
+      c->offset = (size_t *) malloc (ncols * sizeof (size_t));
+      c->width = (size_t *) malloc (ncols * sizeof (size_t));
+
+      if (c->offset == 0 || c->width == 0)
+        {
+          chunked_free (c);
+          free (ntuple);
+          GSL_ERROR_VAL ("failed to allocate space for ntuple columns",
+                         GSL_ENOMEM, 0);
+        }
+
+      c->payload = 0;
+
+      for (j = 0; j < ncols; j++)
+        {
+          c->offset[j] = offset[j];
+          c->width[j] = width[j];
+          c->payload += width[j];
+        }
+    }
+
+  c->buf = (char *) malloc (chunk_rows * c->payload);
+
+  if (c->buf == 0)
+    {
+      chunked_free (c);
+      free (ntuple);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple chunk",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->file = fopen (filename, "wb");
+
+  if (ntuple->file == 0)
+    {
+      chunked_free (c);
+      free (ntuple);
+      GSL_ERROR_VAL ("unable to create ntuple file", GSL_EFAILED, 0);
+    }
+
+  hdr[0] = NTUPLE_VERSION;
+  hdr[1] = c->columns;
+  hdr[2] = size;
+  hdr[3] = chunk_rows;
+  hdr[4] = ncols;
+
+  if (fwrite (NTUPLE_MAGIC, 1, NTUPLE_MAGIC_SIZE, ntuple->file)
+      != NTUPLE_MAGIC_SIZE
+      || fwrite (hdr, sizeof (size_t), 5, ntuple->file) != 5
+      || (ncols > 0
+          && (fwrite (c->offset, sizeof (size_t), ncols, ntuple->file) != ncols
+              || fwrite (c->width, sizeof (size_t), ncols, ntuple->file)
+              != ncols)))
+    {
+      fclose (ntuple->file);
+      chunked_free (c);
+      free (ntuple);
+      GSL_ERROR_VAL ("failed to write ntuple header", GSL_EFAILED, 0);
+    }
+
+  return ntuple;
+}
+
+/*
+ * gsl_ntuple_open_chunked:
+ * Initialize an ntuple structure and open a chunked file, mapping it
+ * into memory where possible
+ */
+
+gsl_ntuple *
+gsl_ntuple_open_chunked (char *filename, void *ntuple_data, size_t size)
+{
+  gsl_ntuple *ntuple;
+  struct gsl_ntuple_chunked_struct *c;
+  char magic[NTUPLE_MAGIC_SIZE];
+  size_t j, hdr[5], nalloc = 0;
+  long file_size, pos;
+  int status = GSL_EFAILED;
+  const char *reason = "not a chunked ntuple file";
+
+  ntuple = (gsl_ntuple *) malloc (sizeof (gsl_ntuple));
+
+  if (ntuple == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  c = (struct gsl_ntuple_chunked_struct *)
+    calloc (1, sizeof (struct gsl_ntuple_chunked_struct));
+
+  if (c == 0)
+    {
+      free (ntuple);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple chunk struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->ntuple_data = ntuple_data;
+  ntuple->size = size;
+  ntuple->chunked = c;
+
+  c->filename = copy_filename (filename);
+
+  if (c->filename == 0)
+    {
+      chunked_free (c);
+      free (ntuple);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple filename",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->file = fopen (filename, "rb");
+
+  if (ntuple->file == 0)
+    {
+      chunked_free (c);
+      free (ntuple);
+      GSL_ERROR_VAL ("unable to open ntuple file for reading",
+                     GSL_EFAILED, 0);
+    }
+
+  if (fseek (ntuple->file, 0L, SEEK_END) != 0
+      || (file_size = ftell (ntuple->file)) < 0
+      || fseek (ntuple->file, 0L, SEEK_SET) != 0)
+    {
+      reason = "unable to find the size of the ntuple file";
+      goto error;
+    }
+
+  if (fread (magic, 1, NTUPLE_MAGIC_SIZE, ntuple->file) != NTUPLE_MAGIC_SIZE
+      || memcmp (magic, NTUPLE_MAGIC, NTUPLE_MAGIC_SIZE) != 0
+      || fread (hdr, sizeof (size_t), 5, ntuple->file) != 5)
+    {
+      goto error;
+    }
+
+  if (hdr[0] != NTUPLE_VERSION || hdr[1] > 1 || hdr[3] == 0
+      || (hdr[1] == 1) != (hdr[4] > 0))
+    {
+      reason = "unsupported version of the chunked ntuple format";
+      goto error;
+    }
+
+  if (hdr[2] != size)
+    {
+      reason = "ntuple file has a different row size";
+      status = GSL_EINVAL;
+      goto error;
+    }
+
+  c->columns = (int) hdr[1];
+  c->chunk_rows = hdr[3];
+  c->ncols = hdr[4];
+  c->payload = size;
+
+  if (c->ncols > 0)
+    {
+      c->offset = (size_t *) malloc (c->ncols * sizeof (size_t));
+      c->width = (size_t *) malloc (c->ncols * sizeof (size_t));
+
+      if (c->offset == 0 || c->width == 0)
+        {
+          reason = "failed to allocate space for ntuple columns";
+          status = GSL_ENOMEM;
+          goto error;
+        }
+
+      if (fread (c->offset, sizeof (size_t), c->ncols, ntuple->file)
+          != c->ncols
+          || fread (c->width, sizeof (size_t), c->ncols, ntuple->file)
+          != c->ncols)
+        {
+          reason = "failed to read ntuple header";
+          goto error;
+        }
+
+      c->payload = 0;
+
+      for (j = 0; j < c->ncols; j++)
+        {
+          if (c->width[j] == 0 || c->offset[j] > size
+              || c->width[j] > size - c->offset[j])
+            {
+              reason = "ntuple column outside the row";
+              goto error;
+            }
+
+          c->payload += c->width[j];
+        }
+    }
+
+  /* find the offset of every chunk */
+
+  pos = ftell (ntuple->file);
+
+  while (pos < file_size)
+    {
+      size_t nrows;
+
+      if (fread (&nrows, sizeof (size_t), 1, ntuple->file) != 1
+          || nrows == 0 || nrows > c->chunk_rows)
+        {
+          reason = "corrupted chunk in ntuple file";
+          goto error;
+        }
+
+      pos += sizeof (size_t);
+
+      if ((size_t) (file_size - pos) / c->payload < nrows)
+        {
+          reason = "truncated ntuple file";
+          goto error;
+        }
+
+      if (c->nchunks == nalloc)
+        {
+          size_t n = (nalloc > 0) ? 2 * nalloc : 64;
+          long *o = (long *) realloc (c->chunk_offset, n * sizeof (long));
+          size_t *r;
+
+          if (o)
+            c->chunk_offset = o;
+
+          r = (size_t *) realloc (c->chunk_nrows, n * sizeof (size_t));
+
+          if (r)
+            c->chunk_nrows = r;
+
+          if (o == 0 || r == 0)
+            {
+              reason = "failed to allocate space for ntuple chunk index";
+              status = GSL_ENOMEM;
+              goto error;
+            }
+
+          nalloc = n;
+        }
+
+      c->chunk_offset[c->nchunks] = pos;
+      c->chunk_nrows[c->nchunks] = nrows;
+      c->nchunks++;
+
+      pos += (long) (nrows * c->payload);
+
+      if (fseek (ntuple->file, pos, SEEK_SET) != 0)
+        {
+          reason = "failed to seek in ntuple file";
+          goto error;
+        }
+    }
+
+#ifdef NTUPLE_USE_MMAP
+  {
+    void *map = mmap (0, (size_t) file_size, PROT_READ, MAP_PRIVATE,
+                      fileno (ntuple->file), 0);
+
+    if (map != MAP_FAILED)
+      {
+        c->map = (const char *) map;
+        c->map_size = (size_t) file_size;
+      }
+  }
+#endif
+
+  if (c->map == 0)
+    {
+      /* fall back to reading each chunk with fread */
+
+      c->buf = (char *) malloc (c->chunk_rows * c->payload);
+
+      if (c->buf == 0)
+        {
+          reason = "failed to allocate space for ntuple chunk";
+          status = GSL_ENOMEM;
+          goto error;
+        }
+    }
+
+  return ntuple;
+
+error:
+  fclose (ntuple->file);
+  chunked_free (c);
+  free (ntuple);
+  GSL_ERROR_VAL (reason, status, 0);
+}
+
+static int
+chunked_flush (gsl_ntuple * ntuple)
+{
+  struct gsl_ntuple_chunked_struct *c = ntuple->chunked;
+  size_t nrows = c->nrows;
+
+  if (nrows == 0)
+    return GSL_SUCCESS;
+
+  c->nrows = 0;
+
+  if (fwrite (&nrows, sizeof (size_t), 1, ntuple->file) != 1)
+    {
+      GSL_ERROR ("failed to write ntuple chunk to file", GSL_EFAILED);
+    }
+
+  if (c->columns)
+    {
+      const char *col = c->buf;
+      size_t j;
+
+      for (j = 0; j < c->ncols; j++)
+        {
+          if (fwrite (col, c->width[j], nrows, ntuple->file) != nrows)
+            {
+              GSL_ERROR ("failed to write ntuple chunk to file", GSL_EFAILED);
+            }
+
+          col += c->chunk_rows * c->width[j];
+        }
+    }
+  else if (fwrite (c->buf, ntuple->size, nrows, ntuple->file) != nrows)
+    {
+      GSL_ERROR ("failed to write ntuple chunk to file", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+ntuple_chunked_write (gsl_ntuple * ntuple)
+{
+  struct gsl_ntuple_chunked_struct *c = ntuple->chunked;
+  const char *row = (const char *) ntuple->ntuple_data;
+
+  if (!c->writing)
+    {
+      GSL_ERROR ("ntuple was not opened for writing", GSL_EINVAL);
+    }
+
+  if (c->columns)
+    {
+      char *col = c->buf;
+      size_t j;
+
+      for (j = 0; j < c->ncols; j++)
+        {
+          memcpy (col + c->nrows * c->width[j], row + c->offset[j],
+                  c->width[j]);
+          col += c->chunk_rows * c->width[j];
+        }
+    }
+  else
+    {
+      memcpy (c->buf + c->nrows * ntuple->size, row, ntuple->size);
+    }
+
+  c->nrows++;
+
+  if (c->nrows == c->chunk_rows)
+    return chunked_flush (ntuple);
+
+  return GSL_SUCCESS;
+}
+
+/* load chunk i from the mapping, or from file into buf */
+
+static const char *
+chunk_load (const struct gsl_ntuple_chunked_struct *c, FILE * file,
+            char *buf, size_t i)
+{
+  if (c->map)
+    return c->map + c->chunk_offset[i];
+
+  if (fseek (file, c->chunk_offset[i], SEEK_SET) != 0
+      || fread (buf, c->payload, c->chunk_nrows[i], file) != c->chunk_nrows[i])
+    return 0;
+
+  return buf;
+}
+
+int
+ntuple_chunked_read (gsl_ntuple * ntuple)
+{
+  struct gsl_ntuple_chunked_struct *c = ntuple->chunked;
+
+  if (c->writing)
+    {
+      GSL_ERROR ("ntuple was not opened for reading", GSL_EINVAL);
+    }
+
+  if (c->pos == c->nrows)
+    {
+      if (c->next == c->nchunks)
+        return GSL_EOF;
+
+      c->data = chunk_load (c, ntuple->file, c->buf, c->next);
+
+      if (c->data == 0)
+        {
+          GSL_ERROR ("failed to read ntuple chunk from file", GSL_EFAILED);
+        }
+
+      c->nrows = c->chunk_nrows[c->next];
+      c->pos = 0;
+      c->next++;
+    }
+
+  chunk_get_row (c, c->data, c->nrows, c->pos, (char *) ntuple->ntuple_data,
+                 ntuple->size);
+  c->pos++;
+
+  return GSL_SUCCESS;
+}
+
+int
+ntuple_chunked_close (gsl_ntuple * ntuple)
+{
+  struct gsl_ntuple_chunked_struct *c = ntuple->chunked;
+  int status = GSL_SUCCESS;
+
+  if (c->writing)
+    status = chunked_flush (ntuple);
+
+  if (fclose (ntuple->file))
+    {
+      chunked_free (c);
+      free (ntuple);
+      GSL_ERROR ("failed to close ntuple file", GSL_EFAILED);
+    }
+
+  chunked_free (c);
+  free (ntuple);
+
+  return status;
+}
+
+size_t
+gsl_ntuple_nchunks (const gsl_ntuple * ntuple)
+{
+  const struct gsl_ntuple_chunked_struct *c = ntuple->chunked;
+
+  return (c && !c->writing) ? c->nchunks : 0;
+}
+
+/*
+ * gsl_ntuple_project_chunks:
+ * fill n histograms from the chunks i0 <= i < i1 of a chunked ntuple
+ * file, copying each row to the caller's buffer row.  Only the read-only
+ * chunk index of the ntuple is used, and a private file handle when the
+ * file is not mapped, so different ranges can be projected concurrently
+ * into different histograms.
+ */
+
+int
+gsl_ntuple_project_chunks (const size_t i0, const size_t i1, void *row,
+                           const size_t n, gsl_histogram * h[],
+                           gsl_ntuple * ntuple,
+                           gsl_ntuple_value_fn * value_func[],
+                           gsl_ntuple_select_fn * select_func[])
+{
+  const struct gsl_ntuple_chunked_struct *c = ntuple->chunked;
+  FILE *file = 0;
+  char *buf = 0;
+  size_t i, r, k;
+  int status = GSL_SUCCESS;
+
+  if (c == 0 || c->writing)
+    {
+      GSL_ERROR ("ntuple is not a chunked file opened for reading",
+                 GSL_EINVAL);
+    }
+
+  if (i0 > i1 || i1 > c->nchunks)
+    {
+      GSL_ERROR ("chunk range out of bounds", GSL_EINVAL);
+    }
+
+  if (c->map == 0)
+    {
+      file = fopen (c->filename, "rb");
+
+      if (file == 0)
+        {
+          GSL_ERROR ("unable to open ntuple file for reading", GSL_EFAILED);
+        }
+
+      buf = (char *) malloc (c->chunk_rows * c->payload);
+
+      if (buf == 0)
+        {
+          fclose (file);
+          GSL_ERROR ("failed to allocate space for ntuple chunk", GSL_ENOMEM);
+        }
+    }
+
+  for (i = i0; i < i1; i++)
+    {
+      const size_t nrows = c->chunk_nrows[i];
+      const char *data = chunk_load (c, file, buf, i);
+
+      if (data == 0)
+        {
+          status = GSL_EFAILED;
+          break;
+        }
+
+      for (r = 0; r < nrows; r++)
+        {
+          chunk_get_row (c, data, nrows, r, (char *) row, ntuple->size);
+
+          for (k = 0; k < n; k++)
+            {
+              if (EVAL(select_func[k], row))
+                {
+                  gsl_histogram_increment (h[k], EVAL(value_func[k], row));
+                }
+            }
+        }
+    }
+
+  if (file)
+    fclose (file);
+
+  free (buf);
+
+  if (status)
+    {
+      GSL_ERROR ("failed to read ntuple chunk for projection", status);
+    }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/* ntuple/chunked.h
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* size in bytes of the stdio buffer attached to ntuple files, of the
+   chunks of rows read at once by the projection functions, and of the
+   default chunk of the chunked format */
+
+#define NTUPLE_BUFFER_SIZE 1048576
+
+/* A chunked ntuple file starts with the 8 bytes NTUPLE_MAGIC followed
+   by the size_t values
+
+     version, layout, size, chunk_rows, ncols,
+     offset[0..ncols-1], width[0..ncols-1]
+
+   and then a sequence of chunks, each a size_t row count nrows
+   followed by the rows of the chunk.  In the row layout the nrows
+   rows are stored one after the other.  In the column layout column j
+   (width[j] bytes at offset[j] of the row) is stored for all nrows
+   rows, then column j+1, and so on; bytes of the row outside the
+   columns are not stored.  Plain ntuple files have no header at all. */
+
+#define NTUPLE_MAGIC "GSLNTUPL"
+#define NTUPLE_MAGIC_SIZE 8
+#define NTUPLE_VERSION 1
+
+struct gsl_ntuple_chunked_struct
+{
+  int columns;                  /* 1 for the column layout, 0 for rows */
+  int writing;
+  size_t chunk_rows;            /* maximum number of rows in a chunk */
+  size_t ncols;
+  size_t *offset;               /* offset of each column in the row */
+  size_t *width;                /* width of each column in bytes */
+  size_t payload;               /* bytes stored per row */
+  char *buf;                    /* chunk being written, or read by fread */
+  const char *data;             /* current chunk when reading */
+  size_t nrows;                 /* rows in the current chunk */
+  size_t pos;                   /* next row of the current chunk */
+  size_t nchunks;
+  size_t next;                  /* next chunk to read */
+  long *chunk_offset;           /* file offset of the rows of each chunk */
+  size_t *chunk_nrows;
+  char *filename;
+  const char *map;              /* read-only mapping of the file, or 0 */
+  size_t map_size;
+};
+
+int ntuple_chunked_write (gsl_ntuple * ntuple);
+int ntuple_chunked_read (gsl_ntuple * ntuple);
+int ntuple_chunked_close (gsl_ntuple * ntuple);
@@ -40,10 +40,13 @@
 
 __BEGIN_DECLS
 
+struct gsl_ntuple_chunked_struct;
+
 typedef struct {
     FILE * file;
     void * ntuple_data;
     size_t size;
+    struct gsl_ntuple_chunked_struct * chunked;  /* 0 for plain files */
 } gsl_ntuple;
 
 typedef struct {
@@ -62,6 +65,14 @@ gsl_ntuple_open (char * filename, void * ntuple_data, size_t size);
 gsl_ntuple * 
 gsl_ntuple_create (char * filename, void * ntuple_data, size_t size);
 
+gsl_ntuple *
+gsl_ntuple_open_chunked (char * filename, void * ntuple_data, size_t size);
+
+gsl_ntuple *
+gsl_ntuple_create_chunked (char * filename, void * ntuple_data, size_t size,
+                           size_t chunk_rows, size_t ncols,
+                           const size_t offset[], const size_t width[]);
+
 int gsl_ntuple_write (gsl_ntuple * ntuple);
 int gsl_ntuple_read (gsl_ntuple * ntuple);
 
@@ -71,6 +82,19 @@ int gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
                         gsl_ntuple_value_fn *value_func,
                         gsl_ntuple_select_fn *select_func);
 
+int gsl_ntuple_project_multi (const size_t n, gsl_histogram * h[],
+                              gsl_ntuple * ntuple,
+                              gsl_ntuple_value_fn * value_func[],
+                              gsl_ntuple_select_fn * select_func[]);
+
+size_t gsl_ntuple_nchunks (const gsl_ntuple * ntuple);
+
+int gsl_ntuple_project_chunks (const size_t i0, const size_t i1, void * row,
+                               const size_t n, gsl_histogram * h[],
+                               gsl_ntuple * ntuple,
+                               gsl_ntuple_value_fn * value_func[],
+                               gsl_ntuple_select_fn * select_func[]);
+
 int gsl_ntuple_close (gsl_ntuple * ntuple);
 
 __END_DECLS
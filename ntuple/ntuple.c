@@ -21,9 +21,12 @@
 
 #include <config.h>
 #include <errno.h>
+#include <string.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_ntuple.h>
 
+#include "chunked.h"
+
 /* 
  * gsl_ntuple_open:
  * Initialize an ntuple structure and create the related file
@@ -42,6 +45,7 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
 
   ntuple->ntuple_data = ntuple_data;
   ntuple->size = size;
+  ntuple->chunked = 0;
 
   ntuple->file = fopen (filename, "wb");
 
@@ -51,6 +55,9 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
       GSL_ERROR_VAL ("unable to create ntuple file", GSL_EFAILED, 0);
     }
 
+  /* rows are written one at a time, so buffer them in large blocks */
+  setvbuf (ntuple->file, 0, _IOFBF, NTUPLE_BUFFER_SIZE);
+
   return ntuple;
 }
 
@@ -72,6 +79,7 @@ gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
 
   ntuple->ntuple_data = ntuple_data;
   ntuple->size = size;
+  ntuple->chunked = 0;
 
   ntuple->file = fopen (filename, "rb");
 
@@ -82,6 +90,8 @@ gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
                      GSL_EFAILED, 0);
     }
 
+  setvbuf (ntuple->file, 0, _IOFBF, NTUPLE_BUFFER_SIZE);
+
   return ntuple;
 }
 
@@ -95,6 +105,9 @@ gsl_ntuple_write (gsl_ntuple * ntuple)
 {
   size_t nwrite;
 
+  if (ntuple->chunked)
+    return ntuple_chunked_write (ntuple);
+
   nwrite = fwrite (ntuple->ntuple_data, ntuple->size,
                    1, ntuple->file);
 
@@ -124,6 +137,9 @@ gsl_ntuple_read (gsl_ntuple * ntuple)
 {
   size_t nread;
 
+  if (ntuple->chunked)
+    return ntuple_chunked_read (ntuple);
+
   nread = fread (ntuple->ntuple_data, ntuple->size, 1, ntuple->file);
 
   if (nread == 0 && feof(ntuple->file))
@@ -153,29 +169,84 @@ gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
                     gsl_ntuple_value_fn * value_func, 
                     gsl_ntuple_select_fn * select_func)
 {
-  size_t nread;
+  return gsl_ntuple_project_multi (1, &h, ntuple, &value_func, &select_func);
+}
 
-  do
+/* 
+ * gsl_ntuple_project_multi:
+ * fill n histograms in a single pass over the ntuple file, reading
+ * the rows in large chunks; each row is copied to ntuple_data before
+ * the selection and value functions are called, as for
+ * gsl_ntuple_project
+ */
+
+int
+gsl_ntuple_project_multi (const size_t n, gsl_histogram * h[],
+                          gsl_ntuple * ntuple,
+                          gsl_ntuple_value_fn * value_func[],
+                          gsl_ntuple_select_fn * select_func[])
+{
+  const size_t size = ntuple->size;
+  size_t nchunk, nread, i, k;
+  char *chunk;
+
+  if (ntuple->chunked)
     {
-      nread = fread (ntuple->ntuple_data, ntuple->size,
-                     1, ntuple->file);
+      int status;
 
-      if (nread == 0 && feof(ntuple->file))
+      while ((status = ntuple_chunked_read (ntuple)) == GSL_SUCCESS)
         {
-          break ;
+          for (k = 0; k < n; k++)
+            {
+              if (EVAL(select_func[k], ntuple->ntuple_data))
+                {
+                  gsl_histogram_increment (h[k], EVAL(value_func[k], ntuple->ntuple_data));
+                }
+            }
         }
-      
-      if (nread != 1) 
+
+      return (status == GSL_EOF) ? GSL_SUCCESS : status;
+    }
+
+  if (size == 0)
+    {
+      GSL_ERROR ("ntuple row size must be positive", GSL_EINVAL);
+    }
+
+  nchunk = (size < NTUPLE_BUFFER_SIZE) ? NTUPLE_BUFFER_SIZE / size : 1;
+  chunk = (char *) malloc (nchunk * size);
+
+  if (chunk == 0)
+    {
+      GSL_ERROR ("failed to allocate space for ntuple chunk", GSL_ENOMEM);
+    }
+
+  do
+    {
+      nread = fread (chunk, size, nchunk, ntuple->file);
+
+      if (nread < nchunk && ferror (ntuple->file))
         {
+          free (chunk);
           GSL_ERROR ("failed to read ntuple for projection", GSL_EFAILED);
         }
 
-      if (EVAL(select_func, ntuple->ntuple_data))
+      for (i = 0; i < nread; i++)
         {
-          gsl_histogram_increment (h, EVAL(value_func, ntuple->ntuple_data));
+          memcpy (ntuple->ntuple_data, chunk + i * size, size);
+
+          for (k = 0; k < n; k++)
+            {
+              if (EVAL(select_func[k], ntuple->ntuple_data))
+                {
+                  gsl_histogram_increment (h[k], EVAL(value_func[k], ntuple->ntuple_data));
+                }
+            }
         }
     }
-  while (1);
+  while (nread == nchunk);
+
+  free (chunk);
 
   return GSL_SUCCESS;
 }
@@ -189,7 +260,12 @@ gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
 int
 gsl_ntuple_close (gsl_ntuple * ntuple)
 {
-  int status = fclose (ntuple->file);
+  int status;
+
+  if (ntuple->chunked)
+    return ntuple_chunked_close (ntuple);
+
+  status = fclose (ntuple->file);
   
   if (status)
     {
@@ -1,4 +1,5 @@
 #include <config.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <gsl/gsl_ntuple.h>
@@ -14,6 +15,8 @@ struct data
 };
 int sel_func (void *ntuple_data, void * params);
 double val_func (void *ntuple_data, void * params);
+int sel_all (void *ntuple_data, void * params);
+double val_x (void *ntuple_data, void * params);
 
 int
 main (void)
@@ -136,6 +139,222 @@ main (void)
     gsl_histogram_free (h);
   }
 
+  {
+    int status = 0;
+
+    gsl_ntuple *ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, 
+                                          sizeof (ntuple_row));
+
+    gsl_histogram *h[2], *href;
+    gsl_ntuple_select_fn S_all, *Sk[2];
+    gsl_ntuple_value_fn V_x, *Vk[2];
+
+    S_all.function = &sel_all;
+    S_all.params = 0;
+    V_x.function = &val_x;
+    V_x.params = 0;
+
+    Sk[0] = &S; Vk[0] = &V;
+    Sk[1] = &S_all; Vk[1] = &V_x;
+
+    h[0] = gsl_histogram_calloc_uniform (100, 0., 1.);
+    h[1] = gsl_histogram_calloc_uniform (100, 0., 1.);
+    href = gsl_histogram_calloc_uniform (100, 0., 1.);
+
+    for (i = 0; i < 1000; i++)
+      {
+        gsl_histogram_increment (href, x[i]);
+      }
+
+    gsl_ntuple_project_multi (2, h, ntuple, Vk, Sk);
+
+    gsl_ntuple_close (ntuple);
+
+    for (i = 0; i < 100; i++)
+      {
+        if (h[0]->bin[i] != f[i] || h[1]->bin[i] != href->bin[i])
+          {
+            status = 1;
+          }
+      }
+
+    gsl_test (status, "histogramming ntuples in one pass");
+
+    gsl_histogram_free (h[0]);
+    gsl_histogram_free (h[1]);
+    gsl_histogram_free (href);
+  }
+
+  /* chunked files, with rows and with columns in each chunk */
+
+  {
+    const size_t offset[4] = { offsetof (struct data, num),
+                               offsetof (struct data, x),
+                               offsetof (struct data, y),
+                               offsetof (struct data, z) };
+    const size_t width[4] = { sizeof (int), sizeof (double),
+                              sizeof (double), sizeof (double) };
+    int layout;
+
+    for (layout = 0; layout < 2; layout++)
+      {
+        char *file = layout ? "test_cols.dat" : "test_rows.dat";
+        const size_t ncols = layout ? 4 : 0;
+        const char *desc = layout ? "columns" : "rows";
+        int status = 0;
+        size_t nchunks;
+
+        gsl_ntuple *ntuple = gsl_ntuple_create_chunked (file, &ntuple_row,
+                                                        sizeof (ntuple_row),
+                                                        64, ncols,
+                                                        offset, width);
+
+        for (i = 0; i < 1000; i++)
+          {
+            ntuple_row.num = i;
+            ntuple_row.x = x[i];
+            ntuple_row.y = y[i];
+            ntuple_row.z = z[i];
+
+            status |= gsl_ntuple_write (ntuple);
+          }
+
+        status |= gsl_ntuple_close (ntuple);
+
+        gsl_test (status, "writing chunked ntuples, %s", desc);
+
+        status = 0;
+        ntuple = gsl_ntuple_open_chunked (file, &ntuple_row,
+                                          sizeof (ntuple_row));
+
+        for (i = 0; i < 1000; i++)
+          {
+            status |= gsl_ntuple_read (ntuple);
+            status |= (ntuple_row.num != i);
+            status |= (ntuple_row.x != x[i]);
+            status |= (ntuple_row.y != y[i]);
+            status |= (ntuple_row.z != z[i]);
+          }
+
+        status |= (gsl_ntuple_read (ntuple) != GSL_EOF);
+
+        gsl_ntuple_close (ntuple);
+
+        gsl_test (status, "reading chunked ntuples, %s", desc);
+
+        {
+          gsl_histogram *h[2], *hc[2], *href;
+          gsl_ntuple_select_fn S_all, *Sk[2];
+          gsl_ntuple_value_fn V_x, *Vk[2];
+          struct data row;
+          size_t k;
+
+          S_all.function = &sel_all;
+          S_all.params = 0;
+          V_x.function = &val_x;
+          V_x.params = 0;
+
+          Sk[0] = &S; Vk[0] = &V;
+          Sk[1] = &S_all; Vk[1] = &V_x;
+
+          href = gsl_histogram_calloc_uniform (100, 0., 1.);
+
+          for (i = 0; i < 1000; i++)
+            {
+              gsl_histogram_increment (href, x[i]);
+            }
+
+          for (k = 0; k < 2; k++)
+            {
+              h[k] = gsl_histogram_calloc_uniform (100, 0., 1.);
+              hc[k] = gsl_histogram_calloc_uniform (100, 0., 1.);
+            }
+
+          ntuple = gsl_ntuple_open_chunked (file, &ntuple_row,
+                                            sizeof (ntuple_row));
+
+          nchunks = gsl_ntuple_nchunks (ntuple);
+          gsl_test_int (nchunks, 16, "number of ntuple chunks, %s", desc);
+
+          status = 0;
+          status |= gsl_ntuple_project_multi (2, h, ntuple, Vk, Sk);
+
+          for (i = 0; i < 100; i++)
+            {
+              if (h[0]->bin[i] != f[i] || h[1]->bin[i] != href->bin[i])
+                {
+                  status = 1;
+                }
+            }
+
+          gsl_test (status, "histogramming chunked ntuples, %s", desc);
+
+          /* project two ranges of chunks into separate histograms, as
+             two threads would, and add them */
+
+          status = 0;
+          memset (&row, 0, sizeof (row));
+
+          status |= gsl_ntuple_project_chunks (0, 5, &row, 2, h, ntuple,
+                                               Vk, Sk);
+          status |= gsl_ntuple_project_chunks (5, nchunks, &row, 2, hc,
+                                               ntuple, Vk, Sk);
+
+          gsl_ntuple_close (ntuple);
+
+          for (k = 0; k < 2; k++)
+            {
+              gsl_histogram_add (hc[k], h[k]);
+            }
+
+          for (i = 0; i < 100; i++)
+            {
+              if (hc[0]->bin[i] != 2 * f[i]
+                  || hc[1]->bin[i] != 2 * href->bin[i])
+                {
+                  status = 1;
+                }
+            }
+
+          gsl_test (status, "histogramming ranges of ntuple chunks, %s",
+                    desc);
+
+          for (k = 0; k < 2; k++)
+            {
+              gsl_histogram_free (h[k]);
+              gsl_histogram_free (hc[k]);
+            }
+
+          gsl_histogram_free (href);
+        }
+      }
+  }
+
+  /* invalid arguments */
+
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+    gsl_histogram *h = gsl_histogram_calloc_uniform (100, 0., 1.);
+    gsl_ntuple *ntuple;
+    int status;
+
+    ntuple = gsl_ntuple_open_chunked ("test.dat", &ntuple_row,
+                                      sizeof (ntuple_row));
+    gsl_test (ntuple != 0, "opening a plain ntuple file as chunked");
+
+    ntuple = gsl_ntuple_open_chunked ("test_rows.dat", &ntuple_row,
+                                      sizeof (ntuple_row) / 2);
+    gsl_test (ntuple != 0, "opening a chunked ntuple with the wrong size");
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, 0);
+    status = gsl_ntuple_project (h, ntuple, &V, &S);
+    gsl_ntuple_close (ntuple);
+    gsl_test_int (status, GSL_EINVAL, "projecting ntuples of size zero");
+
+    gsl_histogram_free (h);
+    gsl_set_error_handler (old_handler);
+  }
+
   exit (gsl_test_summary());
 }
 
@@ -164,3 +383,15 @@ val_func (void *ntuple_data, void * params)
 
   return (x + y + z) * scale;
 }
+
+int
+sel_all (void *ntuple_data, void * params)
+{
+  return 1;
+}
+
+double
+val_x (void *ntuple_data, void * params)
+{
+  return ((struct data *) ntuple_data)->x;
+}
@@ -0,0 +1,171 @@
+/* poly/eval_array.c
+ * 
+ * Copyright (C) 2014 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_poly.h>
+
+/* Evaluate a polynomial at many points with Horner's rule.  The
+   points are taken in blocks of POLY_BLOCK, with the loop over the
+   coefficients outside the loop over the points of a block, so that
+   the recurrences for the different points are independent and can
+   be pipelined or vectorized.  The operations for each point are the
+   same as in gsl_poly_eval, so the results are identical. */
+
+#define POLY_BLOCK 8
+
+int
+gsl_poly_eval_array (const double c[], const int len,
+                     const double x[], const size_t xstride,
+                     double res[], const size_t rstride, const size_t n)
+{
+  size_t p, p0;
+  int i;
+
+  if (len < 1)
+    {
+      GSL_ERROR ("polynomial length must be positive", GSL_EINVAL);
+    }
+
+  for (p0 = 0; p0 < n; p0 += POLY_BLOCK)
+    {
+      const size_t nb = GSL_MIN (POLY_BLOCK, n - p0);
+      double xb[POLY_BLOCK], ans[POLY_BLOCK];
+
+      for (p = 0; p < nb; p++)
+        {
+          xb[p] = x[(p0 + p) * xstride];
+          ans[p] = c[len - 1];
+        }
+
+      for (i = len - 1; i > 0; i--)
+        {
+          const double ci = c[i - 1];
+
+          for (p = 0; p < nb; p++)
+            ans[p] = ci + xb[p] * ans[p];
+        }
+
+      for (p = 0; p < nb; p++)
+        res[(p0 + p) * rstride] = ans[p];
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* As above, also computing the first derivative with the recurrence
+   d <- ans + x d, which is run before ans is updated */
+
+int
+gsl_poly_eval_deriv_array (const double c[], const int len,
+                           const double x[], const size_t xstride,
+                           double res[], double dres[],
+                           const size_t rstride, const size_t n)
+{
+  size_t p, p0;
+  int i;
+
+  if (len < 1)
+    {
+      GSL_ERROR ("polynomial length must be positive", GSL_EINVAL);
+    }
+
+  for (p0 = 0; p0 < n; p0 += POLY_BLOCK)
+    {
+      const size_t nb = GSL_MIN (POLY_BLOCK, n - p0);
+      double xb[POLY_BLOCK], ans[POLY_BLOCK], d[POLY_BLOCK];
+
+      for (p = 0; p < nb; p++)
+        {
+          xb[p] = x[(p0 + p) * xstride];
+          ans[p] = c[len - 1];
+          d[p] = 0.0;
+        }
+
+      for (i = len - 1; i > 0; i--)
+        {
+          const double ci = c[i - 1];
+
+          for (p = 0; p < nb; p++)
+            {
+              d[p] = ans[p] + xb[p] * d[p];
+              ans[p] = ci + xb[p] * ans[p];
+            }
+        }
+
+      for (p = 0; p < nb; p++)
+        {
+          res[(p0 + p) * rstride] = ans[p];
+          dres[(p0 + p) * rstride] = d[p];
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* real polynomial at complex points, as gsl_poly_complex_eval */
+
+int
+gsl_poly_complex_eval_array (const double c[], const int len,
+                             const gsl_complex z[], const size_t zstride,
+                             gsl_complex res[], const size_t rstride,
+                             const size_t n)
+{
+  size_t p, p0;
+  int i;
+
+  if (len < 1)
+    {
+      GSL_ERROR ("polynomial length must be positive", GSL_EINVAL);
+    }
+
+  for (p0 = 0; p0 < n; p0 += POLY_BLOCK)
+    {
+      const size_t nb = GSL_MIN (POLY_BLOCK, n - p0);
+      double zr[POLY_BLOCK], zi[POLY_BLOCK];
+      double ar[POLY_BLOCK], ai[POLY_BLOCK];
+
+      for (p = 0; p < nb; p++)
+        {
+          zr[p] = GSL_REAL (z[(p0 + p) * zstride]);
+          zi[p] = GSL_IMAG (z[(p0 + p) * zstride]);
+          ar[p] = c[len - 1];
+          ai[p] = 0.0;
+        }
+
+      for (i = len - 1; i > 0; i--)
+        {
+          const double ci = c[i - 1];
+
+          for (p = 0; p < nb; p++)
+            {
+              double tmp = ci + zr[p] * ar[p] - zi[p] * ai[p];
+              ai[p] = zi[p] * ar[p] + zr[p] * ai[p];
+              ar[p] = tmp;
+            }
+        }
+
+      for (p = 0; p < nb; p++)
+        GSL_SET_COMPLEX (&res[(p0 + p) * rstride], ar[p], ai[p]);
+    }
+
+  return GSL_SUCCESS;
+}
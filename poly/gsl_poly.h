@@ -55,6 +55,15 @@ INLINE_DECL gsl_complex gsl_complex_poly_complex_eval (const gsl_complex c [], c
 
 int gsl_poly_eval_derivs(const double c[], const size_t lenc, const double x, double res[], const size_t lenres);
 
+/* Evaluate a real polynomial at n points x[i*xstride], storing the
+ * values (and first derivatives) in res[i*rstride] (dres[i*rstride])
+ */
+int gsl_poly_eval_array(const double c[], const int len, const double x[], const size_t xstride, double res[], const size_t rstride, const size_t n);
+int gsl_poly_eval_deriv_array(const double c[], const int len, const double x[], const size_t xstride, double res[], double dres[], const size_t rstride, const size_t n);
+
+/* Evaluate a real polynomial at n complex points z[i*zstride] */
+int gsl_poly_complex_eval_array(const double c[], const int len, const gsl_complex z[], const size_t zstride, gsl_complex res[], const size_t rstride, const size_t n);
+
 #ifdef HAVE_INLINE
 INLINE_FUN
 double 
@@ -178,6 +187,44 @@ gsl_poly_complex_solve (const double * a, size_t n,
                         gsl_poly_complex_workspace * w,
                         gsl_complex_packed_ptr z);
 
+/* Solve for the complex roots of a general real polynomial by the
+ * Aberth-Ehrlich simultaneous iteration, for high degrees
+ */
+
+typedef struct
+{
+  size_t nc ;
+  size_t niter ;
+  size_t nzero ;
+  double * znew ;
+  size_t * hull ;
+  int * converged ;
+}
+gsl_poly_complex_aberth_workspace ;
+
+gsl_poly_complex_aberth_workspace * gsl_poly_complex_aberth_workspace_alloc (size_t n);
+void gsl_poly_complex_aberth_workspace_free (gsl_poly_complex_aberth_workspace * w);
+
+int
+gsl_poly_complex_solve_aberth (const double * a, size_t n,
+                               gsl_poly_complex_aberth_workspace * w,
+                               gsl_complex_packed_ptr z);
+
+int
+gsl_poly_complex_aberth_init (const double * a, size_t n,
+                              gsl_poly_complex_aberth_workspace * w,
+                              gsl_complex_packed_ptr z);
+
+int
+gsl_poly_complex_aberth_sweep (const double * a, size_t n,
+                               gsl_const_complex_packed_ptr z,
+                               size_t i0, size_t i1,
+                               gsl_poly_complex_aberth_workspace * w);
+
+int
+gsl_poly_complex_aberth_update (gsl_poly_complex_aberth_workspace * w,
+                                gsl_complex_packed_ptr z);
+
 __END_DECLS
 
 #endif /* __GSL_POLY_H__ */
@@ -32,6 +32,41 @@ cmp_cplx(const double *a, const double *b)
 	return t < 0.0 ? -1 : t > 0.0 ? 1 : 0;
 }
 
+/* largest distance from each expected root to the nearest computed
+   root not already matched */
+static double
+match_roots (const double *z, const double *expected, size_t n)
+{
+  int *used = (int *) calloc (n, sizeof (int));
+  double dmax = 0.0;
+  size_t i, j;
+
+  for (i = 0; i < n; i++)
+    {
+      size_t jmin = 0;
+      double dmin = GSL_POSINF;
+
+      for (j = 0; j < n; j++)
+        {
+          double d = hypot (z[2 * j] - expected[2 * i],
+                            z[2 * j + 1] - expected[2 * i + 1]);
+
+          if (!used[j] && d < dmin)
+            {
+              dmin = d;
+              jmin = j;
+            }
+        }
+
+      used[jmin] = 1;
+      dmax = GSL_MAX_DBL (dmax, dmin);
+    }
+
+  free (used);
+
+  return dmax;
+}
+
 int
 main (void)
 {
@@ -574,6 +609,107 @@ main (void)
   }
 
 
+  {
+    /* Aberth-Ehrlich iteration, checked against known roots */
+
+    double a5[6] = { -120, 274, -225, 85, -15, 1 };
+    double e5[5 * 2] = { 1, 0, 2, 0, 3, 0, 4, 0, 5, 0 };
+
+    /* x^2 (x - 1) (x + 2) */
+    double a4[5] = { 0, 0, -2, 1, 1 };
+    double e4[4 * 2] = { 0, 0, 0, 0, 1, 0, -2, 0 };
+
+    double a15[16] = { 32, -48, -8, 28, -8, 16, -16, 12, -16, 6, 10, -17, 10, 2, -4, 1 };
+    double z[1000 * 2], e[1000 * 2], b[1001];
+    size_t i, n = 1000;
+    int status;
+
+    gsl_poly_complex_aberth_workspace *w;
+
+    w = gsl_poly_complex_aberth_workspace_alloc (6);
+    status = gsl_poly_complex_solve_aberth (a5, 6, w, z);
+    gsl_test (status, "gsl_poly_complex_solve_aberth, 5th-order Wilkinson polynomial");
+    gsl_test_abs (match_roots (z, e5, 5), 0.0, 1e-9,
+                  "gsl_poly_complex_solve_aberth, 5th-order roots");
+    gsl_poly_complex_aberth_workspace_free (w);
+
+    w = gsl_poly_complex_aberth_workspace_alloc (5);
+    status = gsl_poly_complex_solve_aberth (a4, 5, w, z);
+    gsl_test (status, "gsl_poly_complex_solve_aberth, zero roots");
+    gsl_test_abs (match_roots (z, e4, 4), 0.0, 1e-12,
+                  "gsl_poly_complex_solve_aberth, zero roots");
+    gsl_poly_complex_aberth_workspace_free (w);
+
+    /* compare with the companion matrix solver on bug #39055, whose
+       double roots are only accurate to O(sqrt(eps)) */
+    {
+      gsl_poly_complex_workspace *wc = gsl_poly_complex_workspace_alloc (16);
+      gsl_poly_complex_solve (a15, 16, wc, e);
+      gsl_poly_complex_workspace_free (wc);
+    }
+
+    w = gsl_poly_complex_aberth_workspace_alloc (16);
+    status = gsl_poly_complex_solve_aberth (a15, 16, w, z);
+    gsl_test (status, "gsl_poly_complex_solve_aberth, 15th-order polynomial");
+    gsl_test_abs (match_roots (z, e, 15), 0.0, 1e-6,
+                  "gsl_poly_complex_solve_aberth, 15th-order roots");
+    gsl_poly_complex_aberth_workspace_free (w);
+
+    /* 3 x^1000 - 3, roots of unity */
+
+    for (i = 0; i <= n; i++)
+      b[i] = 0.0;
+
+    b[0] = -3.0;
+    b[n] = 3.0;
+
+    for (i = 0; i < n; i++)
+      {
+        e[2 * i] = cos (2 * M_PI * i / n);
+        e[2 * i + 1] = sin (2 * M_PI * i / n);
+      }
+
+    w = gsl_poly_complex_aberth_workspace_alloc (n + 1);
+    status = gsl_poly_complex_solve_aberth (b, n + 1, w, z);
+    gsl_test (status, "gsl_poly_complex_solve_aberth, 1000th-order polynomial");
+    gsl_test_abs (match_roots (z, e, n), 0.0, 1e-12,
+                  "gsl_poly_complex_solve_aberth, 1000th-order roots");
+
+    /* sweeping the roots in blocks, in any order, must reproduce the
+       serial driver exactly */
+    {
+      static double z2[1000 * 2];
+      const size_t niter = w->niter, nb = 64;
+      size_t i0;
+      int differ = 0;
+
+      gsl_poly_complex_aberth_init (b, n + 1, w, z2);
+
+      do
+        {
+          for (i0 = (n - 1) / nb * nb;; i0 -= nb)
+            {
+              gsl_poly_complex_aberth_sweep (b, n + 1, z2, i0,
+                                             GSL_MIN (i0 + nb, n), w);
+              if (i0 == 0)
+                break;
+            }
+
+          status = gsl_poly_complex_aberth_update (w, z2);
+        }
+      while (status == GSL_CONTINUE && w->niter < 200);
+
+      for (i = 0; i < 2 * n; i++)
+        differ |= (z2[i] != z[i]);
+
+      gsl_test (status, "gsl_poly_complex_aberth_sweep, blocked status");
+      gsl_test (differ || w->niter != niter,
+                "gsl_poly_complex_aberth_sweep, blocked sweeps match solver");
+    }
+
+    gsl_poly_complex_aberth_workspace_free (w);
+  }
+
   {
     int i;
 
@@ -662,6 +798,54 @@ main (void)
     gsl_test_rel (dc[5], 5.0*4.0*3.0*2.0*c[5] , eps, "gsl_poly_eval_derivs({+1, -2, +3, -4, +5, -6} deriv 5, -720.0)");
   }
 
+  {
+    /* array evaluation must agree exactly with single point Horner */
+    double c[7] = { +1.0, -2.0, +3.0, -4.0, +5.0, -6.0, +0.5 };
+    double x[2 * 21], y[21], dy[21], dc[2];
+    gsl_complex z[21], w[21];
+    int k, len;
+
+    for (k = 0; k < 21; k++)
+      {
+        x[2 * k] = -1.3 + 0.13 * k;
+        x[2 * k + 1] = 99.0;
+        GSL_SET_COMPLEX (&z[k], -1.3 + 0.13 * k, 0.7 - 0.05 * k);
+      }
+
+    for (len = 1; len <= 7; len++)
+      {
+        int s1 = 0, s2 = 0, s3 = 0;
+
+        gsl_poly_eval_array (c, len, x, 2, y, 1, 21);
+
+        for (k = 0; k < 21; k++)
+          s1 |= (y[k] != gsl_poly_eval (c, len, x[2 * k]));
+
+        gsl_test (s1, "gsl_poly_eval_array, len = %d", len);
+
+        gsl_poly_eval_deriv_array (c, len, x, 2, y, dy, 1, 21);
+
+        for (k = 0; k < 21; k++)
+          {
+            gsl_poly_eval_derivs (c, len, x[2 * k], dc, 2);
+            s2 |= (y[k] != gsl_poly_eval (c, len, x[2 * k]));
+            s2 |= (fabs (dy[k] - (len > 1 ? dc[1] : 0.0)) > 1e-12 * (1 + fabs (dc[1])));
+          }
+
+        gsl_test (s2, "gsl_poly_eval_deriv_array, len = %d", len);
+
+        gsl_poly_complex_eval_array (c, len, z, 1, w, 1, 21);
+
+        for (k = 0; k < 21; k++)
+          {
+            gsl_complex r = gsl_poly_complex_eval (c, len, z[k]);
+            s3 |= (GSL_REAL (w[k]) != GSL_REAL (r));
+            s3 |= (GSL_IMAG (w[k]) != GSL_IMAG (r));
+          }
+
+        gsl_test (s3, "gsl_poly_complex_eval_array, len = %d", len);
+      }
+  }
 
   /* now summarize the results */
 
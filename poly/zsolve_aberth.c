@@ -0,0 +1,411 @@
+/* poly/zsolve_aberth.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* zsolve_aberth.c - finds the complex roots of a real polynomial by
+   the Aberth-Ehrlich simultaneous iteration, see D.A. Bini, "Numerical
+   computation of polynomial zeros by means of Aberth's method",
+   Numerical Algorithms 13 (1996), 179-200.
+
+   The starting points are placed on circles whose radii are given by
+   the upper convex hull of the points (i, log|a_i|) (the Newton
+   polygon).  Each sweep computes the corrections of all the roots
+   from the previous approximations (Jacobi style), so the updates of
+   the different roots are independent of each other.  A root is
+   frozen once |p(z)| is within the rounding error bound of Horner's
+   rule.  The sweep is exposed as gsl_poly_complex_aberth_sweep so
+   that callers can divide the roots between threads, with
+   gsl_poly_complex_solve_aberth as the serial driver.  For |z| > 1 the reversed polynomial is evaluated at 1/z so
+   that no powers of z overflow, which allows very high degrees.  Each
+   sweep costs O(n^2) operations with O(n) memory. */
+
+#include <config.h>
+#include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_poly.h>
+
+#define ABERTH_MAXITER 200
+
+/* offset of the starting points from the real axis */
+#define ABERTH_SIGMA 0.7
+
+gsl_poly_complex_aberth_workspace *
+gsl_poly_complex_aberth_workspace_alloc (size_t n)
+{
+  gsl_poly_complex_aberth_workspace *w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("matrix size n must be positive integer", GSL_EDOM, 0);
+    }
+
+  w = (gsl_poly_complex_aberth_workspace *)
+    calloc (1, sizeof (gsl_poly_complex_aberth_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for struct", GSL_ENOMEM, 0);
+    }
+
+  w->nc = n - 1;
+  w->niter = 0;
+  w->nzero = 0;
+
+  w->znew = (double *) malloc (2 * n * sizeof (double));
+  w->hull = (size_t *) malloc (n * sizeof (size_t));
+  w->converged = (int *) malloc (n * sizeof (int));
+
+  if (w->znew == 0 || w->hull == 0 || w->converged == 0)
+    {
+      gsl_poly_complex_aberth_workspace_free (w);
+      GSL_ERROR_VAL ("failed to allocate space for workspace arrays",
+                     GSL_ENOMEM, 0);
+    }
+
+  return w;
+}
+
+void
+gsl_poly_complex_aberth_workspace_free (gsl_poly_complex_aberth_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w->znew);
+  free (w->hull);
+  free (w->converged);
+  free (w);
+}
+
+/* Place the d starting points on the circles given by the upper
+   convex hull of (i, log|a_i|), i = 0..d */
+
+static void
+aberth_start (const double *a, size_t d, size_t * hull, double *z)
+{
+  size_t i, h = 0, m = 0;
+
+  for (i = 0; i <= d; i++)
+    {
+      if (a[i] == 0.0)
+        continue;
+
+      while (h >= 2)
+        {
+          const size_t o = hull[h - 2], p = hull[h - 1];
+          const double cross =
+            (p - (double) o) * (log (fabs (a[i])) - log (fabs (a[o])))
+            - (log (fabs (a[p])) - log (fabs (a[o]))) * (i - (double) o);
+
+          if (cross < 0)
+            break;
+
+          h--;
+        }
+
+      hull[h++] = i;
+    }
+
+  for (i = 0; i + 1 < h; i++)
+    {
+      const size_t k = hull[i], l = hull[i + 1], nk = l - k;
+      const double u = pow (fabs (a[k] / a[l]), 1.0 / nk);
+      size_t j;
+
+      for (j = 0; j < nk; j++)
+        {
+          const double theta = 2 * M_PI * ((double) j / nk + (double) k / d)
+            + ABERTH_SIGMA;
+
+          z[2 * m] = u * cos (theta);
+          z[2 * m + 1] = u * sin (theta);
+          m++;
+        }
+    }
+}
+
+/* Compute the Newton correction p(z)/p'(z) in (nr, ni), returning 1 if
+   z is already a root to within the rounding errors of evaluation */
+
+static int
+aberth_newton (const double *a, size_t d, double zr, double zi,
+               double *nr, double *ni)
+{
+  const int reverse = (zr * zr + zi * zi > 1.0);
+  const double eps = GSL_DBL_EPSILON;
+  double xr = zr, xi = zi, ax;
+  double pr, pi, dr = 0.0, di = 0.0, bound;
+  size_t k;
+
+  if (reverse)
+    {
+      /* x = 1/z, and the coefficients are taken in reverse order */
+      const double s = zr * zr + zi * zi;
+      xr = zr / s;
+      xi = -zi / s;
+    }
+
+  ax = hypot (xr, xi);
+
+  pr = reverse ? a[0] : a[d];
+  pi = 0.0;
+  bound = fabs (pr) * (4.0 * d + 1);
+
+  for (k = d; k-- > 0;)
+    {
+      const double ck = reverse ? a[d - k] : a[k];
+      double tmp;
+
+      tmp = dr * xr - di * xi + pr;
+      di = dr * xi + di * xr + pi;
+      dr = tmp;
+
+      tmp = pr * xr - pi * xi + ck;
+      pi = pr * xi + pi * xr;
+      pr = tmp;
+
+      bound = bound * ax + fabs (ck) * (4.0 * k + 1);
+    }
+
+  if (hypot (pr, pi) <= eps * bound)
+    {
+      return 1;
+    }
+
+  if (!reverse)
+    {
+      /* p/p' */
+      const double s = dr * dr + di * di;
+      *nr = (pr * dr + pi * di) / s;
+      *ni = (pi * dr - pr * di) / s;
+    }
+  else
+    {
+      /* with q the reversed polynomial and x = 1/z,
+         p/p' = 1 / (x (d - x q'/q)) */
+      const double s = pr * pr + pi * pi;
+      const double qr = (dr * pr + di * pi) / s;
+      const double qi = (di * pr - dr * pi) / s;
+      const double er = d - (xr * qr - xi * qi);
+      const double ei = -(xr * qi + xi * qr);
+      const double fr = xr * er - xi * ei;
+      const double fi = xr * ei + xi * er;
+      const double t = fr * fr + fi * fi;
+      *nr = fr / t;
+      *ni = -fi / t;
+    }
+
+  return 0;
+}
+
+/* Check the arguments, store the exact roots at the origin and place
+   the starting points of the others */
+
+int
+gsl_poly_complex_aberth_init (const double *a, size_t n,
+                              gsl_poly_complex_aberth_workspace * w,
+                              gsl_complex_packed_ptr z)
+{
+  size_t nzero = 0, i;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("number of terms must be a positive integer", GSL_EINVAL);
+    }
+
+  if (n == 1)
+    {
+      GSL_ERROR ("cannot solve for only one term", GSL_EINVAL);
+    }
+
+  if (a[n - 1] == 0)
+    {
+      GSL_ERROR ("leading term of polynomial must be non-zero", GSL_EINVAL);
+    }
+
+  if (w->nc != n - 1)
+    {
+      GSL_ERROR ("size of workspace does not match polynomial", GSL_EINVAL);
+    }
+
+  /* roots at the origin are exact */
+
+  while (a[nzero] == 0.0)
+    {
+      z[2 * nzero] = 0.0;
+      z[2 * nzero + 1] = 0.0;
+      w->converged[nzero] = 1;
+      nzero++;
+    }
+
+  w->nzero = nzero;
+  w->niter = 0;
+
+  if (nzero < n - 1)
+    {
+      aberth_start (a + nzero, n - 1 - nzero, w->hull, z + 2 * nzero);
+    }
+
+  for (i = nzero; i < n - 1; i++)
+    {
+      w->converged[i] = 0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Compute the Aberth corrections of the roots i0 <= i < i1 from the
+   current approximations z, storing the new approximations in w->znew.
+   The roots are independent of each other: a sweep over a range only
+   reads z and writes the entries of w->znew and w->converged for that
+   range, so disjoint ranges can be computed concurrently */
+
+int
+gsl_poly_complex_aberth_sweep (const double *a, size_t n,
+                               gsl_const_complex_packed_ptr z,
+                               size_t i0, size_t i1,
+                               gsl_poly_complex_aberth_workspace * w)
+{
+  const size_t nzero = w->nzero;
+  const size_t d = n - 1 - nzero;
+  const double *zz = z + 2 * nzero;
+  size_t i, j;
+
+  if (w->nc != n - 1)
+    {
+      GSL_ERROR ("size of workspace does not match polynomial", GSL_EINVAL);
+    }
+
+  if (i0 > i1 || i1 > n - 1)
+    {
+      GSL_ERROR ("root range must satisfy i0 <= i1 <= n - 1", GSL_EINVAL);
+    }
+
+  a += nzero;
+
+  for (i = GSL_MAX (i0, nzero); i < i1; i++)
+    {
+      const size_t r = i - nzero;
+      const double zr = zz[2 * r], zi = zz[2 * r + 1];
+      double nr, ni, sr = 0.0, si = 0.0;
+
+      w->znew[2 * i] = zr;
+      w->znew[2 * i + 1] = zi;
+
+      if (w->converged[i])
+        continue;
+
+      if (aberth_newton (a, d, zr, zi, &nr, &ni))
+        {
+          w->converged[i] = 1;
+          continue;
+        }
+
+      /* sum of 1/(z_i - z_j) over the other roots */
+
+      for (j = 0; j < d; j++)
+        {
+          double er, ei, t;
+
+          if (j == r)
+            continue;
+
+          er = zr - zz[2 * j];
+          ei = zi - zz[2 * j + 1];
+          t = er * er + ei * ei;
+          sr += er / t;
+          si -= ei / t;
+        }
+
+      /* correction N / (1 - N S) */
+      {
+        const double br = 1.0 - (nr * sr - ni * si);
+        const double bi = -(nr * si + ni * sr);
+        const double t = br * br + bi * bi;
+
+        w->znew[2 * i] = zr - (nr * br + ni * bi) / t;
+        w->znew[2 * i + 1] = zi - (ni * br - nr * bi) / t;
+      }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Copy the new approximations of a completed sweep into z.  Returns
+   GSL_SUCCESS once every root has converged and GSL_CONTINUE
+   otherwise */
+
+int
+gsl_poly_complex_aberth_update (gsl_poly_complex_aberth_workspace * w,
+                                gsl_complex_packed_ptr z)
+{
+  const size_t nroots = w->nc;
+  size_t i, nconv = 0;
+
+  for (i = w->nzero; i < nroots; i++)
+    {
+      z[2 * i] = w->znew[2 * i];
+      z[2 * i + 1] = w->znew[2 * i + 1];
+    }
+
+  for (i = 0; i < nroots; i++)
+    {
+      nconv += (w->converged[i] != 0);
+    }
+
+  w->niter++;
+
+  return (nconv == nroots) ? GSL_SUCCESS : GSL_CONTINUE;
+}
+
+/* Serial driver: sweeps over all the roots until they have converged */
+
+int
+gsl_poly_complex_solve_aberth (const double *a, size_t n,
+                               gsl_poly_complex_aberth_workspace * w,
+                               gsl_complex_packed_ptr z)
+{
+  int status;
+
+  status = gsl_poly_complex_aberth_init (a, n, w, z);
+
+  if (status)
+    {
+      return status;
+    }
+
+  if (w->nzero == n - 1)
+    {
+      return GSL_SUCCESS;
+    }
+
+  do
+    {
+      gsl_poly_complex_aberth_sweep (a, n, z, 0, n - 1, w);
+      status = gsl_poly_complex_aberth_update (w, z);
+    }
+  while (status == GSL_CONTINUE && w->niter < ABERTH_MAXITER);
+
+  if (status != GSL_SUCCESS)
+    {
+      GSL_ERROR ("root solving aberth method failed to converge", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
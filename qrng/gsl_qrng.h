@@ -32,6 +32,7 @@ typedef struct
   size_t (*state_size) (unsigned int dimension);
   int (*init_state) (void * state, unsigned int dimension);
   int (*get) (void * state, unsigned int dimension, double x[]);
+  int (*skip) (void * state, unsigned int dimension, unsigned long int n);
 }
 gsl_qrng_type;
 
@@ -53,6 +54,7 @@ gsl_qrng;
  */
 GSL_VAR const gsl_qrng_type * gsl_qrng_niederreiter_2;
 GSL_VAR const gsl_qrng_type * gsl_qrng_sobol;
+GSL_VAR const gsl_qrng_type * gsl_qrng_sobol_jk;
 GSL_VAR const gsl_qrng_type * gsl_qrng_halton;
 GSL_VAR const gsl_qrng_type * gsl_qrng_reversehalton;
 
@@ -93,6 +95,16 @@ size_t gsl_qrng_size (const gsl_qrng * q);
 void * gsl_qrng_state (const gsl_qrng * q);
 
 
+/* Skip the next n vectors in the sequence. */
+int gsl_qrng_skip (const gsl_qrng * q, unsigned long int n);
+
+
+/* Retrieve the next n vectors in sequence, storing
+ * vector i in x[i*dimension], ..., x[i*dimension + dimension-1].
+ */
+int gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n);
+
+
 /* Retrieve next vector in sequence. */
 INLINE_DECL int gsl_qrng_get (const gsl_qrng * q, double x[]);
 
@@ -29,6 +29,7 @@
 static size_t nied2_state_size(unsigned int dimension);
 static int nied2_init(void * state, unsigned int dimension);
 static int nied2_get(void * state, unsigned int dimension, double * v);
+static int nied2_skip(void * state, unsigned int dimension, unsigned long int n);
 
 
 static const gsl_qrng_type nied2_type = 
@@ -37,7 +38,8 @@ static const gsl_qrng_type nied2_type =
   NIED2_MAX_DIMENSION,
   nied2_state_size,
   nied2_init,
-  nied2_get
+  nied2_get,
+  nied2_skip
 };
 
 const gsl_qrng_type * gsl_qrng_niederreiter_2 = &nied2_type;
@@ -351,3 +353,37 @@ static int nied2_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* Advance by n points, recomputing the state from the Gray code
+ * of the new sequence count.
+ */
+static int nied2_skip(void * state, unsigned int dimension, unsigned long int n)
+{
+  nied2_state_t * n_state = (nied2_state_t *) state;
+  unsigned long int c = n_state->sequence_count + n;
+  unsigned long int g;
+  unsigned int i_dim;
+  int k;
+
+  /* the sequence is exhausted at count 2^NIED2_NBITS - 1 */
+  if(c < n || c >= (1UL << NIED2_NBITS)) return GSL_EINVAL;
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    n_state->nextq[i_dim] = 0;
+  }
+
+  g = c ^ (c >> 1);
+
+  for(k=0; g != 0; k++, g >>= 1) {
+    if(g & 1) {
+      for(i_dim=0; i_dim<dimension; i_dim++) {
+        n_state->nextq[i_dim] ^= n_state->cj[k][i_dim];
+      }
+    }
+  }
+
+  n_state->sequence_count = c;
+
+  return GSL_SUCCESS;
+}
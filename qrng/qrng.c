@@ -116,3 +116,38 @@ gsl_qrng_free (gsl_qrng * q)
   if(q->state != 0) free (q->state);
   free (q);
 }
+
+
+int
+gsl_qrng_skip (const gsl_qrng * q, unsigned long int n)
+{
+  if (q->type->skip == 0)
+    {
+      GSL_ERROR ("generator does not support skipping", GSL_EUNIMPL);
+    }
+
+  if ((q->type->skip) (q->state, q->dimension, n))
+    {
+      GSL_ERROR ("skip beyond the end of the sequence", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+
+int
+gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      int status = (q->type->get) (q->state, q->dimension,
+                                   x + i * q->dimension);
+
+      if (status)
+        return status;
+    }
+
+  return GSL_SUCCESS;
+}
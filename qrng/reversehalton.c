@@ -34,6 +34,8 @@
 static size_t reversehalton_state_size (unsigned int dimension);
 static int reversehalton_init (void *state, unsigned int dimension);
 static int reversehalton_get (void *state, unsigned int dimension, double *v);
+static int reversehalton_skip (void *state, unsigned int dimension,
+                               unsigned long int n);
 
 /* global Halton generator type object */
 static const gsl_qrng_type reversehalton_type = {
@@ -41,7 +43,8 @@ static const gsl_qrng_type reversehalton_type = {
   REVERSEHALTON_MAX_DIMENSION,
   reversehalton_state_size,
   reversehalton_init,
-  reversehalton_get
+  reversehalton_get,
+  reversehalton_skip
 };
 const gsl_qrng_type *gsl_qrng_reversehalton = &reversehalton_type;
 
@@ -239,3 +242,18 @@ reversehalton_get (void *state, unsigned int dimension, double *v)
 
   return GSL_SUCCESS;
 }
+
+static int
+reversehalton_skip (void *state, unsigned int dimension, unsigned long int n)
+{
+  reversehalton_state_t *h_state = (reversehalton_state_t *) state;
+
+  if (n > (unsigned int) -1 - h_state->sequence_count)
+    {
+      return GSL_EINVAL;
+    }
+
+  h_state->sequence_count += n;
+
+  return GSL_SUCCESS;
+}
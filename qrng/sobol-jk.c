@@ -0,0 +1,217 @@
+/* qrng/sobol-jk.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Implementation for the Sobol generator in high dimensions, with the
+ * direction numbers of Joe and Kuo.
+ * See
+ *   [Joe+Kuo, SIAM J. Sci. Comput. 30, 2635 (2008)]
+ *   [Antonov+Saleev, USSR Comput. Maths. Math. Phys. 19, 252 (1980)]
+ *
+ * The points are generated in Gray code order, so that each point
+ * differs from the previous one by a single direction number in each
+ * dimension.  As for gsl_qrng_sobol the initial point 0 is skipped.
+ * The direction numbers are stored by bit, so that one point reads a
+ * contiguous row of the table, and the state size grows with the
+ * dimension.
+ */
+#include <config.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_qrng.h>
+
+/* maximum allowed space dimension */
+#define SOBOL_JK_MAX_DIMENSION 3667
+
+/* bit count; assumes sizeof(int) >= 32-bit */
+#define SOBOL_JK_BIT_COUNT 32
+
+#include "sobol-jk-table.c"
+
+/* prototypes for generator type functions */
+static size_t sobol_jk_state_size (unsigned int dimension);
+static int sobol_jk_init (void *state, unsigned int dimension);
+static int sobol_jk_get (void *state, unsigned int dimension, double *v);
+static int sobol_jk_skip (void *state, unsigned int dimension,
+                          unsigned long int n);
+
+/* global Sobol generator type object */
+static const gsl_qrng_type sobol_jk_type =
+{
+  "sobol-jk",
+  SOBOL_JK_MAX_DIMENSION,
+  sobol_jk_state_size,
+  sobol_jk_init,
+  sobol_jk_get,
+  sobol_jk_skip
+};
+const gsl_qrng_type *gsl_qrng_sobol_jk = &sobol_jk_type;
+
+
+/* Sobol generator state.
+ *   sequence_count = number of points generated
+ * followed in the same block of memory by the arrays
+ *   x              = numerators of the last point, of length dimension
+ *   v              = direction numbers, v[k*dimension + i] for bit k
+ *                    in dimension i
+ * so that the state can be copied with memcpy.
+ */
+typedef struct
+{
+  unsigned long int sequence_count;
+} sobol_jk_state_t;
+
+#define SOBOL_JK_X(s) ((unsigned int *) ((s) + 1))
+#define SOBOL_JK_V(s,dimension) (SOBOL_JK_X(s) + (dimension))
+
+static size_t
+sobol_jk_state_size (unsigned int dimension)
+{
+  return sizeof (sobol_jk_state_t)
+    + (SOBOL_JK_BIT_COUNT + 1) * dimension * sizeof (unsigned int);
+}
+
+static int
+sobol_jk_init (void *state, unsigned int dimension)
+{
+  sobol_jk_state_t *s = (sobol_jk_state_t *) state;
+  unsigned int *x = SOBOL_JK_X (s);
+  unsigned int *v = SOBOL_JK_V (s, dimension);
+  const unsigned short *m = sobol_jk_minit;
+  unsigned int i, k;
+
+  if (dimension < 1 || dimension > SOBOL_JK_MAX_DIMENSION)
+    {
+      return GSL_EINVAL;
+    }
+
+  /* dimension 0 is the van der Corput sequence in base 2 */
+  for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+    v[k * dimension] = 1U << (SOBOL_JK_BIT_COUNT - 1 - k);
+
+  for (i = 1; i < dimension; i++)
+    {
+      const unsigned int p = sobol_jk_poly[i - 1];
+      unsigned int deg = 0, j;
+
+      while ((p >> (deg + 1)) != 0)
+        deg++;
+
+      /* leading direction numbers v_k = m_k / 2^(k+1) */
+      for (k = 0; k < deg; k++)
+        v[k * dimension + i] = (unsigned int) m[k] << (SOBOL_JK_BIT_COUNT - 1 - k);
+
+      /* remaining ones from the recurrence of the polynomial
+         x^deg + a_1 x^(deg-1) + ... + a_(deg-1) x + 1, with a_j the
+         bit deg-j of p */
+      for (k = deg; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          unsigned int vk = v[(k - deg) * dimension + i];
+
+          vk ^= vk >> deg;
+
+          for (j = 1; j < deg; j++)
+            {
+              if ((p >> (deg - j)) & 1)
+                vk ^= v[(k - j) * dimension + i];
+            }
+
+          v[k * dimension + i] = vk;
+        }
+
+      m += deg;
+    }
+
+  s->sequence_count = 0;
+
+  for (i = 0; i < dimension; i++)
+    x[i] = 0;
+
+  return GSL_SUCCESS;
+}
+
+static int
+sobol_jk_get (void *state, unsigned int dimension, double *v)
+{
+  sobol_jk_state_t *s = (sobol_jk_state_t *) state;
+  const double scale = 1.0 / 4294967296.0;      /* 2^-32 */
+  unsigned long int c = s->sequence_count;
+  const unsigned int *vk;
+  unsigned int *x;
+  unsigned int ell = 0, i;
+
+  /* Find the position of the least-significant zero in count. */
+  while (c & 1)
+    {
+      c >>= 1;
+      ell++;
+    }
+
+  /* Check for exhaustion. */
+  if (ell >= SOBOL_JK_BIT_COUNT)
+    return GSL_EFAILED;
+
+  x = SOBOL_JK_X (s);
+  vk = SOBOL_JK_V (s, dimension) + ell * dimension;
+
+  for (i = 0; i < dimension; i++)
+    {
+      x[i] ^= vk[i];
+      v[i] = x[i] * scale;
+    }
+
+  s->sequence_count++;
+
+  return GSL_SUCCESS;
+}
+
+/* Advance by n points: the point with index c is the sum of the
+   direction numbers of the set bits of the Gray code c ^ (c >> 1) */
+static int
+sobol_jk_skip (void *state, unsigned int dimension, unsigned long int n)
+{
+  sobol_jk_state_t *s = (sobol_jk_state_t *) state;
+  const unsigned long int c = s->sequence_count + n;
+  unsigned int *x = SOBOL_JK_X (s);
+  const unsigned int *v = SOBOL_JK_V (s, dimension);
+  unsigned long int g;
+  unsigned int i, k;
+
+  /* the index must not wrap around or exceed 2^32 - 1 */
+  if (c < n || ((c >> (SOBOL_JK_BIT_COUNT - 1)) >> 1) != 0)
+    return GSL_EINVAL;
+
+  for (i = 0; i < dimension; i++)
+    x[i] = 0;
+
+  g = c ^ (c >> 1);
+
+  for (k = 0; g != 0; k++, g >>= 1)
+    {
+      if (g & 1)
+        {
+          const unsigned int *vk = v + k * dimension;
+
+          for (i = 0; i < dimension; i++)
+            x[i] ^= vk[i];
+        }
+    }
+
+  s->sequence_count = c;
+
+  return GSL_SUCCESS;
+}
@@ -19,6 +19,7 @@
 static size_t sobol_state_size(unsigned int dimension);
 static int sobol_init(void * state, unsigned int dimension);
 static int sobol_get(void * state, unsigned int dimension, double * v);
+static int sobol_skip(void * state, unsigned int dimension, unsigned long int n);
 
 /* global Sobol generator type object */
 static const gsl_qrng_type sobol_type = 
@@ -27,7 +28,8 @@ static const gsl_qrng_type sobol_type =
   SOBOL_MAX_DIMENSION,
   sobol_state_size,
   sobol_init,
-  sobol_get
+  sobol_get,
+  sobol_skip
 };
 const gsl_qrng_type * gsl_qrng_sobol = &sobol_type;
 
@@ -229,3 +231,37 @@ static int sobol_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* Advance by n points, recomputing the numerators from the Gray code
+ * of the new sequence count.
+ */
+static int sobol_skip(void * state, unsigned int dimension, unsigned long int n)
+{
+  sobol_state_t * s_state = (sobol_state_t *) state;
+  unsigned long int c = s_state->sequence_count + n;
+  unsigned long int g;
+  unsigned int i_dimension;
+  int k;
+
+  /* the sequence is exhausted at count 2^SOBOL_BIT_COUNT - 1 */
+  if(c < n || c >= (1UL << SOBOL_BIT_COUNT)) return GSL_EINVAL;
+
+  for(i_dimension=0; i_dimension<dimension; i_dimension++) {
+    s_state->last_numerator_vec[i_dimension] = 0;
+  }
+
+  g = c ^ (c >> 1);
+
+  for(k=0; g != 0; k++, g >>= 1) {
+    if(g & 1) {
+      for(i_dimension=0; i_dimension<dimension; i_dimension++) {
+        s_state->last_numerator_vec[i_dimension] ^= s_state->v_direction[k][i_dimension];
+      }
+    }
+  }
+
+  s_state->sequence_count = c;
+
+  return GSL_SUCCESS;
+}
@@ -2,6 +2,7 @@
  */
 #include <config.h>
 #include <stdlib.h>
+#include <string.h>
 #include <gsl/gsl_ieee_utils.h>
 
 #include <gsl/gsl_qrng.h>
@@ -232,6 +233,91 @@ void test_nied2(void)
   gsl_test (status, "Niederreiter d=3 (reinitialized)");
 }
 
+void test_sobol_jk(void)
+{
+  int status = 0;
+  double v[3];
+  unsigned int i, k;
+  const unsigned int d = 3667, n = 1023;
+  double * x = malloc (n * d * sizeof(double));
+  unsigned char * seen = malloc (n + 1);
+
+  /* test in dimension 3, the third coordinate differs from gsl_qrng_sobol */
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 3);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.5 || v[1] != 0.5 || v[2] != 0.5 );
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.375 || v[1] != 0.375 || v[2] != 0.625 );
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol-JK d=3");
+
+  /* in every dimension the first 2^10 - 1 points must take each value
+     k/2^10, k = 1..1023, exactly once */
+  status = 0;
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, d);
+  gsl_qrng_get_array(g, x, n);
+
+  for (k = 0; k < d; k++)
+    {
+      memset (seen, 0, n + 1);
+
+      for (i = 0; i < n; i++)
+        {
+          double y = x[i * d + k] * 1024;
+          unsigned int j = (unsigned int) y;
+
+          status += (y != j || j == 0 || j > n || seen[j]);
+          seen[j < n + 1 ? j : 0] = 1;
+        }
+    }
+
+  gsl_test (status, "Sobol-JK d=%u, stratification of %u points", d, n);
+
+  gsl_qrng_free(g);
+  free (seen);
+  free (x);
+}
+
+/* skipping n points must give the same vectors as generating them */
+void test_skip(const gsl_qrng_type * T, unsigned int d)
+{
+  int status = 0;
+  const unsigned long int skips[3] = { 0, 37, 1000 };
+  double * v = malloc (d * sizeof(double));
+  double * w = malloc (3 * d * sizeof(double));
+  gsl_qrng * g = gsl_qrng_alloc(T, d);
+  gsl_qrng * h = gsl_qrng_alloc(T, d);
+  unsigned int i, j, k;
+
+  for (k = 0; k < 3; k++)
+    {
+      for (i = 0; i < skips[k]; i++)
+        gsl_qrng_get(g, v);
+
+      gsl_qrng_skip(h, skips[k]);
+      gsl_qrng_get_array(h, w, 3);
+
+      for (i = 0; i < 3; i++)
+        {
+          gsl_qrng_get(g, v);
+
+          for (j = 0; j < d; j++)
+            status += (w[i * d + j] != v[j]);
+        }
+    }
+
+  gsl_test (status, "%s d=%u, skip", gsl_qrng_name(g), d);
+
+  gsl_qrng_free(g);
+  gsl_qrng_free(h);
+  free (v);
+  free (w);
+}
+
 
 int main()
 {
@@ -242,6 +328,13 @@ int main()
 	test_halton();
 	test_reversehalton();
   test_nied2();
+  test_sobol_jk();
+
+  test_skip(gsl_qrng_niederreiter_2, 12);
+  test_skip(gsl_qrng_sobol, 40);
+  test_skip(gsl_qrng_sobol_jk, 1000);
+  test_skip(gsl_qrng_halton, 10);
+  test_skip(gsl_qrng_reversehalton, 10);
 
   exit (gsl_test_summary ());
 }
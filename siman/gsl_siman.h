@@ -77,6 +77,68 @@ gsl_siman_solve_many (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
                       size_t element_size,
                       gsl_siman_params_t params);
 
+/* parallel tempering: nreplicas Metropolis chains on a geometric
+   ladder of temperatures from t_min to t_max, exchanging
+   configurations between neighbours after each round.  If mu_t > 1
+   the whole ladder is cooled by this factor after each round. */
+
+typedef struct {
+  size_t n_rounds;          /* number of exchange rounds */
+  int iters_per_round;      /* steps of each replica between exchanges */
+  double step_size;         /* max step size in the random walk */
+  double k, t_min, t_max;   /* Boltzmann constant and temperature ladder */
+  double mu_t;              /* cooling factor per round, 1 for none */
+} gsl_siman_pt_params_t;
+
+typedef struct {
+  size_t nreplicas;
+  size_t element_size;
+  gsl_siman_copy_t copyfunc;
+  gsl_siman_copy_construct_t copy_constructor;
+  gsl_siman_destroy_t destructor;
+  void **x;                 /* current configuration of each replica */
+  void **new_x;             /* trial configuration of each replica */
+  void **best_x;            /* best configuration seen by each replica */
+  double *E;
+  double *best_E;
+  double *T;                /* temperature of each replica */
+  gsl_rng **r;              /* random number stream of each replica */
+  size_t n_exchange_tries;
+  size_t n_exchange_accepts;
+} gsl_siman_pt_workspace;
+
+gsl_siman_pt_workspace *
+gsl_siman_pt_alloc (const gsl_rng_type * T, size_t nreplicas, void *x0_p,
+                    gsl_siman_copy_t copyfunc,
+                    gsl_siman_copy_construct_t copy_constructor,
+                    gsl_siman_destroy_t destructor, size_t element_size);
+
+void gsl_siman_pt_free (gsl_siman_pt_workspace * w);
+
+int
+gsl_siman_pt_init (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
+                   const gsl_siman_pt_params_t * params,
+                   gsl_siman_pt_workspace * w);
+
+int
+gsl_siman_pt_round (gsl_siman_pt_workspace * w, size_t i,
+                    gsl_siman_Efunc_t Ef, gsl_siman_step_t take_step,
+                    const gsl_siman_pt_params_t * params);
+
+int
+gsl_siman_pt_exchange (const gsl_rng * r, size_t round,
+                       const gsl_siman_pt_params_t * params,
+                       gsl_siman_pt_workspace * w);
+
+double gsl_siman_pt_best (gsl_siman_pt_workspace * w, void *x_p);
+
+int
+gsl_siman_pt_solve (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
+                    gsl_siman_step_t take_step,
+                    gsl_siman_print_t print_position,
+                    gsl_siman_pt_params_t params,
+                    gsl_siman_pt_workspace * w);
+
 __END_DECLS
 
 #endif /* __GSL_SIMAN_H__ */
@@ -0,0 +1,396 @@
+/* siman/pt.c
+ *
+ * Copyright (C) 2014 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_machine.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_siman.h>
+
+/* Parallel tempering (replica exchange) runs several Metropolis chains
+   on a ladder of temperatures.  After each round of iters_per_round
+   steps per replica, neighbouring replicas i, i+1 exchange their
+   configurations with probability
+
+     min(1, exp((1/kT_i - 1/kT_{i+1}) (E_i - E_{i+1})))
+
+   which lets good configurations found at high temperature drift down
+   to the coldest chain.  The exchange only swaps pointers.  All the
+   configurations are allocated once in the workspace, and each replica
+   has its own random number generator and only touches its own data
+   during a round, so the rounds of the different replicas are
+   independent of each other.
+
+   gsl_siman_pt_solve is the serial driver.  A caller can run the rounds
+   of the replicas concurrently by calling gsl_siman_pt_init, then for
+   each round gsl_siman_pt_round for every replica (in any order or in
+   parallel) followed by gsl_siman_pt_exchange, and finally
+   gsl_siman_pt_best. */
+
+static void *
+pt_create (gsl_siman_pt_workspace * w, void *x0_p)
+{
+  if (w->copy_constructor)
+    {
+      return w->copy_constructor (x0_p);
+    }
+  else
+    {
+      void *x = malloc (w->element_size);
+
+      if (x)
+        memcpy (x, x0_p, w->element_size);
+
+      return x;
+    }
+}
+
+static void
+pt_destroy (gsl_siman_pt_workspace * w, void *x)
+{
+  if (x == 0)
+    return;
+
+  if (w->destructor)
+    w->destructor (x);
+  else
+    free (x);
+}
+
+static void
+pt_copy (gsl_siman_pt_workspace * w, void *src, void *dst)
+{
+  if (w->copyfunc)
+    w->copyfunc (src, dst);
+  else
+    memcpy (dst, src, w->element_size);
+}
+
+gsl_siman_pt_workspace *
+gsl_siman_pt_alloc (const gsl_rng_type * T, size_t nreplicas, void *x0_p,
+                    gsl_siman_copy_t copyfunc,
+                    gsl_siman_copy_construct_t copy_constructor,
+                    gsl_siman_destroy_t destructor, size_t element_size)
+{
+  gsl_siman_pt_workspace *w;
+  size_t i;
+
+  if (nreplicas == 0)
+    {
+      GSL_ERROR_NULL ("number of replicas must be positive", GSL_EINVAL);
+    }
+
+  if ((copyfunc != NULL) != (copy_constructor != NULL)
+      || (copyfunc != NULL) != (destructor != NULL))
+    {
+      GSL_ERROR_NULL ("copy functions must be given all together or not at all",
+                      GSL_EINVAL);
+    }
+
+  if (copyfunc == NULL && element_size == 0)
+    {
+      GSL_ERROR_NULL ("either copy functions or an element size are required",
+                      GSL_EINVAL);
+    }
+
+  w = (gsl_siman_pt_workspace *) calloc (1, sizeof (gsl_siman_pt_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for pt struct", GSL_ENOMEM);
+    }
+
+  w->nreplicas = nreplicas;
+  w->element_size = element_size;
+
+  w->copyfunc = copyfunc;
+  w->copy_constructor = copy_constructor;
+  w->destructor = destructor;
+
+  w->x = (void **) calloc (nreplicas, sizeof (void *));
+  w->new_x = (void **) calloc (nreplicas, sizeof (void *));
+  w->best_x = (void **) calloc (nreplicas, sizeof (void *));
+  w->E = (double *) malloc (nreplicas * sizeof (double));
+  w->best_E = (double *) malloc (nreplicas * sizeof (double));
+  w->T = (double *) malloc (nreplicas * sizeof (double));
+  w->r = (gsl_rng **) calloc (nreplicas, sizeof (gsl_rng *));
+
+  if (w->x == 0 || w->new_x == 0 || w->best_x == 0 || w->E == 0
+      || w->best_E == 0 || w->T == 0 || w->r == 0)
+    {
+      gsl_siman_pt_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for replicas", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < nreplicas; i++)
+    {
+      w->x[i] = pt_create (w, x0_p);
+      w->new_x[i] = pt_create (w, x0_p);
+      w->best_x[i] = pt_create (w, x0_p);
+      w->r[i] = gsl_rng_alloc (T);
+
+      if (w->x[i] == 0 || w->new_x[i] == 0 || w->best_x[i] == 0
+          || w->r[i] == 0)
+        {
+          gsl_siman_pt_free (w);
+          GSL_ERROR_NULL ("failed to allocate space for replica", GSL_ENOMEM);
+        }
+    }
+
+  return w;
+}
+
+void
+gsl_siman_pt_free (gsl_siman_pt_workspace * w)
+{
+  size_t i;
+
+  RETURN_IF_NULL (w);
+
+  for (i = 0; i < w->nreplicas; i++)
+    {
+      if (w->x)
+        pt_destroy (w, w->x[i]);
+
+      if (w->new_x)
+        pt_destroy (w, w->new_x[i]);
+
+      if (w->best_x)
+        pt_destroy (w, w->best_x[i]);
+
+      if (w->r && w->r[i])
+        gsl_rng_free (w->r[i]);
+    }
+
+  free (w->x);
+  free (w->new_x);
+  free (w->best_x);
+  free (w->E);
+  free (w->best_E);
+  free (w->T);
+  free (w->r);
+  free (w);
+}
+
+int
+gsl_siman_pt_init (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
+                   const gsl_siman_pt_params_t * params,
+                   gsl_siman_pt_workspace * w)
+{
+  const size_t K = w->nreplicas;
+  size_t i;
+  double E0;
+
+  if (!(params->t_min > 0.0 && params->t_min <= params->t_max))
+    {
+      GSL_ERROR ("temperatures must satisfy 0 < t_min <= t_max", GSL_EINVAL);
+    }
+
+  if (params->mu_t < 1.0)
+    {
+      GSL_ERROR ("cooling factor mu_t must be at least 1", GSL_EINVAL);
+    }
+
+  E0 = Ef (x0_p);
+
+  /* geometric temperature ladder, replica 0 is the coldest */
+
+  for (i = 0; i < K; i++)
+    {
+      const double f = (K > 1) ? (double) i / (K - 1) : 0.0;
+
+      w->T[i] = params->t_min * pow (params->t_max / params->t_min, f);
+
+      pt_copy (w, x0_p, w->x[i]);
+      pt_copy (w, x0_p, w->best_x[i]);
+      w->E[i] = E0;
+      w->best_E[i] = E0;
+
+      gsl_rng_set (w->r[i], gsl_rng_get (r));
+    }
+
+  w->n_exchange_tries = 0;
+  w->n_exchange_accepts = 0;
+
+  return GSL_SUCCESS;
+}
+
+/* run iters_per_round Metropolis steps of replica i at its temperature */
+
+int
+gsl_siman_pt_round (gsl_siman_pt_workspace * w, size_t i,
+                    gsl_siman_Efunc_t Ef, gsl_siman_step_t take_step,
+                    const gsl_siman_pt_params_t * params)
+{
+  const gsl_rng *r;
+  double kT;
+  int n;
+
+  if (i >= w->nreplicas)
+    {
+      GSL_ERROR ("replica index out of range", GSL_EINVAL);
+    }
+
+  r = w->r[i];
+  kT = params->k * w->T[i];
+
+  for (n = 0; n < params->iters_per_round; n++)
+    {
+      double new_E, x;
+
+      pt_copy (w, w->x[i], w->new_x[i]);
+      take_step (r, w->new_x[i], params->step_size);
+      new_E = Ef (w->new_x[i]);
+
+      x = -(new_E - w->E[i]) / kT;
+
+      /* avoid underflow errors for large uphill steps */
+      if (new_E <= w->E[i]
+          || (x > GSL_LOG_DBL_MIN && gsl_rng_uniform (r) < exp (x)))
+        {
+          void *tmp = w->x[i];
+          w->x[i] = w->new_x[i];
+          w->new_x[i] = tmp;
+          w->E[i] = new_E;
+
+          if (new_E < w->best_E[i])
+            {
+              pt_copy (w, w->x[i], w->best_x[i]);
+              w->best_E[i] = new_E;
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* end of a round: try to exchange the even (round even) or odd (round
+   odd) pairs of neighbours, then cool the ladder if mu_t > 1 */
+
+int
+gsl_siman_pt_exchange (const gsl_rng * r, size_t round,
+                       const gsl_siman_pt_params_t * params,
+                       gsl_siman_pt_workspace * w)
+{
+  const size_t K = w->nreplicas;
+  size_t i;
+
+  for (i = round % 2; i + 1 < K; i += 2)
+    {
+      const double b = 1.0 / (params->k * w->T[i])
+        - 1.0 / (params->k * w->T[i + 1]);
+      const double x = b * (w->E[i] - w->E[i + 1]);
+
+      w->n_exchange_tries++;
+
+      if (x >= 0 || (x > GSL_LOG_DBL_MIN && gsl_rng_uniform (r) < exp (x)))
+        {
+          void *tmp = w->x[i];
+          double E = w->E[i];
+
+          w->x[i] = w->x[i + 1];
+          w->x[i + 1] = tmp;
+          w->E[i] = w->E[i + 1];
+          w->E[i + 1] = E;
+
+          w->n_exchange_accepts++;
+        }
+    }
+
+  /* multi-chain annealing: cool the whole ladder */
+
+  if (params->mu_t > 1.0)
+    {
+      for (i = 0; i < K; i++)
+        w->T[i] /= params->mu_t;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* copy the best configuration seen by any replica into x_p and return
+   its energy */
+
+double
+gsl_siman_pt_best (gsl_siman_pt_workspace * w, void *x_p)
+{
+  size_t i, ibest = 0;
+
+  for (i = 1; i < w->nreplicas; i++)
+    {
+      if (w->best_E[i] < w->best_E[ibest])
+        ibest = i;
+    }
+
+  pt_copy (w, w->best_x[ibest], x_p);
+
+  return w->best_E[ibest];
+}
+
+int
+gsl_siman_pt_solve (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
+                    gsl_siman_step_t take_step,
+                    gsl_siman_print_t print_position,
+                    gsl_siman_pt_params_t params,
+                    gsl_siman_pt_workspace * w)
+{
+  const size_t K = w->nreplicas;
+  size_t i, round;
+  int status;
+
+  status = gsl_siman_pt_init (r, x0_p, Ef, &params, w);
+
+  if (status)
+    return status;
+
+  if (print_position)
+    {
+      printf ("#-round  coldest-T     position   energy  best_energy\n");
+    }
+
+  for (round = 0; round < params.n_rounds; round++)
+    {
+      for (i = 0; i < K; i++)
+        gsl_siman_pt_round (w, i, Ef, take_step, &params);
+
+      if (print_position)
+        {
+          double best_E = w->best_E[0];
+
+          for (i = 1; i < K; i++)
+            best_E = GSL_MIN_DBL (best_E, w->best_E[i]);
+
+          printf ("%5d  %12g", (int) round, w->T[0]);
+          print_position (w->x[0]);
+          printf ("  %12g  %12g\n", w->E[0], best_E);
+        }
+
+      gsl_siman_pt_exchange (r, round, &params, w);
+    }
+
+  gsl_siman_pt_best (w, x0_p);
+
+  return GSL_SUCCESS;
+}
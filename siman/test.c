@@ -23,6 +23,7 @@
 #include <math.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_rng.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_siman.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <stdio.h>
@@ -78,6 +79,28 @@ void P1(void *xp)
   printf(" %12g ", *((double *) xp));
 }
 
+void C1(void *source, void *dest);
+void *CC1(void *xp);
+void D1(void *xp);
+
+/* copy functions for the variable-size mode */
+void C1(void *source, void *dest)
+{
+  *((double *) dest) = *((double *) source);
+}
+
+void *CC1(void *xp)
+{
+  double *y = malloc (sizeof (double));
+  *y = *((double *) xp);
+  return y;
+}
+
+void D1(void *xp)
+{
+  free (xp);
+}
+
 int main(void)
 {
   double x_min = 1.36312999455315182 ;
@@ -118,6 +141,84 @@ int main(void)
                   sizeof(double), params);
   gsl_test_rel(x, x_min, 1e-3, "f(x)= exp(-(x-1)^2) sin(8x), x0=0.4") ;
 
+  /* parallel tempering, in fixed-size and variable-size modes */
+
+  {
+    gsl_siman_pt_params_t pt_params = {200, 100, STEP_SIZE, K,
+                                       1.0e-4, 0.5, 1.0};
+    gsl_siman_pt_workspace *w;
+
+    x = +0.6 ;
+    w = gsl_siman_pt_alloc (gsl_rng_default, 8, &x, NULL, NULL, NULL,
+                            sizeof(double));
+    gsl_siman_pt_solve (r, &x, E1, S1, NULL, pt_params, w);
+    gsl_test_rel(x, x_min, 1e-3, "parallel tempering, x0=0.6") ;
+    gsl_test (w->n_exchange_accepts == 0,
+              "parallel tempering, replica exchanges accepted");
+
+    x = -10.0 ;
+    gsl_siman_pt_solve (r, &x, E1, S1, NULL, pt_params, w);
+    gsl_test_rel(x, x_min, 1e-3, "parallel tempering, x0=-10") ;
+    gsl_siman_pt_free (w);
+
+    x = +10.0 ;
+    pt_params.t_max = 0.05;
+    pt_params.mu_t = 1.02;
+    w = gsl_siman_pt_alloc (gsl_rng_default, 4, &x, C1, CC1, D1, 0);
+    gsl_siman_pt_solve (r, &x, E1, S1, NULL, pt_params, w);
+    gsl_test_rel(x, x_min, 1e-3, "multi-chain annealing, x0=10") ;
+    gsl_siman_pt_free (w);
+
+    /* a driver built from the per-round functions, running the
+       replicas in reverse order, matches gsl_siman_pt_solve */
+    {
+      gsl_rng *r1 = gsl_rng_alloc (gsl_rng_env_setup ());
+      gsl_rng *r2 = gsl_rng_alloc (gsl_rng_env_setup ());
+      gsl_siman_pt_workspace *w2;
+      double x2, E2;
+      size_t round, i;
+
+      x = x2 = +0.6 ;
+      w = gsl_siman_pt_alloc (gsl_rng_default, 6, &x, NULL, NULL, NULL,
+                              sizeof(double));
+      w2 = gsl_siman_pt_alloc (gsl_rng_default, 6, &x2, NULL, NULL, NULL,
+                               sizeof(double));
+      gsl_siman_pt_solve (r1, &x, E1, S1, NULL, pt_params, w);
+
+      gsl_siman_pt_init (r2, &x2, E1, &pt_params, w2);
+      for (round = 0; round < pt_params.n_rounds; round++)
+        {
+          for (i = w2->nreplicas; i-- > 0;)
+            gsl_siman_pt_round (w2, i, E1, S1, &pt_params);
+          gsl_siman_pt_exchange (r2, round, &pt_params, w2);
+        }
+      E2 = gsl_siman_pt_best (w2, &x2);
+
+      gsl_test (x2 != x, "parallel tempering, per-round driver position");
+      gsl_test (E2 != E1 (&x), "parallel tempering, per-round driver energy");
+      gsl_test (w2->n_exchange_accepts != w->n_exchange_accepts,
+                "parallel tempering, per-round driver exchanges");
+
+      gsl_siman_pt_free (w);
+      gsl_siman_pt_free (w2);
+      gsl_rng_free (r1);
+      gsl_rng_free (r2);
+    }
+
+    /* the copy functions must be given all together or not at all */
+    {
+      gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+
+      w = gsl_siman_pt_alloc (gsl_rng_default, 4, &x, C1, NULL, NULL,
+                              sizeof(double));
+      gsl_test (w != NULL, "parallel tempering, partial copy functions");
+      w = gsl_siman_pt_alloc (gsl_rng_default, 4, &x, C1, CC1, NULL, 0);
+      gsl_test (w != NULL, "parallel tempering, missing destructor");
+
+      gsl_set_error_handler (old_handler);
+    }
+  }
+
   gsl_rng_free(r);
   exit (gsl_test_summary ());
 
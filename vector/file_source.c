@@ -37,6 +37,91 @@ FUNCTION (gsl_vector, fwrite) (FILE * stream, const TYPE (gsl_vector) * v)
   return status;
 }
 
+/* Binary files with a header giving the element type and dimensions,
+   see gsl_block_raw_fwrite_header */
+
+int
+FUNCTION (gsl_vector, fsave) (FILE * stream, const TYPE (gsl_vector) * v)
+{
+  int status = FUNCTION (gsl_block, raw_fwrite_header) (stream, v->size, 1);
+
+  if (status)
+    return status;
+
+  return FUNCTION (gsl_vector, fwrite) (stream, v);
+}
+
+TYPE (gsl_vector) *
+FUNCTION (gsl_vector, fload) (FILE * stream)
+{
+  TYPE (gsl_vector) * v;
+  size_t size1, size2;
+  int status;
+
+  status = FUNCTION (gsl_block, raw_fread_header) (stream, &size1, &size2);
+
+  if (status)
+    return 0;
+
+  if (size2 != 1)
+    {
+      GSL_ERROR_VAL ("file does not contain a vector", GSL_EBADLEN, 0);
+    }
+
+  v = FUNCTION (gsl_vector, alloc) (size1);
+
+  if (v == 0)
+    return 0;
+
+  status = FUNCTION (gsl_vector, fread) (stream, v);
+
+  if (status)
+    {
+      FUNCTION (gsl_vector, free) (v);
+      return 0;
+    }
+
+  return v;
+}
+
+const TYPE (gsl_vector) *
+FUNCTION (gsl_vector, mmap) (const char * filename)
+{
+  TYPE (gsl_vector) * v;
+  TYPE (gsl_block) * b;
+  size_t size1, size2;
+
+  b = FUNCTION (gsl_block, mmap) (filename, &size1, &size2);
+
+  if (b == 0)
+    return 0;
+
+  if (size2 != 1)
+    {
+      FUNCTION (gsl_block, munmap) (b);
+      GSL_ERROR_VAL ("file does not contain a vector", GSL_EBADLEN, 0);
+    }
+
+  v = FUNCTION (gsl_vector, alloc_from_block) (b, 0, size1, 1);
+
+  if (v == 0)
+    {
+      FUNCTION (gsl_block, munmap) (b);
+      return 0;
+    }
+
+  return v;
+}
+
+void
+FUNCTION (gsl_vector, munmap) (const TYPE (gsl_vector) * v)
+{
+  RETURN_IF_NULL (v);
+
+  FUNCTION (gsl_block, munmap) (v->block);
+  free ((TYPE (gsl_vector) *) v);
+}
+
 #if !(USES_LONGDOUBLE && !HAVE_PRINTF_LONGDOUBLE)
 int
 FUNCTION (gsl_vector, fprintf) (FILE * stream, const TYPE (gsl_vector) * v,
@@ -129,6 +129,10 @@ int gsl_vector_char_set_basis (gsl_vector_char * v, size_t i);
 
 int gsl_vector_char_fread (FILE * stream, gsl_vector_char * v);
 int gsl_vector_char_fwrite (FILE * stream, const gsl_vector_char * v);
+int gsl_vector_char_fsave (FILE * stream, const gsl_vector_char * v);
+gsl_vector_char * gsl_vector_char_fload (FILE * stream);
+const gsl_vector_char * gsl_vector_char_mmap (const char * filename);
+void gsl_vector_char_munmap (const gsl_vector_char * v);
 int gsl_vector_char_fscanf (FILE * stream, gsl_vector_char * v);
 int gsl_vector_char_fprintf (FILE * stream, const gsl_vector_char * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_char_mul (gsl_vector_char * a, const gsl_vector_char * b);
 int gsl_vector_char_div (gsl_vector_char * a, const gsl_vector_char * b);
 int gsl_vector_char_scale (gsl_vector_char * a, const double x);
 int gsl_vector_char_add_constant (gsl_vector_char * a, const double x);
+int gsl_vector_char_axpby (const double alpha, const gsl_vector_char * x, const double beta, gsl_vector_char * y);
+int gsl_vector_char_axpbyc (const double alpha, const gsl_vector_char * x, const double beta, const double c, gsl_vector_char * y);
+int gsl_vector_char_map (gsl_vector_char * a, char (* f) (char x, void * params), void * params);
 
 int gsl_vector_char_equal (const gsl_vector_char * u, 
                             const gsl_vector_char * v);
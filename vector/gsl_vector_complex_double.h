@@ -151,6 +151,10 @@ int gsl_vector_complex_fread (FILE * stream,
                                     gsl_vector_complex * v);
 int gsl_vector_complex_fwrite (FILE * stream,
                                      const gsl_vector_complex * v);
+int gsl_vector_complex_fsave (FILE * stream, const gsl_vector_complex * v);
+gsl_vector_complex * gsl_vector_complex_fload (FILE * stream);
+const gsl_vector_complex * gsl_vector_complex_mmap (const char * filename);
+void gsl_vector_complex_munmap (const gsl_vector_complex * v);
 int gsl_vector_complex_fscanf (FILE * stream,
                                      gsl_vector_complex * v);
 int gsl_vector_complex_fprintf (FILE * stream,
@@ -178,6 +182,9 @@ int gsl_vector_complex_mul (gsl_vector_complex * a, const gsl_vector_complex * b
 int gsl_vector_complex_div (gsl_vector_complex * a, const gsl_vector_complex * b);
 int gsl_vector_complex_scale (gsl_vector_complex * a, const gsl_complex x);
 int gsl_vector_complex_add_constant (gsl_vector_complex * a, const gsl_complex x);
+int gsl_vector_complex_axpby (const gsl_complex alpha, const gsl_vector_complex * x, const gsl_complex beta, gsl_vector_complex * y);
+int gsl_vector_complex_axpbyc (const gsl_complex alpha, const gsl_vector_complex * x, const gsl_complex beta, const gsl_complex c, gsl_vector_complex * y);
+int gsl_vector_complex_map (gsl_vector_complex * a, gsl_complex (* f) (gsl_complex z, void * params), void * params);
 
 INLINE_DECL gsl_complex gsl_vector_complex_get (const gsl_vector_complex * v, const size_t i);
 INLINE_DECL void gsl_vector_complex_set (gsl_vector_complex * v, const size_t i, gsl_complex z);
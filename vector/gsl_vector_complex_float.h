@@ -151,6 +151,10 @@ int gsl_vector_complex_float_fread (FILE * stream,
                                     gsl_vector_complex_float * v);
 int gsl_vector_complex_float_fwrite (FILE * stream,
                                      const gsl_vector_complex_float * v);
+int gsl_vector_complex_float_fsave (FILE * stream, const gsl_vector_complex_float * v);
+gsl_vector_complex_float * gsl_vector_complex_float_fload (FILE * stream);
+const gsl_vector_complex_float * gsl_vector_complex_float_mmap (const char * filename);
+void gsl_vector_complex_float_munmap (const gsl_vector_complex_float * v);
 int gsl_vector_complex_float_fscanf (FILE * stream,
                                      gsl_vector_complex_float * v);
 int gsl_vector_complex_float_fprintf (FILE * stream,
@@ -178,6 +182,9 @@ int gsl_vector_complex_float_mul (gsl_vector_complex_float * a, const gsl_vector
 int gsl_vector_complex_float_div (gsl_vector_complex_float * a, const gsl_vector_complex_float * b);
 int gsl_vector_complex_float_scale (gsl_vector_complex_float * a, const gsl_complex_float x);
 int gsl_vector_complex_float_add_constant (gsl_vector_complex_float * a, const gsl_complex_float x);
+int gsl_vector_complex_float_axpby (const gsl_complex_float alpha, const gsl_vector_complex_float * x, const gsl_complex_float beta, gsl_vector_complex_float * y);
+int gsl_vector_complex_float_axpbyc (const gsl_complex_float alpha, const gsl_vector_complex_float * x, const gsl_complex_float beta, const gsl_complex_float c, gsl_vector_complex_float * y);
+int gsl_vector_complex_float_map (gsl_vector_complex_float * a, gsl_complex_float (* f) (gsl_complex_float z, void * params), void * params);
 
 INLINE_DECL gsl_complex_float gsl_vector_complex_float_get (const gsl_vector_complex_float * v, const size_t i);
 INLINE_DECL void gsl_vector_complex_float_set (gsl_vector_complex_float * v, const size_t i, gsl_complex_float z);
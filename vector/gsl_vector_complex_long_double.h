@@ -151,6 +151,10 @@ int gsl_vector_complex_long_double_fread (FILE * stream,
                                     gsl_vector_complex_long_double * v);
 int gsl_vector_complex_long_double_fwrite (FILE * stream,
                                      const gsl_vector_complex_long_double * v);
+int gsl_vector_complex_long_double_fsave (FILE * stream, const gsl_vector_complex_long_double * v);
+gsl_vector_complex_long_double * gsl_vector_complex_long_double_fload (FILE * stream);
+const gsl_vector_complex_long_double * gsl_vector_complex_long_double_mmap (const char * filename);
+void gsl_vector_complex_long_double_munmap (const gsl_vector_complex_long_double * v);
 int gsl_vector_complex_long_double_fscanf (FILE * stream,
                                      gsl_vector_complex_long_double * v);
 int gsl_vector_complex_long_double_fprintf (FILE * stream,
@@ -178,6 +182,9 @@ int gsl_vector_complex_long_double_mul (gsl_vector_complex_long_double * a, cons
 int gsl_vector_complex_long_double_div (gsl_vector_complex_long_double * a, const gsl_vector_complex_long_double * b);
 int gsl_vector_complex_long_double_scale (gsl_vector_complex_long_double * a, const gsl_complex_long_double x);
 int gsl_vector_complex_long_double_add_constant (gsl_vector_complex_long_double * a, const gsl_complex_long_double x);
+int gsl_vector_complex_long_double_axpby (const gsl_complex_long_double alpha, const gsl_vector_complex_long_double * x, const gsl_complex_long_double beta, gsl_vector_complex_long_double * y);
+int gsl_vector_complex_long_double_axpbyc (const gsl_complex_long_double alpha, const gsl_vector_complex_long_double * x, const gsl_complex_long_double beta, const gsl_complex_long_double c, gsl_vector_complex_long_double * y);
+int gsl_vector_complex_long_double_map (gsl_vector_complex_long_double * a, gsl_complex_long_double (* f) (gsl_complex_long_double z, void * params), void * params);
 
 INLINE_DECL gsl_complex_long_double gsl_vector_complex_long_double_get (const gsl_vector_complex_long_double * v, const size_t i);
 INLINE_DECL void gsl_vector_complex_long_double_set (gsl_vector_complex_long_double * v, const size_t i, gsl_complex_long_double z);
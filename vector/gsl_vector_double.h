@@ -129,6 +129,10 @@ int gsl_vector_set_basis (gsl_vector * v, size_t i);
 
 int gsl_vector_fread (FILE * stream, gsl_vector * v);
 int gsl_vector_fwrite (FILE * stream, const gsl_vector * v);
+int gsl_vector_fsave (FILE * stream, const gsl_vector * v);
+gsl_vector * gsl_vector_fload (FILE * stream);
+const gsl_vector * gsl_vector_mmap (const char * filename);
+void gsl_vector_munmap (const gsl_vector * v);
 int gsl_vector_fscanf (FILE * stream, gsl_vector * v);
 int gsl_vector_fprintf (FILE * stream, const gsl_vector * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_mul (gsl_vector * a, const gsl_vector * b);
 int gsl_vector_div (gsl_vector * a, const gsl_vector * b);
 int gsl_vector_scale (gsl_vector * a, const double x);
 int gsl_vector_add_constant (gsl_vector * a, const double x);
+int gsl_vector_axpby (const double alpha, const gsl_vector * x, const double beta, gsl_vector * y);
+int gsl_vector_axpbyc (const double alpha, const gsl_vector * x, const double beta, const double c, gsl_vector * y);
+int gsl_vector_map (gsl_vector * a, double (* f) (double x, void * params), void * params);
 
 int gsl_vector_equal (const gsl_vector * u, 
                             const gsl_vector * v);
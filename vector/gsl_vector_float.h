@@ -129,6 +129,10 @@ int gsl_vector_float_set_basis (gsl_vector_float * v, size_t i);
 
 int gsl_vector_float_fread (FILE * stream, gsl_vector_float * v);
 int gsl_vector_float_fwrite (FILE * stream, const gsl_vector_float * v);
+int gsl_vector_float_fsave (FILE * stream, const gsl_vector_float * v);
+gsl_vector_float * gsl_vector_float_fload (FILE * stream);
+const gsl_vector_float * gsl_vector_float_mmap (const char * filename);
+void gsl_vector_float_munmap (const gsl_vector_float * v);
 int gsl_vector_float_fscanf (FILE * stream, gsl_vector_float * v);
 int gsl_vector_float_fprintf (FILE * stream, const gsl_vector_float * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_float_mul (gsl_vector_float * a, const gsl_vector_float * b);
 int gsl_vector_float_div (gsl_vector_float * a, const gsl_vector_float * b);
 int gsl_vector_float_scale (gsl_vector_float * a, const double x);
 int gsl_vector_float_add_constant (gsl_vector_float * a, const double x);
+int gsl_vector_float_axpby (const double alpha, const gsl_vector_float * x, const double beta, gsl_vector_float * y);
+int gsl_vector_float_axpbyc (const double alpha, const gsl_vector_float * x, const double beta, const double c, gsl_vector_float * y);
+int gsl_vector_float_map (gsl_vector_float * a, float (* f) (float x, void * params), void * params);
 
 int gsl_vector_float_equal (const gsl_vector_float * u, 
                             const gsl_vector_float * v);
@@ -129,6 +129,10 @@ int gsl_vector_int_set_basis (gsl_vector_int * v, size_t i);
 
 int gsl_vector_int_fread (FILE * stream, gsl_vector_int * v);
 int gsl_vector_int_fwrite (FILE * stream, const gsl_vector_int * v);
+int gsl_vector_int_fsave (FILE * stream, const gsl_vector_int * v);
+gsl_vector_int * gsl_vector_int_fload (FILE * stream);
+const gsl_vector_int * gsl_vector_int_mmap (const char * filename);
+void gsl_vector_int_munmap (const gsl_vector_int * v);
 int gsl_vector_int_fscanf (FILE * stream, gsl_vector_int * v);
 int gsl_vector_int_fprintf (FILE * stream, const gsl_vector_int * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_int_mul (gsl_vector_int * a, const gsl_vector_int * b);
 int gsl_vector_int_div (gsl_vector_int * a, const gsl_vector_int * b);
 int gsl_vector_int_scale (gsl_vector_int * a, const double x);
 int gsl_vector_int_add_constant (gsl_vector_int * a, const double x);
+int gsl_vector_int_axpby (const double alpha, const gsl_vector_int * x, const double beta, gsl_vector_int * y);
+int gsl_vector_int_axpbyc (const double alpha, const gsl_vector_int * x, const double beta, const double c, gsl_vector_int * y);
+int gsl_vector_int_map (gsl_vector_int * a, int (* f) (int x, void * params), void * params);
 
 int gsl_vector_int_equal (const gsl_vector_int * u, 
                             const gsl_vector_int * v);
@@ -129,6 +129,10 @@ int gsl_vector_long_set_basis (gsl_vector_long * v, size_t i);
 
 int gsl_vector_long_fread (FILE * stream, gsl_vector_long * v);
 int gsl_vector_long_fwrite (FILE * stream, const gsl_vector_long * v);
+int gsl_vector_long_fsave (FILE * stream, const gsl_vector_long * v);
+gsl_vector_long * gsl_vector_long_fload (FILE * stream);
+const gsl_vector_long * gsl_vector_long_mmap (const char * filename);
+void gsl_vector_long_munmap (const gsl_vector_long * v);
 int gsl_vector_long_fscanf (FILE * stream, gsl_vector_long * v);
 int gsl_vector_long_fprintf (FILE * stream, const gsl_vector_long * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_long_mul (gsl_vector_long * a, const gsl_vector_long * b);
 int gsl_vector_long_div (gsl_vector_long * a, const gsl_vector_long * b);
 int gsl_vector_long_scale (gsl_vector_long * a, const double x);
 int gsl_vector_long_add_constant (gsl_vector_long * a, const double x);
+int gsl_vector_long_axpby (const double alpha, const gsl_vector_long * x, const double beta, gsl_vector_long * y);
+int gsl_vector_long_axpbyc (const double alpha, const gsl_vector_long * x, const double beta, const double c, gsl_vector_long * y);
+int gsl_vector_long_map (gsl_vector_long * a, long (* f) (long x, void * params), void * params);
 
 int gsl_vector_long_equal (const gsl_vector_long * u, 
                             const gsl_vector_long * v);
@@ -129,6 +129,10 @@ int gsl_vector_long_double_set_basis (gsl_vector_long_double * v, size_t i);
 
 int gsl_vector_long_double_fread (FILE * stream, gsl_vector_long_double * v);
 int gsl_vector_long_double_fwrite (FILE * stream, const gsl_vector_long_double * v);
+int gsl_vector_long_double_fsave (FILE * stream, const gsl_vector_long_double * v);
+gsl_vector_long_double * gsl_vector_long_double_fload (FILE * stream);
+const gsl_vector_long_double * gsl_vector_long_double_mmap (const char * filename);
+void gsl_vector_long_double_munmap (const gsl_vector_long_double * v);
 int gsl_vector_long_double_fscanf (FILE * stream, gsl_vector_long_double * v);
 int gsl_vector_long_double_fprintf (FILE * stream, const gsl_vector_long_double * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_long_double_mul (gsl_vector_long_double * a, const gsl_vector_lon
 int gsl_vector_long_double_div (gsl_vector_long_double * a, const gsl_vector_long_double * b);
 int gsl_vector_long_double_scale (gsl_vector_long_double * a, const double x);
 int gsl_vector_long_double_add_constant (gsl_vector_long_double * a, const double x);
+int gsl_vector_long_double_axpby (const double alpha, const gsl_vector_long_double * x, const double beta, gsl_vector_long_double * y);
+int gsl_vector_long_double_axpbyc (const double alpha, const gsl_vector_long_double * x, const double beta, const double c, gsl_vector_long_double * y);
+int gsl_vector_long_double_map (gsl_vector_long_double * a, long double (* f) (long double x, void * params), void * params);
 
 int gsl_vector_long_double_equal (const gsl_vector_long_double * u, 
                             const gsl_vector_long_double * v);
@@ -129,6 +129,10 @@ int gsl_vector_short_set_basis (gsl_vector_short * v, size_t i);
 
 int gsl_vector_short_fread (FILE * stream, gsl_vector_short * v);
 int gsl_vector_short_fwrite (FILE * stream, const gsl_vector_short * v);
+int gsl_vector_short_fsave (FILE * stream, const gsl_vector_short * v);
+gsl_vector_short * gsl_vector_short_fload (FILE * stream);
+const gsl_vector_short * gsl_vector_short_mmap (const char * filename);
+void gsl_vector_short_munmap (const gsl_vector_short * v);
 int gsl_vector_short_fscanf (FILE * stream, gsl_vector_short * v);
 int gsl_vector_short_fprintf (FILE * stream, const gsl_vector_short * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_short_mul (gsl_vector_short * a, const gsl_vector_short * b);
 int gsl_vector_short_div (gsl_vector_short * a, const gsl_vector_short * b);
 int gsl_vector_short_scale (gsl_vector_short * a, const double x);
 int gsl_vector_short_add_constant (gsl_vector_short * a, const double x);
+int gsl_vector_short_axpby (const double alpha, const gsl_vector_short * x, const double beta, gsl_vector_short * y);
+int gsl_vector_short_axpbyc (const double alpha, const gsl_vector_short * x, const double beta, const double c, gsl_vector_short * y);
+int gsl_vector_short_map (gsl_vector_short * a, short (* f) (short x, void * params), void * params);
 
 int gsl_vector_short_equal (const gsl_vector_short * u, 
                             const gsl_vector_short * v);
@@ -129,6 +129,10 @@ int gsl_vector_uchar_set_basis (gsl_vector_uchar * v, size_t i);
 
 int gsl_vector_uchar_fread (FILE * stream, gsl_vector_uchar * v);
 int gsl_vector_uchar_fwrite (FILE * stream, const gsl_vector_uchar * v);
+int gsl_vector_uchar_fsave (FILE * stream, const gsl_vector_uchar * v);
+gsl_vector_uchar * gsl_vector_uchar_fload (FILE * stream);
+const gsl_vector_uchar * gsl_vector_uchar_mmap (const char * filename);
+void gsl_vector_uchar_munmap (const gsl_vector_uchar * v);
 int gsl_vector_uchar_fscanf (FILE * stream, gsl_vector_uchar * v);
 int gsl_vector_uchar_fprintf (FILE * stream, const gsl_vector_uchar * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_uchar_mul (gsl_vector_uchar * a, const gsl_vector_uchar * b);
 int gsl_vector_uchar_div (gsl_vector_uchar * a, const gsl_vector_uchar * b);
 int gsl_vector_uchar_scale (gsl_vector_uchar * a, const double x);
 int gsl_vector_uchar_add_constant (gsl_vector_uchar * a, const double x);
+int gsl_vector_uchar_axpby (const double alpha, const gsl_vector_uchar * x, const double beta, gsl_vector_uchar * y);
+int gsl_vector_uchar_axpbyc (const double alpha, const gsl_vector_uchar * x, const double beta, const double c, gsl_vector_uchar * y);
+int gsl_vector_uchar_map (gsl_vector_uchar * a, unsigned char (* f) (unsigned char x, void * params), void * params);
 
 int gsl_vector_uchar_equal (const gsl_vector_uchar * u, 
                             const gsl_vector_uchar * v);
@@ -129,6 +129,10 @@ int gsl_vector_uint_set_basis (gsl_vector_uint * v, size_t i);
 
 int gsl_vector_uint_fread (FILE * stream, gsl_vector_uint * v);
 int gsl_vector_uint_fwrite (FILE * stream, const gsl_vector_uint * v);
+int gsl_vector_uint_fsave (FILE * stream, const gsl_vector_uint * v);
+gsl_vector_uint * gsl_vector_uint_fload (FILE * stream);
+const gsl_vector_uint * gsl_vector_uint_mmap (const char * filename);
+void gsl_vector_uint_munmap (const gsl_vector_uint * v);
 int gsl_vector_uint_fscanf (FILE * stream, gsl_vector_uint * v);
 int gsl_vector_uint_fprintf (FILE * stream, const gsl_vector_uint * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_uint_mul (gsl_vector_uint * a, const gsl_vector_uint * b);
 int gsl_vector_uint_div (gsl_vector_uint * a, const gsl_vector_uint * b);
 int gsl_vector_uint_scale (gsl_vector_uint * a, const double x);
 int gsl_vector_uint_add_constant (gsl_vector_uint * a, const double x);
+int gsl_vector_uint_axpby (const double alpha, const gsl_vector_uint * x, const double beta, gsl_vector_uint * y);
+int gsl_vector_uint_axpbyc (const double alpha, const gsl_vector_uint * x, const double beta, const double c, gsl_vector_uint * y);
+int gsl_vector_uint_map (gsl_vector_uint * a, unsigned int (* f) (unsigned int x, void * params), void * params);
 
 int gsl_vector_uint_equal (const gsl_vector_uint * u, 
                             const gsl_vector_uint * v);
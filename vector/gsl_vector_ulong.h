@@ -129,6 +129,10 @@ int gsl_vector_ulong_set_basis (gsl_vector_ulong * v, size_t i);
 
 int gsl_vector_ulong_fread (FILE * stream, gsl_vector_ulong * v);
 int gsl_vector_ulong_fwrite (FILE * stream, const gsl_vector_ulong * v);
+int gsl_vector_ulong_fsave (FILE * stream, const gsl_vector_ulong * v);
+gsl_vector_ulong * gsl_vector_ulong_fload (FILE * stream);
+const gsl_vector_ulong * gsl_vector_ulong_mmap (const char * filename);
+void gsl_vector_ulong_munmap (const gsl_vector_ulong * v);
 int gsl_vector_ulong_fscanf (FILE * stream, gsl_vector_ulong * v);
 int gsl_vector_ulong_fprintf (FILE * stream, const gsl_vector_ulong * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_ulong_mul (gsl_vector_ulong * a, const gsl_vector_ulong * b);
 int gsl_vector_ulong_div (gsl_vector_ulong * a, const gsl_vector_ulong * b);
 int gsl_vector_ulong_scale (gsl_vector_ulong * a, const double x);
 int gsl_vector_ulong_add_constant (gsl_vector_ulong * a, const double x);
+int gsl_vector_ulong_axpby (const double alpha, const gsl_vector_ulong * x, const double beta, gsl_vector_ulong * y);
+int gsl_vector_ulong_axpbyc (const double alpha, const gsl_vector_ulong * x, const double beta, const double c, gsl_vector_ulong * y);
+int gsl_vector_ulong_map (gsl_vector_ulong * a, unsigned long (* f) (unsigned long x, void * params), void * params);
 
 int gsl_vector_ulong_equal (const gsl_vector_ulong * u, 
                             const gsl_vector_ulong * v);
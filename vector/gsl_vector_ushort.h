@@ -129,6 +129,10 @@ int gsl_vector_ushort_set_basis (gsl_vector_ushort * v, size_t i);
 
 int gsl_vector_ushort_fread (FILE * stream, gsl_vector_ushort * v);
 int gsl_vector_ushort_fwrite (FILE * stream, const gsl_vector_ushort * v);
+int gsl_vector_ushort_fsave (FILE * stream, const gsl_vector_ushort * v);
+gsl_vector_ushort * gsl_vector_ushort_fload (FILE * stream);
+const gsl_vector_ushort * gsl_vector_ushort_mmap (const char * filename);
+void gsl_vector_ushort_munmap (const gsl_vector_ushort * v);
 int gsl_vector_ushort_fscanf (FILE * stream, gsl_vector_ushort * v);
 int gsl_vector_ushort_fprintf (FILE * stream, const gsl_vector_ushort * v,
                               const char *format);
@@ -154,6 +158,9 @@ int gsl_vector_ushort_mul (gsl_vector_ushort * a, const gsl_vector_ushort * b);
 int gsl_vector_ushort_div (gsl_vector_ushort * a, const gsl_vector_ushort * b);
 int gsl_vector_ushort_scale (gsl_vector_ushort * a, const double x);
 int gsl_vector_ushort_add_constant (gsl_vector_ushort * a, const double x);
+int gsl_vector_ushort_axpby (const double alpha, const gsl_vector_ushort * x, const double beta, gsl_vector_ushort * y);
+int gsl_vector_ushort_axpbyc (const double alpha, const gsl_vector_ushort * x, const double beta, const double c, gsl_vector_ushort * y);
+int gsl_vector_ushort_map (gsl_vector_ushort * a, unsigned short (* f) (unsigned short x, void * params), void * params);
 
 int gsl_vector_ushort_equal (const gsl_vector_ushort * u, 
                             const gsl_vector_ushort * v);
@@ -33,10 +33,23 @@ FUNCTION(gsl_vector, add) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < 2 * N; i++)
+            {
+              pa[i] += pb[i];
+            }
+        }
+      else
         {
-          a->data[2 * i * stride_a] += b->data[2 * i * stride_b];
-          a->data[2 * i * stride_a + 1] += b->data[2 * i * stride_b + 1];
+          for (i = 0; i < N; i++)
+            {
+              a->data[2 * i * stride_a] += b->data[2 * i * stride_b];
+              a->data[2 * i * stride_a + 1] += b->data[2 * i * stride_b + 1];
+            }
         }
       
       return GSL_SUCCESS;
@@ -59,10 +72,23 @@ FUNCTION(gsl_vector, sub) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < 2 * N; i++)
+            {
+              pa[i] -= pb[i];
+            }
+        }
+      else
         {
-          a->data[2 * i * stride_a] -= b->data[2 * i * stride_b];
-          a->data[2 * i * stride_a + 1] -= b->data[2 * i * stride_b + 1];
+          for (i = 0; i < N; i++)
+            {
+              a->data[2 * i * stride_a] -= b->data[2 * i * stride_b];
+              a->data[2 * i * stride_a + 1] -= b->data[2 * i * stride_b + 1];
+            }
         }
       
       return GSL_SUCCESS;
@@ -172,11 +198,101 @@ FUNCTION(gsl_vector, add_constant) (TYPE(gsl_vector) * a, const BASE x)
   ATOMIC xr = GSL_REAL(x);
   ATOMIC xi = GSL_IMAG(x);
   
-  for (i = 0; i < N; i++)
+  if (stride == 1)
     {
-      a->data[2 * i * stride] += xr;
-      a->data[2 * i * stride + 1] += xi;
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < N; i++)
+        {
+          pa[2 * i] += xr;
+          pa[2 * i + 1] += xi;
+        }
+    }
+  else
+    {
+      for (i = 0; i < N; i++)
+        {
+          a->data[2 * i * stride] += xr;
+          a->data[2 * i * stride + 1] += xi;
+        }
     }
   
   return GSL_SUCCESS;
 }
+
+/* Compute y = alpha x + beta y in a single pass over x and y */
+
+int
+FUNCTION(gsl_vector, axpby) (const BASE alpha, const TYPE(gsl_vector) * x,
+                             const BASE beta, TYPE(gsl_vector) * y)
+{
+  const BASE zero = ZERO;
+
+  return FUNCTION(gsl_vector, axpbyc) (alpha, x, beta, zero, y);
+}
+
+/* Compute y = alpha x + beta y + c in a single pass over x and y */
+
+int
+FUNCTION(gsl_vector, axpbyc) (const BASE alpha, const TYPE(gsl_vector) * x,
+                              const BASE beta, const BASE c,
+                              TYPE(gsl_vector) * y)
+{
+  const size_t N = x->size;
+
+  if (y->size != N)
+    {
+      GSL_ERROR ("vectors must have same length", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t stride_x = x->stride;
+      const size_t stride_y = y->stride;
+
+      const ATOMIC ar = GSL_REAL(alpha);
+      const ATOMIC ai = GSL_IMAG(alpha);
+      const ATOMIC br = GSL_REAL(beta);
+      const ATOMIC bi = GSL_IMAG(beta);
+      const ATOMIC cr = GSL_REAL(c);
+      const ATOMIC ci = GSL_IMAG(c);
+
+      size_t i;
+
+      for (i = 0; i < N; i++)
+        {
+          const ATOMIC * const px = x->data + 2 * i * stride_x;
+          ATOMIC * const py = y->data + 2 * i * stride_y;
+
+          const ATOMIC xr = px[0];
+          const ATOMIC xi = px[1];
+          const ATOMIC yr = py[0];
+          const ATOMIC yi = py[1];
+
+          py[0] = (ar * xr - ai * xi) + (br * yr - bi * yi) + cr;
+          py[1] = (ar * xi + ai * xr) + (br * yi + bi * yr) + ci;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Replace each element a_i by f(a_i, params) */
+
+int
+FUNCTION(gsl_vector, map) (TYPE(gsl_vector) * a,
+                           BASE (* f) (BASE z, void * params),
+                           void * params)
+{
+  const size_t N = a->size;
+  const size_t stride = a->stride;
+
+  size_t i;
+
+  for (i = 0; i < N; i++)
+    {
+      BASE * const z = (BASE *) (a->data + 2 * i * stride);
+      *z = f (*z, params);
+    }
+
+  return GSL_SUCCESS;
+}
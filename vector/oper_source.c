@@ -33,9 +33,22 @@ FUNCTION(gsl_vector, add) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              pa[i] += pb[i];
+            }
+        }
+      else
         {
-          a->data[i * stride_a] += b->data[i * stride_b];
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] += b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -58,9 +71,22 @@ FUNCTION(gsl_vector, sub) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
         {
-          a->data[i * stride_a] -= b->data[i * stride_b];
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              pa[i] -= pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] -= b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -83,9 +109,22 @@ FUNCTION(gsl_vector, mul) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
+        {
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              pa[i] *= pb[i];
+            }
+        }
+      else
         {
-          a->data[i * stride_a] *= b->data[i * stride_b];
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] *= b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -108,9 +147,22 @@ FUNCTION(gsl_vector, div) (TYPE(gsl_vector) * a, const TYPE(gsl_vector) * b)
 
       size_t i;
 
-      for (i = 0; i < N; i++)
+      if (stride_a == 1 && stride_b == 1)
         {
-          a->data[i * stride_a] /= b->data[i * stride_b];
+          ATOMIC * const pa = a->data;
+          const ATOMIC * const pb = b->data;
+
+          for (i = 0; i < N; i++)
+            {
+              pa[i] /= pb[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            {
+              a->data[i * stride_a] /= b->data[i * stride_b];
+            }
         }
       
       return GSL_SUCCESS;
@@ -124,10 +176,22 @@ FUNCTION(gsl_vector, scale) (TYPE(gsl_vector) * a, const double x)
   const size_t stride = a->stride;
   
   size_t i;
-  
-  for (i = 0; i < N; i++)
+
+  if (stride == 1)
+    {
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < N; i++)
+        {
+          pa[i] *= x;
+        }
+    }
+  else
     {
-      a->data[i * stride] *= x;
+      for (i = 0; i < N; i++)
+        {
+          a->data[i * stride] *= x;
+        }
     }
   
   return GSL_SUCCESS;
@@ -140,12 +204,140 @@ FUNCTION(gsl_vector, add_constant) (TYPE(gsl_vector) * a, const double x)
   const size_t stride = a->stride;
   
   size_t i;
-  
-  for (i = 0; i < N; i++)
+
+  if (stride == 1)
     {
-      a->data[i * stride] += x;
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < N; i++)
+        {
+          pa[i] += x;
+        }
+    }
+  else
+    {
+      for (i = 0; i < N; i++)
+        {
+          a->data[i * stride] += x;
+        }
     }
   
   return GSL_SUCCESS;
 }
 
+/* Compute y = alpha x + beta y in a single pass over x and y */
+
+int
+FUNCTION(gsl_vector, axpby) (const double alpha, const TYPE(gsl_vector) * x,
+                             const double beta, TYPE(gsl_vector) * y)
+{
+  const size_t N = x->size;
+
+  if (y->size != N)
+    {
+      GSL_ERROR ("vectors must have same length", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t stride_x = x->stride;
+      const size_t stride_y = y->stride;
+
+      size_t i;
+
+      if (stride_x == 1 && stride_y == 1)
+        {
+          const ATOMIC * const px = x->data;
+          ATOMIC * const py = y->data;
+
+          for (i = 0; i < N; i++)
+            {
+              py[i] = alpha * px[i] + beta * py[i];
+            }
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            {
+              y->data[i * stride_y] = alpha * x->data[i * stride_x]
+                                      + beta * y->data[i * stride_y];
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Compute y = alpha x + beta y + c in a single pass over x and y */
+
+int
+FUNCTION(gsl_vector, axpbyc) (const double alpha, const TYPE(gsl_vector) * x,
+                              const double beta, const double c,
+                              TYPE(gsl_vector) * y)
+{
+  const size_t N = x->size;
+
+  if (y->size != N)
+    {
+      GSL_ERROR ("vectors must have same length", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t stride_x = x->stride;
+      const size_t stride_y = y->stride;
+
+      size_t i;
+
+      if (stride_x == 1 && stride_y == 1)
+        {
+          const ATOMIC * const px = x->data;
+          ATOMIC * const py = y->data;
+
+          for (i = 0; i < N; i++)
+            {
+              py[i] = alpha * px[i] + beta * py[i] + c;
+            }
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            {
+              y->data[i * stride_y] = alpha * x->data[i * stride_x]
+                                      + beta * y->data[i * stride_y] + c;
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Replace each element a_i by f(a_i, params) */
+
+int
+FUNCTION(gsl_vector, map) (TYPE(gsl_vector) * a,
+                           BASE (* f) (BASE x, void * params),
+                           void * params)
+{
+  const size_t N = a->size;
+  const size_t stride = a->stride;
+
+  size_t i;
+
+  if (stride == 1)
+    {
+      ATOMIC * const pa = a->data;
+
+      for (i = 0; i < N; i++)
+        {
+          pa[i] = f (pa[i], params);
+        }
+    }
+  else
+    {
+      for (i = 0; i < N; i++)
+        {
+          a->data[i * stride] = f (a->data[i * stride], params);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
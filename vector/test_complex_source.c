@@ -23,6 +23,7 @@ void FUNCTION (test, file) (size_t stride, size_t N);
 void FUNCTION (test, text) (size_t stride, size_t N);
 void FUNCTION (test, trap) (size_t stride, size_t N);
 TYPE (gsl_vector) * FUNCTION(create, vector) (size_t stride, size_t N);
+BASE FUNCTION (test, map_func) (BASE z, void * params);
 
 #define TEST(expr,desc) gsl_test((expr), NAME(gsl_vector) desc " stride=%d, N=%d", stride, N)
 #define TEST2(expr,desc) gsl_test((expr), NAME(gsl_vector) desc " stride1=%d, stride2=%d, N=%d", stride1, stride2, N)
@@ -36,6 +37,15 @@ FUNCTION(create, vector) (size_t stride, size_t N)
   return v;
 }
 
+BASE
+FUNCTION (test, map_func) (BASE z, void * params)
+{
+  BASE r;
+  GSL_REAL (r) = GSL_IMAG (z) + *(const ATOMIC *) params;
+  GSL_IMAG (r) = GSL_REAL (z);
+  return r;
+}
+
 void
 FUNCTION (test, func) (size_t stride, size_t N)
 {
@@ -625,6 +635,68 @@ FUNCTION (test, ops) (size_t stride1, size_t stride2, size_t N)
     TEST2 (status, "_div division");
   }
 
+  {
+    int status = 0;
+    BASE alpha, beta, c;
+
+    GSL_SET_COMPLEX (&alpha, 1.0, 1.0);
+    GSL_SET_COMPLEX (&beta, 2.0, -1.0);
+    GSL_SET_COMPLEX (&c, 1.0, 2.0);
+
+    FUNCTION(gsl_vector, memcpy) (v, a);
+    FUNCTION(gsl_vector, axpbyc) (alpha, b, beta, c, v);
+
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE x = FUNCTION(gsl_vector,get) (b,i);
+        BASE y = FUNCTION(gsl_vector,get) (a,i);
+        ATOMIC real = (GSL_REAL(x) - GSL_IMAG(x))
+          + (2 * GSL_REAL(y) + GSL_IMAG(y)) + 1;
+        ATOMIC imag = (GSL_REAL(x) + GSL_IMAG(x))
+          + (2 * GSL_IMAG(y) - GSL_REAL(y)) + 2;
+        if (GSL_REAL(r) != real || GSL_IMAG(r) != imag)
+          status = 1;
+      }
+    TEST2 (status, "_axpbyc");
+
+    status = 0;
+
+    FUNCTION(gsl_vector, memcpy) (v, a);
+    FUNCTION(gsl_vector, axpby) (alpha, b, beta, v);
+
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE x = FUNCTION(gsl_vector,get) (b,i);
+        BASE y = FUNCTION(gsl_vector,get) (a,i);
+        ATOMIC real = (GSL_REAL(x) - GSL_IMAG(x))
+          + (2 * GSL_REAL(y) + GSL_IMAG(y));
+        ATOMIC imag = (GSL_REAL(x) + GSL_IMAG(x))
+          + (2 * GSL_IMAG(y) - GSL_REAL(y));
+        if (GSL_REAL(r) != real || GSL_IMAG(r) != imag)
+          status = 1;
+      }
+    TEST2 (status, "_axpby");
+  }
+
+  {
+    int status = 0;
+    ATOMIC k = 3;
+
+    FUNCTION(gsl_vector, memcpy) (v, a);
+    FUNCTION(gsl_vector, map) (v, FUNCTION (test, map_func), &k);
+
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE y = FUNCTION(gsl_vector,get) (a,i);
+        if (GSL_REAL(r) != GSL_IMAG(y) + 3 || GSL_IMAG(r) != GSL_REAL(y))
+          status = 1;
+      }
+    TEST2 (status, "_map");
+  }
+
   FUNCTION(gsl_vector, free) (a);
   FUNCTION(gsl_vector, free) (b);
   FUNCTION(gsl_vector, free) (v);
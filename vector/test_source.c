@@ -23,6 +23,7 @@ void FUNCTION (test, file) (size_t stride, size_t N);
 void FUNCTION (test, text) (size_t stride, size_t N);
 void FUNCTION (test, trap) (size_t stride, size_t N);
 TYPE (gsl_vector) * FUNCTION(create, vector) (size_t stride, size_t N);
+BASE FUNCTION (test, map_func) (BASE x, void * params);
 
 #define TEST(expr,desc) gsl_test((expr), NAME(gsl_vector) desc " stride=%d, N=%d", stride, N)
 #define TEST2(expr,desc) gsl_test((expr), NAME(gsl_vector) desc " stride1=%d, stride2=%d, N=%d", stride1, stride2, N)
@@ -36,6 +37,12 @@ FUNCTION(create, vector) (size_t stride, size_t N)
     return v;
 }
 
+BASE
+FUNCTION (test, map_func) (BASE x, void * params)
+{
+  return x + *(const BASE *) params;
+}
+
 void
 FUNCTION (test, func) (size_t stride, size_t N)
 {
@@ -704,6 +711,64 @@ FUNCTION (test, ops) (size_t stride1, size_t stride2, size_t N)
     TEST2 (status, "_div division");
   }
 
+  for (i = 0; i < N; i++)
+    {
+      FUNCTION (gsl_vector, set) (a, i, (BASE)(i % 10));
+      FUNCTION (gsl_vector, set) (v, i, (BASE)(i % 7));
+    }
+
+  FUNCTION(gsl_vector, axpby) (2.0, a, 3.0, v);
+
+  {
+    int status = 0;
+
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE z = (BASE)(2 * (i % 10) + 3 * (i % 7));
+        if (r != z)
+          status = 1;
+      }
+    TEST2 (status, "_axpby");
+  }
+
+  for (i = 0; i < N; i++)
+    {
+      FUNCTION (gsl_vector, set) (a, i, (BASE)(i % 10));
+      FUNCTION (gsl_vector, set) (v, i, (BASE)(i % 7));
+    }
+
+  FUNCTION(gsl_vector, axpbyc) (2.0, a, 3.0, 5.0, v);
+
+  {
+    int status = 0;
+
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (v,i);
+        BASE z = (BASE)(2 * (i % 10) + 3 * (i % 7) + 5);
+        if (r != z)
+          status = 1;
+      }
+    TEST2 (status, "_axpbyc");
+  }
+
+  {
+    int status = 0;
+    BASE k = (BASE) 3;
+
+    FUNCTION(gsl_vector, map) (a, FUNCTION (test, map_func), &k);
+
+    for (i = 0; i < N; i++)
+      {
+        BASE r = FUNCTION(gsl_vector,get) (a,i);
+        BASE z = (BASE)(i % 10 + 3);
+        if (r != z)
+          status = 1;
+      }
+    TEST2 (status, "_map");
+  }
+
   FUNCTION(gsl_vector, free) (a);
   FUNCTION(gsl_vector, free) (b);
   FUNCTION(gsl_vector, free) (v);
@@ -748,6 +813,37 @@ FUNCTION (test, file) (size_t stride, size_t N)
     fclose (f);
   }
 
+  {
+    FILE *f = fopen ("test.dat", "wb");
+
+    FUNCTION (gsl_vector, fsave) (f, v);
+
+    fclose (f);
+  }
+
+  {
+    FILE *f = fopen ("test.dat", "rb");
+    TYPE (gsl_vector) * u = FUNCTION (gsl_vector, fload) (f);
+    const TYPE (gsl_vector) * p = FUNCTION (gsl_vector, mmap) ("test.dat");
+
+    status = (u == 0 || u->size != N || p == 0 || p->size != N);
+
+    for (i = 0; i < N && !status; i++)
+      {
+        if (FUNCTION (gsl_vector, get) (u, i) != (ATOMIC) (N - i))
+          status = 1;
+
+        if (FUNCTION (gsl_vector, get) (p, i) != (ATOMIC) (N - i))
+          status = 1;
+      };
+
+    TEST (status, "_save, load and mmap");
+
+    fclose (f);
+    FUNCTION (gsl_vector, free) (u);
+    FUNCTION (gsl_vector, munmap) (p);
+  }
+
   FUNCTION (gsl_vector, free) (v);      /* free whatever is in v */
   FUNCTION (gsl_vector, free) (w);      /* free whatever is in w */
 }
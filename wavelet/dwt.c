@@ -22,14 +22,22 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_wavelet.h>
 #include <gsl/gsl_wavelet2d.h>
 
 #define ELEMENT(a,stride,i) ((a)[(stride)*(i)])
 
+/* number of columns copied out and transformed together in 2d */
+#define DWT_COLUMN_BLOCK 8
+
 static int binary_logn (const size_t n);
+static void lifting_step (const gsl_wavelet_lifting * L, double *a, size_t stride, size_t n, gsl_wavelet_direction dir, gsl_wavelet_workspace * work);
+static size_t lifting_step_n (const gsl_wavelet_lifting * L, double *a, size_t stride, size_t n, gsl_wavelet_boundary boundary, gsl_wavelet_direction dir, gsl_wavelet_workspace * work);
 static void dwt_step (const gsl_wavelet * w, double *a, size_t stride, size_t n, gsl_wavelet_direction dir, gsl_wavelet_workspace * work);
+static void dwt_columns (const gsl_wavelet * w, double *data, size_t tda, size_t n, size_t ncols, int step, gsl_wavelet_direction dir, gsl_wavelet_workspace * work);
 
 static int
 binary_logn (const size_t n)
@@ -54,6 +62,273 @@ binary_logn (const size_t n)
   return logn;
 }
 
+/* index of k modulo n, for negative shifts */
+
+static size_t
+lifting_mod (long k, size_t n)
+{
+  long r = k % (long) n;
+
+  return (r < 0) ? (size_t) (r + (long) n) : (size_t) r;
+}
+
+/* x[i] += sign * sum_m taps[m] y[(i + lo + m) mod nh].  The index is
+   only wrapped for the i < i0 and i >= i1 near the ends, and the
+   interior is updated one tap at a time in contiguous loops. */
+
+static void
+lift_periodic (double *x, const double *y, size_t nh, int lo,
+               const double *taps, size_t ntaps, double sign)
+{
+  long i0 = (lo < 0) ? -lo : 0;
+  long i1 = GSL_MIN ((long) nh, (long) nh - lo - (long) ntaps + 1);
+  long i;
+  size_t m;
+
+  if (i1 < i0)
+    i0 = i1 = (long) nh;
+
+  for (m = 0; m < ntaps; m++)
+    {
+      const double c = sign * taps[m];
+      const double *yp = y + lo + (long) m;
+
+      for (i = i0; i < i1; i++)
+        x[i] += c * yp[i];
+    }
+
+  for (i = 0; i < (long) nh; i++)
+    {
+      if (i == i0)
+        i = i1;
+
+      if (i >= (long) nh)
+        break;
+
+      for (m = 0; m < ntaps; m++)
+        x[i] += sign * taps[m] * y[lifting_mod (i + lo + (long) m, nh)];
+    }
+}
+
+/* One level of the periodic transform by lifting.  The even and odd
+ * samples are copied to the two halves of the scratch space, updated
+ * by the lifting steps, and scaled and shifted into the smooth and
+ * detail halves of a.  This gives the same coefficients as dwt_step
+ * up to rounding.
+ */
+static void
+lifting_step (const gsl_wavelet_lifting * L, double *a, size_t stride,
+              size_t n, gsl_wavelet_direction dir,
+              gsl_wavelet_workspace * work)
+{
+  const size_t nh = n >> 1;
+  double *x[2];
+  const double *taps;
+  size_t i, k, s;
+
+  x[0] = work->scratch;
+  x[1] = work->scratch + nh;
+
+  if (dir == gsl_wavelet_forward)
+    {
+      for (i = 0; i < nh; i++)
+        {
+          x[0][i] = ELEMENT (a, stride, 2 * i);
+          x[1][i] = ELEMENT (a, stride, 2 * i + 1);
+        }
+
+      for (s = 0, taps = L->taps; s < L->nsteps; taps += L->ntaps[s++])
+        {
+          const size_t c = L->channel[s];
+          lift_periodic (x[c], x[1 - c], nh, L->lo[s], taps, L->ntaps[s], 1.0);
+        }
+
+      for (k = 0; k < 2; k++)
+        {
+          const double *y = x[k ^ L->swap];
+          const size_t sh = lifting_mod (L->shift[k], nh);
+
+          for (i = 0; i < nh; i++)
+            {
+              const size_t j = (i + sh < nh) ? i + sh : i + sh - nh;
+              ELEMENT (a, stride, i + k * nh) = L->k[k] * y[j];
+            }
+        }
+    }
+  else
+    {
+      for (k = 0; k < 2; k++)
+        {
+          double *y = x[k ^ L->swap];
+          const size_t sh = lifting_mod (L->shift[k], nh);
+
+          for (i = 0; i < nh; i++)
+            {
+              const size_t j = (i + sh < nh) ? i + sh : i + sh - nh;
+              y[j] = ELEMENT (a, stride, i + k * nh) / L->k[k];
+            }
+        }
+
+      for (taps = L->taps, s = 0; s < L->nsteps; s++)
+        taps += L->ntaps[s];
+
+      for (s = L->nsteps; s-- > 0;)
+        {
+          const size_t c = L->channel[s];
+          taps -= L->ntaps[s];
+          lift_periodic (x[c], x[1 - c], nh, L->lo[s], taps, L->ntaps[s], -1.0);
+        }
+
+      for (i = 0; i < nh; i++)
+        {
+          ELEMENT (a, stride, 2 * i) = x[0][i];
+          ELEMENT (a, stride, 2 * i + 1) = x[1][i];
+        }
+    }
+}
+
+/* index j of a channel of length len extended past its ends, or -1
+   for a zero value */
+
+static long
+lifting_boundary (long j, size_t len, gsl_wavelet_boundary boundary)
+{
+  const long last = (long) len - 1;
+
+  switch (boundary)
+    {
+    case gsl_wavelet_boundary_constant:
+      return (j < 0) ? 0 : last;
+
+    case gsl_wavelet_boundary_symmetric:
+      if (last == 0)
+        return 0;
+
+      while (j < 0 || j > last)
+        j = (j < 0) ? -j : 2 * last - j;
+
+      return j;
+
+    default:
+      return -1;
+    }
+}
+
+/* x[i] += sign * sum_m taps[m] y[i + lo + m] for a channel y of
+   length ny extended by the boundary rule */
+
+static void
+lift_bounded (double *x, size_t nx, const double *y, size_t ny, int lo,
+              const double *taps, size_t ntaps, double sign,
+              gsl_wavelet_boundary boundary)
+{
+  size_t i, m;
+
+  for (i = 0; i < nx; i++)
+    {
+      const long j0 = (long) i + lo;
+      double sum = 0.0;
+
+      if (j0 >= 0 && j0 + (long) ntaps <= (long) ny)
+        {
+          const double *yp = y + j0;
+
+          for (m = 0; m < ntaps; m++)
+            sum += taps[m] * yp[m];
+        }
+      else
+        {
+          for (m = 0; m < ntaps; m++)
+            {
+              long j = j0 + (long) m;
+
+              if (j < 0 || j >= (long) ny)
+                j = lifting_boundary (j, ny, boundary);
+
+              if (j >= 0)
+                sum += taps[m] * y[j];
+            }
+        }
+
+      x[i] += sign * sum;
+    }
+}
+
+/* One level of the non-periodic transform of length n >= 2 by
+ * lifting.  The channels of ceil(n/2) even and floor(n/2) odd samples
+ * are updated as in lifting_step, reading past their ends by the
+ * boundary rule, and are scaled without the shifts of the periodic
+ * case.  Each step only reads the other channel, so the inverse
+ * subtracts exactly the same sums whatever the boundary.  Returns the
+ * length of the smooth part, which is stored first.
+ */
+static size_t
+lifting_step_n (const gsl_wavelet_lifting * L, double *a, size_t stride,
+                size_t n, gsl_wavelet_boundary boundary,
+                gsl_wavelet_direction dir, gsl_wavelet_workspace * work)
+{
+  size_t len[2];
+  double *x[2];
+  const double *taps;
+  size_t i, k, s, i0;
+
+  len[0] = (n + 1) >> 1;
+  len[1] = n >> 1;
+  x[0] = work->scratch;
+  x[1] = work->scratch + len[0];
+
+  if (dir == gsl_wavelet_forward)
+    {
+      for (i = 0; i < n; i++)
+        x[i & 1][i >> 1] = ELEMENT (a, stride, i);
+
+      for (s = 0, taps = L->taps; s < L->nsteps; taps += L->ntaps[s++])
+        {
+          const size_t c = L->channel[s];
+          lift_bounded (x[c], len[c], x[1 - c], len[1 - c], L->lo[s],
+                        taps, L->ntaps[s], 1.0, boundary);
+        }
+
+      for (i0 = 0, k = 0; k < 2; i0 += len[k ^ L->swap], k++)
+        {
+          const double *y = x[k ^ L->swap];
+
+          for (i = 0; i < len[k ^ L->swap]; i++)
+            ELEMENT (a, stride, i0 + i) = L->k[k] * y[i];
+        }
+    }
+  else
+    {
+      for (i0 = 0, k = 0; k < 2; i0 += len[k ^ L->swap], k++)
+        {
+          double *y = x[k ^ L->swap];
+
+          for (i = 0; i < len[k ^ L->swap]; i++)
+            y[i] = ELEMENT (a, stride, i0 + i) / L->k[k];
+        }
+
+      for (taps = L->taps, s = 0; s < L->nsteps; s++)
+        taps += L->ntaps[s];
+
+      for (s = L->nsteps; s-- > 0;)
+        {
+          const size_t c = L->channel[s];
+          taps -= L->ntaps[s];
+          lift_bounded (x[c], len[c], x[1 - c], len[1 - c], L->lo[s],
+                        taps, L->ntaps[s], -1.0, boundary);
+        }
+
+      for (i = 0; i < n; i++)
+        ELEMENT (a, stride, i) = x[i & 1][i >> 1];
+    }
+
+  return len[L->swap];
+}
+
+/* One level of the periodic transform, convolving with the filter
+ * taps directly.  This is used for filters without a lifting
+ * factorization.
+ */
 static void
 dwt_step (const gsl_wavelet * w, double *a, size_t stride, size_t n,
           gsl_wavelet_direction dir, gsl_wavelet_workspace * work)
@@ -64,7 +339,13 @@ dwt_step (const gsl_wavelet * w, double *a, size_t stride, size_t n,
   size_t k;
   size_t n1, ni, nh, nmod;
 
-  for (i = 0; i < work->n; i++)
+  if (w->lifting)
+    {
+      lifting_step (w->lifting, a, stride, n, dir, work);
+      return;
+    }
+
+  for (i = 0; i < n; i++)
     {
       work->scratch[i] = 0.0;
     }
@@ -81,13 +362,27 @@ dwt_step (const gsl_wavelet * w, double *a, size_t stride, size_t n,
         {
           double h = 0, g = 0;
 
-          ni = i + nmod;
-          
-          for (k = 0; k < w->nc; k++)
+          ni = n1 & (i + nmod);
+
+          if (ni + w->nc <= n)
+            {
+              /* filter support does not wrap around */
+              const double *ap = &ELEMENT (a, stride, ni);
+
+              for (k = 0; k < w->nc; k++)
+                {
+                  h += w->h1[k] * ap[stride * k];
+                  g += w->g1[k] * ap[stride * k];
+                }
+            }
+          else
             {
-              jf = n1 & (ni + k);
-              h += w->h1[k] * ELEMENT (a, stride, jf);
-              g += w->g1[k] * ELEMENT (a, stride, jf);
+              for (k = 0; k < w->nc; k++)
+                {
+                  jf = n1 & (ni + k);
+                  h += w->h1[k] * ELEMENT (a, stride, jf);
+                  g += w->g1[k] * ELEMENT (a, stride, jf);
+                }
             }
 
           work->scratch[ii] += h;
@@ -100,11 +395,24 @@ dwt_step (const gsl_wavelet * w, double *a, size_t stride, size_t n,
         {
           ai = ELEMENT (a, stride, ii);
           ai1 = ELEMENT (a, stride, ii + nh);
-          ni = i + nmod;
-          for (k = 0; k < w->nc; k++)
+          ni = n1 & (i + nmod);
+
+          if (ni + w->nc <= n)
+            {
+              double *sp = work->scratch + ni;
+
+              for (k = 0; k < w->nc; k++)
+                {
+                  sp[k] += (w->h2[k] * ai + w->g2[k] * ai1);
+                }
+            }
+          else
             {
-              jf = (n1 & (ni + k));
-              work->scratch[jf] += (w->h2[k] * ai + w->g2[k] * ai1);
+              for (k = 0; k < w->nc; k++)
+                {
+                  jf = (n1 & (ni + k));
+                  work->scratch[jf] += (w->h2[k] * ai + w->g2[k] * ai1);
+                }
             }
         }
     }
@@ -115,6 +423,66 @@ dwt_step (const gsl_wavelet * w, double *a, size_t stride, size_t n,
     }
 }
 
+/* Transform the first n elements of the columns 0 .. ncols-1 of data,
+   either completely or by a single dwt_step if step is nonzero.  The
+   columns are copied in blocks into a contiguous buffer so that the
+   strided accesses of the filter are replaced by the row-wise copies,
+   which use whole cache lines.  If the buffer cannot be allocated the
+   columns are transformed in place. */
+
+static void
+dwt_columns (const gsl_wavelet * w, double *data, size_t tda, size_t n,
+             size_t ncols, int step, gsl_wavelet_direction dir,
+             gsl_wavelet_workspace * work)
+{
+  double *buf = malloc (DWT_COLUMN_BLOCK * n * sizeof (double));
+  size_t i, j, j0;
+
+  if (buf == 0)
+    {
+      for (j = 0; j < ncols; j++)
+        {
+          if (step)
+            dwt_step (w, &ELEMENT (data, 1, j), tda, n, dir, work);
+          else
+            gsl_wavelet_transform (w, &ELEMENT (data, 1, j), tda, n, dir, work);
+        }
+
+      return;
+    }
+
+  for (j0 = 0; j0 < ncols; j0 += DWT_COLUMN_BLOCK)
+    {
+      const size_t nb = GSL_MIN (DWT_COLUMN_BLOCK, ncols - j0);
+
+      for (i = 0; i < n; i++)
+        {
+          const double *row = data + i * tda + j0;
+
+          for (j = 0; j < nb; j++)
+            buf[j * n + i] = row[j];
+        }
+
+      for (j = 0; j < nb; j++)
+        {
+          if (step)
+            dwt_step (w, buf + j * n, 1, n, dir, work);
+          else
+            gsl_wavelet_transform (w, buf + j * n, 1, n, dir, work);
+        }
+
+      for (i = 0; i < n; i++)
+        {
+          double *row = data + i * tda + j0;
+
+          for (j = 0; j < nb; j++)
+            row[j] = buf[j * n + i];
+        }
+    }
+
+  free (buf);
+}
+
 int
 gsl_wavelet_transform (const gsl_wavelet * w, 
                        double *data, size_t stride, size_t n,
@@ -172,6 +540,76 @@ gsl_wavelet_transform_inverse (const gsl_wavelet * w,
   return gsl_wavelet_transform (w, data, stride, n, gsl_wavelet_backward, work);
 }
 
+int
+gsl_wavelet_transform_n (const gsl_wavelet * w,
+                         double *data, size_t stride, size_t n,
+                         gsl_wavelet_boundary boundary,
+                         gsl_wavelet_direction dir,
+                         gsl_wavelet_workspace * work)
+{
+  size_t len[8 * sizeof (size_t)];
+  size_t m, nlevels = 0;
+
+  if (work->n < n)
+    {
+      GSL_ERROR ("not enough workspace provided", GSL_EINVAL);
+    }
+
+  if (boundary != gsl_wavelet_boundary_zero
+      && boundary != gsl_wavelet_boundary_constant
+      && boundary != gsl_wavelet_boundary_symmetric)
+    {
+      GSL_ERROR ("unknown boundary type", GSL_EINVAL);
+    }
+
+  if (w->lifting == 0)
+    {
+      GSL_ERROR ("wavelet has no lifting factorization", GSL_EUNIMPL);
+    }
+
+  /* lengths of the signal at each level, the smooth part being the
+     even or the odd samples */
+
+  for (m = n; m >= 2; nlevels++)
+    {
+      len[nlevels] = m;
+      m = w->lifting->swap ? (m >> 1) : ((m + 1) >> 1);
+    }
+
+  if (dir == gsl_wavelet_forward)
+    {
+      for (m = 0; m < nlevels; m++)
+        lifting_step_n (w->lifting, data, stride, len[m], boundary, dir, work);
+    }
+  else
+    {
+      for (m = nlevels; m-- > 0;)
+        lifting_step_n (w->lifting, data, stride, len[m], boundary, dir, work);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_wavelet_transform_n_forward (const gsl_wavelet * w,
+                                 double *data, size_t stride, size_t n,
+                                 gsl_wavelet_boundary boundary,
+                                 gsl_wavelet_workspace * work)
+{
+  return gsl_wavelet_transform_n (w, data, stride, n, boundary,
+                                  gsl_wavelet_forward, work);
+}
+
+int
+gsl_wavelet_transform_n_inverse (const gsl_wavelet * w,
+                                 double *data, size_t stride, size_t n,
+                                 gsl_wavelet_boundary boundary,
+                                 gsl_wavelet_workspace * work)
+{
+  return gsl_wavelet_transform_n (w, data, stride, n, boundary,
+                                  gsl_wavelet_backward, work);
+}
+
 
 /* Leaving this out for now BJG */
 #if 0
@@ -217,17 +655,11 @@ gsl_wavelet2d_transform (const gsl_wavelet * w,
         {
           gsl_wavelet_transform (w, &ELEMENT(data, tda, i), 1, size1, dir, work);
         }
-      for (i = 0; i < size2; i++)       /* for every column j */
-        {
-          gsl_wavelet_transform (w, &ELEMENT(data, 1, i), tda, size2, dir, work);
-        }
+      dwt_columns (w, data, tda, size2, size2, 0, dir, work);
     }
   else
     {
-      for (i = 0; i < size2; i++)       /* for every column j */
-        {
-          gsl_wavelet_transform (w, &ELEMENT(data, 1, i), tda, size2, dir, work);
-        }
+      dwt_columns (w, data, tda, size2, size2, 0, dir, work);
       for (i = 0; i < size1; i++)       /* for every row j */
         {
           gsl_wavelet_transform (w, &ELEMENT(data, tda, i), 1, size1, dir, work);
@@ -273,20 +705,14 @@ gsl_wavelet2d_nstransform (const gsl_wavelet * w,
             {
               dwt_step (w, &ELEMENT(data, tda, j), 1, i, dir, work);
             }
-          for (j = 0; j < i; j++)       /* for every column j */
-            {
-              dwt_step (w, &ELEMENT(data, 1, j), tda, i, dir, work);
-            }
+          dwt_columns (w, data, tda, i, i, 1, dir, work);
         }
     }
   else
     {
       for (i = 2; i <= size1; i <<= 1)
         {
-          for (j = 0; j < i; j++)       /* for every column j */
-            {
-              dwt_step (w, &ELEMENT(data, 1, j), tda, i, dir, work);
-            }
+          dwt_columns (w, data, tda, i, i, 1, dir, work);
           for (j = 0; j < i; j++)       /* for every row j */
             {
               dwt_step (w, &ELEMENT(data, tda, j), 1, i, dir, work);
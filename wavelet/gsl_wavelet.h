@@ -49,6 +49,29 @@ typedef struct
 }
 gsl_wavelet_type;
 
+typedef enum {
+  gsl_wavelet_boundary_zero = 0,
+  gsl_wavelet_boundary_constant = 1,
+  gsl_wavelet_boundary_symmetric = 2
+}
+gsl_wavelet_boundary;
+
+/* factorization of the analysis filter bank into lifting steps,
+   applied to the even (channel 0) and odd (channel 1) samples */
+
+typedef struct
+{
+  size_t nsteps;
+  size_t *channel;       /* channel updated by each step */
+  int *lo;               /* shift of the first tap of each step */
+  size_t *ntaps;         /* number of taps of each step */
+  double *taps;          /* taps of all the steps, one after another */
+  double k[2];           /* scale factors of the smooth and detail parts */
+  int shift[2];          /* shifts of the smooth and detail parts */
+  int swap;              /* nonzero if the smooth part is channel 1 */
+}
+gsl_wavelet_lifting;
+
 typedef struct
 {
   const gsl_wavelet_type *type;
@@ -58,6 +81,7 @@ typedef struct
   const double *g2;
   size_t nc;
   size_t offset;
+  gsl_wavelet_lifting *lifting;  /* null if not available */
 }
 gsl_wavelet;
 
@@ -95,6 +119,22 @@ int gsl_wavelet_transform_inverse (const gsl_wavelet * w,
                                     double *data, size_t stride, size_t n, 
                                     gsl_wavelet_workspace * work);
 
+int gsl_wavelet_transform_n (const gsl_wavelet * w,
+                             double *data, size_t stride, size_t n,
+                             gsl_wavelet_boundary boundary,
+                             gsl_wavelet_direction dir,
+                             gsl_wavelet_workspace * work);
+
+int gsl_wavelet_transform_n_forward (const gsl_wavelet * w,
+                                     double *data, size_t stride, size_t n,
+                                     gsl_wavelet_boundary boundary,
+                                     gsl_wavelet_workspace * work);
+
+int gsl_wavelet_transform_n_inverse (const gsl_wavelet * w,
+                                     double *data, size_t stride, size_t n,
+                                     gsl_wavelet_boundary boundary,
+                                     gsl_wavelet_workspace * work);
+
 __END_DECLS
 
 #endif /* __GSL_WAVELET_H__ */
@@ -28,9 +28,136 @@ const size_t member[N_BS] =
 void
 test_1d (size_t N, size_t stride, const gsl_wavelet_type * T, size_t member);
 
+void
+test_lifting (size_t N, const gsl_wavelet_type * T, size_t member)
+{
+  gsl_wavelet_workspace *work = gsl_wavelet_workspace_alloc (N);
+  gsl_wavelet *w = gsl_wavelet_alloc (T, member);
+  gsl_wavelet_lifting *lifting = w->lifting;
+  double *a = (double *) malloc (N * sizeof (double));
+  double *b = (double *) malloc (N * sizeof (double));
+  double maxerr = 0.0;
+  size_t i;
+  int dir;
+
+  gsl_test (lifting == 0, "%s(%d) has a lifting factorization",
+            gsl_wavelet_name (w), member);
+
+  for (i = 0; i < N; i++)
+    a[i] = b[i] = urand ();
+
+  for (dir = 0; dir < 2; dir++)
+    {
+      gsl_wavelet_direction d = dir ? gsl_wavelet_backward : gsl_wavelet_forward;
+
+      gsl_wavelet_transform (w, a, 1, N, d, work);
+
+      w->lifting = 0;
+      gsl_wavelet_transform (w, b, 1, N, d, work);
+      w->lifting = lifting;
+
+      for (i = 0; i < N; i++)
+        {
+          if (fabs (a[i] - b[i]) > maxerr)
+            maxerr = fabs (a[i] - b[i]);
+        }
+    }
+
+  gsl_test (maxerr > 1e-11,
+            "%s(%d) lifting matches convolution, n = %d, maxerr = %g",
+            gsl_wavelet_name (w), member, N, maxerr);
+
+  free (b);
+  free (a);
+  gsl_wavelet_free (w);
+  gsl_wavelet_workspace_free (work);
+}
+
+
+void
+test_1d_n (size_t N, size_t stride, const gsl_wavelet_type * T,
+           size_t member, gsl_wavelet_boundary boundary)
+{
+  const char *bname[3] = { "zero", "constant", "symmetric" };
+  gsl_wavelet_workspace *work = gsl_wavelet_workspace_alloc (N);
+  gsl_wavelet *w = gsl_wavelet_alloc (T, member);
+  double *data = (double *) malloc (N * stride * sizeof (double));
+  double *orig = (double *) malloc (N * sizeof (double));
+  double maxerr = 0.0;
+  int status = 0;
+  size_t i;
+
+  for (i = 0; i < N * stride; i++)
+    data[i] = 12345.0 + i;
+
+  for (i = 0; i < N; i++)
+    orig[i] = data[i * stride] = urand ();
+
+  status |= gsl_wavelet_transform_n_forward (w, data, stride, N, boundary,
+                                             work);
+  status |= gsl_wavelet_transform_n_inverse (w, data, stride, N, boundary,
+                                             work);
+
+  for (i = 0; i < N; i++)
+    {
+      if (fabs (data[i * stride] - orig[i]) > maxerr)
+        maxerr = fabs (data[i * stride] - orig[i]);
+    }
+
+  gsl_test (status || maxerr > N * 1e-15,
+            "%s(%d) transform_n %s, n = %d, stride = %d, maxerr = %g",
+            gsl_wavelet_name (w), member, bname[boundary], N, stride,
+            maxerr);
+
+  for (i = 0, status = 0; i < N * stride; i++)
+    {
+      if (i % stride != 0)
+        status |= (data[i] != (12345.0 + i));
+    }
+
+  gsl_test (status,
+            "%s(%d) transform_n %s other data untouched, n = %d, stride = %d",
+            gsl_wavelet_name (w), member, bname[boundary], N, stride);
+
+  /* the details of a constant signal vanish when the boundary rule
+     extends it by the same constant, to the accuracy of the tabulated
+     filters */
+
+  if (boundary != gsl_wavelet_boundary_zero)
+    {
+      for (i = 0; i < N; i++)
+        data[i * stride] = 1.0;
+
+      gsl_wavelet_transform_n_forward (w, data, stride, N, boundary, work);
+
+      for (i = 1, maxerr = 0.0; i < N; i++)
+        {
+          if (fabs (data[i * stride]) > maxerr)
+            maxerr = fabs (data[i * stride]);
+        }
+
+      gsl_test (maxerr > 1e-10,
+                "%s(%d) transform_n %s constant details, n = %d, maxerr = %g",
+                gsl_wavelet_name (w), member, bname[boundary], N, maxerr);
+    }
+
+  free (orig);
+  free (data);
+  gsl_wavelet_free (w);
+  gsl_wavelet_workspace_free (work);
+}
+
+
 void
 test_2d (size_t N, size_t tda, const gsl_wavelet_type * T, size_t member, int type);
 
+void
+test_lifting (size_t N, const gsl_wavelet_type * T, size_t member);
+
+void
+test_1d_n (size_t N, size_t stride, const gsl_wavelet_type * T,
+           size_t member, gsl_wavelet_boundary boundary);
+
 int
 main (int argc, char **argv)
 {
@@ -60,6 +187,71 @@ main (int argc, char **argv)
         }
     }
 
+  /* Lifting against convolution */
+
+  for (i = 0; i < N_BS; i++)
+    {
+      test_lifting (256, gsl_wavelet_bspline, member[i]);
+      test_lifting (256, gsl_wavelet_bspline_centered, member[i]);
+    }
+
+  for (i = 4; i <= 20; i += 2)
+    {
+      test_lifting (256, gsl_wavelet_daubechies, i);
+      test_lifting (256, gsl_wavelet_daubechies_centered, i);
+    }
+
+  test_lifting (256, gsl_wavelet_haar, 2);
+  test_lifting (256, gsl_wavelet_haar_centered, 2);
+
+  /* Non-periodic transforms of any length */
+
+  for (N = 1; N <= 1000; N = (N < 70) ? N + 1 : 2 * N - 1)
+    {
+      for (stride = 1; stride <= 3; stride += 2)
+        {
+          gsl_wavelet_boundary b;
+
+          for (b = gsl_wavelet_boundary_zero;
+               b <= gsl_wavelet_boundary_symmetric; b++)
+            {
+              for (i = 0; i < N_BS; i++)
+                {
+                  test_1d_n (N, stride, gsl_wavelet_bspline, member[i], b);
+                  test_1d_n (N, stride, gsl_wavelet_bspline_centered,
+                             member[i], b);
+                }
+
+              for (i = 4; i <= 20; i += 2)
+                {
+                  test_1d_n (N, stride, gsl_wavelet_daubechies, i, b);
+                  test_1d_n (N, stride, gsl_wavelet_daubechies_centered, i, b);
+                }
+
+              test_1d_n (N, stride, gsl_wavelet_haar, 2, b);
+              test_1d_n (N, stride, gsl_wavelet_haar_centered, 2, b);
+            }
+        }
+    }
+
+  /* The periodic transform still needs a power of two */
+
+  {
+    double data[3] = { 1.0, 2.0, 3.0 };
+    gsl_wavelet *w = gsl_wavelet_alloc (gsl_wavelet_daubechies, 4);
+    gsl_wavelet_workspace *work = gsl_wavelet_workspace_alloc (3);
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+    int status = gsl_wavelet_transform_forward (w, data, 1, 3, work);
+
+    gsl_test (status != GSL_EINVAL,
+              "%s(4) periodic transform rejects n = 3",
+              gsl_wavelet_name (w));
+
+    gsl_set_error_handler (old_handler);
+    gsl_wavelet_workspace_free (work);
+    gsl_wavelet_free (w);
+  }
+
   /* Two-dimensional tests */
 
   for (N = 1; N <= 64; N *= 2)
@@ -246,6 +438,41 @@ test_2d (size_t N, size_t tda, const gsl_wavelet_type * T, size_t member, int ty
               gsl_wavelet_name (w), member, name, N, tda, fabs (x2 - x1));
   }
 
+  if (type == 1)
+    {
+      /* compare with rows then columns transformed one at a time */
+      gsl_matrix *m3 = gsl_matrix_alloc (N, N);
+      double maxerr = 0.0;
+
+      gsl_matrix_memcpy (m2, m1);
+      gsl_matrix_memcpy (m3, m1);
+
+      gsl_wavelet2d_transform_matrix_forward (w, m2, work);
+
+      for (i = 0; i < N; i++)
+        gsl_wavelet_transform_forward (w, m3->data + i * m3->tda, 1, N, work);
+
+      for (j = 0; j < N; j++)
+        gsl_wavelet_transform_forward (w, m3->data + j, m3->tda, N, work);
+
+      for (i = 0; i < N; i++)
+        {
+          for (j = 0; j < N; j++)
+            {
+              double d = fabs (gsl_matrix_get (m2, i, j)
+                               - gsl_matrix_get (m3, i, j));
+              if (d > maxerr)
+                maxerr = d;
+            }
+        }
+
+      gsl_test (maxerr > N * 1e-15,
+                "%s(%d)-2d %s matches 1d transforms, n = %d, tda = %d, maxerr = %g",
+                gsl_wavelet_name (w), member, name, N, tda, maxerr);
+
+      gsl_matrix_free (m3);
+    }
+
   if (tda > N)
     {
       int status = 0;
@@ -19,9 +19,458 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_wavelet.h>
 
+/* Lifting factorization of the analysis filter bank.
+
+   Split the signal into its even and odd samples.  The smooth and
+   detail coefficients are then
+
+     s[i] = sum_m Le[m] a[2(i+m)] + Lo[m] a[2(i+m)+1]
+     d[i] = sum_m Ge[m] a[2(i+m)] + Go[m] a[2(i+m)+1]
+
+   and the polyphase matrix P = [[Le, Lo], [Ge, Go]] of Laurent
+   polynomials has a monomial determinant, since the filters give
+   perfect reconstruction.  The Euclidean algorithm on the first row,
+   dividing the longer of Le, Lo by the shorter one, writes P as a
+   diagonal (or antidiagonal) matrix of monomials times a product of
+   lifting steps [[1, q], [0, 1]] and [[1, 0], [q, 1]] (Daubechies and
+   Sweldens, J. Fourier Anal. Appl. 4 (1998) 247).  Each term of the
+   quotients is chosen to cancel whichever end of the remainder gives
+   the smaller coefficient, which keeps the steps well conditioned for
+   the longer Daubechies filters.  A lifting step costs one
+   multiplication per tap for half of the samples, so the steps need
+   about half the multiplications of the convolution.
+
+   The factorization is checked by multiplying the steps out again,
+   and is only used if it reproduces the filters to LIFTING_TOL. */
+
+#define LAURENT_MAX 64
+#define LIFTING_MAX_STEPS 64
+#define LIFTING_TOL 1e-10
+
+typedef struct
+{
+  int lo;                       /* power of the first coefficient */
+  int len;
+  double c[LAURENT_MAX];
+}
+laurent;
+
+static double
+laurent_norm (const laurent * p)
+{
+  double m = 0.0;
+  int i;
+
+  for (i = 0; i < p->len; i++)
+    {
+      if (fabs (p->c[i]) > m)
+        m = fabs (p->c[i]);
+    }
+
+  return m;
+}
+
+static void
+laurent_set (laurent * p, double k, int lo, int len)
+{
+  memset (p, 0, sizeof (laurent));
+  p->lo = lo;
+  p->len = len;
+  if (len > 0)
+    p->c[0] = k;
+}
+
+/* remove coefficients below tol from both ends */
+
+static void
+laurent_trim (laurent * p, double tol)
+{
+  int s = 0;
+
+  while (p->len > 0 && fabs (p->c[p->len - 1]) <= tol)
+    p->len--;
+
+  while (s < p->len && fabs (p->c[s]) <= tol)
+    s++;
+
+  if (s > 0)
+    {
+      memmove (p->c, p->c + s, (p->len - s) * sizeof (double));
+      p->len -= s;
+      p->lo += s;
+    }
+}
+
+/* r = a + sign * q * b, r may be the same as a */
+
+static int
+laurent_addmul (laurent * r, const laurent * a, double sign,
+                const laurent * q, const laurent * b)
+{
+  laurent t;
+  int lo, hi, i, j;
+
+  if (q->len == 0 || b->len == 0)
+    {
+      *r = *a;
+      return GSL_SUCCESS;
+    }
+
+  lo = q->lo + b->lo;
+  hi = q->lo + q->len - 1 + b->lo + b->len - 1;
+
+  if (a->len > 0)
+    {
+      lo = GSL_MIN_INT (lo, a->lo);
+      hi = GSL_MAX_INT (hi, a->lo + a->len - 1);
+    }
+
+  if (hi - lo + 1 > LAURENT_MAX)
+    return GSL_EFAILED;
+
+  laurent_set (&t, 0.0, lo, hi - lo + 1);
+
+  for (i = 0; i < a->len; i++)
+    t.c[a->lo + i - lo] = a->c[i];
+
+  for (i = 0; i < q->len; i++)
+    for (j = 0; j < b->len; j++)
+      t.c[q->lo + i + b->lo + j - lo] += sign * q->c[i] * b->c[j];
+
+  *r = t;
+
+  return GSL_SUCCESS;
+}
+
+/* divide d by v, giving d = q v + r with r shorter than v */
+
+static void
+laurent_divide (const laurent * d, const laurent * v, laurent * q,
+                laurent * r, double tol)
+{
+  const int vhi = v->lo + v->len - 1;
+  const int base = d->lo - vhi;  /* lowest possible power of q */
+  double qc[LAURENT_MAX];
+  int qlo = 0, qhi = -1, i;
+
+  *r = *d;
+  memset (qc, 0, sizeof (qc));
+
+  while (r->len >= v->len)
+    {
+      const double ttop = r->c[r->len - 1] / v->c[v->len - 1];
+      const double tbot = r->c[0] / v->c[0];
+      const int top = (fabs (ttop) <= fabs (tbot));
+      const double f = top ? ttop : tbot;
+      const int deg = top ? r->lo + r->len - 1 - vhi : r->lo - v->lo;
+
+      for (i = 0; i < v->len; i++)
+        r->c[deg + v->lo + i - r->lo] -= f * v->c[i];
+
+      /* the cancelled end is exactly zero */
+      r->c[top ? r->len - 1 : 0] = 0.0;
+
+      if (qhi < qlo)
+        {
+          qlo = qhi = deg;
+        }
+      else
+        {
+          qlo = GSL_MIN_INT (qlo, deg);
+          qhi = GSL_MAX_INT (qhi, deg);
+        }
+
+      qc[deg - base] += f;
+
+      laurent_trim (r, tol);
+    }
+
+  laurent_set (q, 0.0, qlo, qhi - qlo + 1);
+
+  for (i = qlo; i <= qhi; i++)
+    q->c[i - qlo] = qc[i - base];
+}
+
+/* polyphase component p of the filter f centred by offset */
+
+static void
+polyphase (const double *f, size_t nc, size_t offset, int p, laurent * P)
+{
+  int k, mlo = 0, mhi = -1;
+
+  for (k = 0; k < (int) nc; k++)
+    {
+      const int j = k - (int) offset;
+      const int m = (j - p) / 2;
+
+      if ((j - p) % 2 != 0)
+        continue;
+
+      if (mhi < mlo)
+        {
+          mlo = mhi = m;
+        }
+      else
+        {
+          mlo = GSL_MIN_INT (mlo, m);
+          mhi = GSL_MAX_INT (mhi, m);
+        }
+    }
+
+  laurent_set (P, 0.0, mlo, mhi - mlo + 1);
+
+  for (k = 0; k < (int) nc; k++)
+    {
+      const int j = k - (int) offset;
+
+      if ((j - p) % 2 == 0)
+        P->c[(j - p) / 2 - mlo] = f[k];
+    }
+
+  laurent_trim (P, 0.0);
+}
+
+static void
+lifting_free (gsl_wavelet_lifting * L)
+{
+  free (L->channel);
+  free (L->lo);
+  free (L->ntaps);
+  free (L->taps);
+  free (L);
+}
+
+/* factorize the filter bank with its polyphase components taken about
+   offset, giving the steps, scale factors and shifts */
+
+static int
+lifting_factor (const gsl_wavelet * w, size_t offset, double tol,
+                laurent * step, size_t * channel, size_t * nsteps,
+                double k[2], int shift[2], int *swap)
+{
+  laurent A[2][2], q, r;
+  size_t n = 0, i;
+  int status = GSL_SUCCESS;
+
+  polyphase (w->h1, w->nc, offset, 0, &A[0][0]);
+  polyphase (w->h1, w->nc, offset, 1, &A[0][1]);
+  polyphase (w->g1, w->nc, offset, 0, &A[1][0]);
+  polyphase (w->g1, w->nc, offset, 1, &A[1][1]);
+
+  /* Euclidean algorithm on the first row: a step on channel c
+     (x_c += q x_{1-c}) is removed from the right of P by
+     column_{1-c} -= q column_c, dividing the longer entry by the
+     shorter one */
+
+  while (A[0][0].len > 0 && A[0][1].len > 0)
+    {
+      const size_t c = (A[0][0].len >= A[0][1].len) ? 1 : 0;
+      const size_t t = 1 - c;
+
+      if (n == LIFTING_MAX_STEPS - 1)
+        return GSL_EFAILED;
+
+      laurent_divide (&A[0][t], &A[0][c], &q, &r, tol);
+      A[0][t] = r;
+      status |= laurent_addmul (&A[1][t], &A[1][t], -1.0, &q, &A[1][c]);
+      laurent_trim (&A[1][t], tol);
+
+      step[n] = q;
+      channel[n] = c;
+      n++;
+    }
+
+  if (status)
+    return status;
+
+  /* the remaining first row entry is K z^p, and the second row has a
+     monomial below it and a last lifting step beside it */
+
+  {
+    const size_t c = (A[0][1].len == 0) ? 0 : 1;
+    const laurent *m = &A[1][1 - c];
+    size_t dom = 0;
+    laurent t = A[1][c];
+
+    if (m->len == 0)
+      return GSL_EFAILED;
+
+    for (i = 1; i < (size_t) m->len; i++)
+      {
+        if (fabs (m->c[i]) > fabs (m->c[dom]))
+          dom = i;
+      }
+
+    *swap = (int) c;
+    k[0] = A[0][c].c[0];
+    shift[0] = A[0][c].lo;
+    k[1] = m->c[dom];
+    shift[1] = m->lo + (int) dom;
+
+    t.lo -= shift[1];
+
+    for (i = 0; i < (size_t) t.len; i++)
+      t.c[i] /= k[1];
+
+    if (t.len > 0)
+      {
+        step[n] = t;
+        channel[n] = 1 - c;
+        n++;
+      }
+  }
+
+  *nsteps = n;
+
+  return GSL_SUCCESS;
+}
+
+/* returns the factorization, or null if it does not reproduce the
+   filters accurately.  Taking the polyphase components about offset+1
+   instead of offset factorizes the filters for the signal advanced by
+   one sample, whose even and odd samples are x'_0[i] = x_1[i] and
+   x'_1[i] = x_0[i+1].  The two factorizations can have very different
+   lifting coefficients, so both are computed and the one with the
+   smaller largest coefficient is kept, after rewriting it in terms of
+   x_0 and x_1. */
+
+static gsl_wavelet_lifting *
+lifting_alloc (const gsl_wavelet * w)
+{
+  laurent P[2][2], S[2][2], r, one;
+  laurent step[2][LIFTING_MAX_STEPS];
+  size_t channel[2][LIFTING_MAX_STEPS], nsteps[2];
+  double k[2][2], cmax[2];
+  int shift[2][2], swap[2];
+  size_t ntaps = 0, i, j, e, p, best = 2;
+  double tol = 0.0;
+  gsl_wavelet_lifting *L;
+
+  for (i = 0; i < w->nc; i++)
+    tol = GSL_MAX_DBL (tol, fabs (w->h1[i]));
+
+  tol *= 1e-12;
+
+  polyphase (w->h1, w->nc, w->offset, 0, &P[0][0]);
+  polyphase (w->h1, w->nc, w->offset, 1, &P[0][1]);
+  polyphase (w->g1, w->nc, w->offset, 0, &P[1][0]);
+  polyphase (w->g1, w->nc, w->offset, 1, &P[1][1]);
+
+  laurent_set (&one, 1.0, 0, 1);
+
+  for (p = 0; p < 2; p++)
+    {
+      double err = 0.0;
+      int status = lifting_factor (w, w->offset + p, tol, step[p],
+                                   channel[p], &nsteps[p], k[p], shift[p],
+                                   &swap[p]);
+
+      if (status)
+        continue;
+
+      if (p == 1)
+        {
+          /* x'_c[i] = x_{1-c}[i + c] */
+
+          for (i = 0; i < nsteps[p]; i++)
+            {
+              const size_t c = channel[p][i];
+
+              step[p][i].lo += (int) (1 - c) - (int) c;
+              channel[p][i] = 1 - c;
+            }
+
+          shift[p][0] += swap[p];
+          shift[p][1] += 1 - swap[p];
+          swap[p] = 1 - swap[p];
+        }
+
+      /* check P = S A_n ... A_1 */
+
+      laurent_set (&S[0][0], 0.0, 0, 0);
+      laurent_set (&S[0][1], 0.0, 0, 0);
+      laurent_set (&S[1][0], 0.0, 0, 0);
+      laurent_set (&S[1][1], 0.0, 0, 0);
+      laurent_set (&S[0][swap[p]], k[p][0], shift[p][0], 1);
+      laurent_set (&S[1][1 - swap[p]], k[p][1], shift[p][1], 1);
+
+      for (i = nsteps[p]; i-- > 0;)
+        {
+          const size_t c = channel[p][i];
+
+          for (j = 0; j < 2; j++)
+            status |= laurent_addmul (&S[j][1 - c], &S[j][1 - c], 1.0,
+                                      &step[p][i], &S[j][c]);
+        }
+
+      for (i = 0; i < 2; i++)
+        {
+          for (j = 0; j < 2; j++)
+            {
+              status |= laurent_addmul (&r, &S[i][j], -1.0, &one, &P[i][j]);
+              err = GSL_MAX_DBL (err, laurent_norm (&r));
+            }
+        }
+
+      if (status || !(err <= LIFTING_TOL))
+        continue;
+
+      cmax[p] = 0.0;
+
+      for (i = 0; i < nsteps[p]; i++)
+        cmax[p] = GSL_MAX_DBL (cmax[p], laurent_norm (&step[p][i]));
+
+      if (best == 2 || cmax[p] < cmax[best])
+        best = p;
+    }
+
+  if (best == 2)
+    return 0;
+
+  L = (gsl_wavelet_lifting *) calloc (1, sizeof (gsl_wavelet_lifting));
+
+  if (L == 0)
+    return 0;
+
+  for (i = 0; i < nsteps[best]; i++)
+    ntaps += step[best][i].len;
+
+  L->nsteps = nsteps[best];
+  L->k[0] = k[best][0];
+  L->k[1] = k[best][1];
+  L->shift[0] = shift[best][0];
+  L->shift[1] = shift[best][1];
+  L->swap = swap[best];
+  L->channel = (size_t *) malloc (L->nsteps * sizeof (size_t));
+  L->lo = (int *) malloc (L->nsteps * sizeof (int));
+  L->ntaps = (size_t *) malloc (L->nsteps * sizeof (size_t));
+  L->taps = (double *) malloc (ntaps * sizeof (double));
+
+  if (L->channel == 0 || L->lo == 0 || L->ntaps == 0 || L->taps == 0)
+    {
+      lifting_free (L);
+      return 0;
+    }
+
+  for (e = 0, i = 0; i < L->nsteps; i++)
+    {
+      L->channel[i] = channel[best][i];
+      L->lo[i] = step[best][i].lo;
+      L->ntaps[i] = step[best][i].len;
+
+      for (j = 0; j < (size_t) step[best][i].len; j++)
+        L->taps[e++] = step[best][i].c[j];
+    }
+
+  return L;
+}
+
 gsl_wavelet *
 gsl_wavelet_alloc (const gsl_wavelet_type * T, size_t k)
 {
@@ -46,6 +495,8 @@ gsl_wavelet_alloc (const gsl_wavelet_type * T, size_t k)
       GSL_ERROR_VAL ("invalid wavelet member", GSL_EINVAL, 0);
     }
 
+  w->lifting = lifting_alloc (w);
+
   return w;
 }
 
@@ -53,6 +504,10 @@ void
 gsl_wavelet_free (gsl_wavelet * w)
 {
   RETURN_IF_NULL (w);
+
+  if (w->lifting)
+    lifting_free (w->lifting);
+
   free (w);
 }
 